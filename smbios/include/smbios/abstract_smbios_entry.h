@@ -1,16 +1,16 @@
 #pragma once
 #include <map>
-#include <sstream>
 #include <type_traits>
 #include <vector>
 #include <string>
 #include <memory>
+#include <boost/utility/string_view.hpp>
 #include <smbios/smbios_entry_interface.h>
+#include <smbios/render_buffer.h>
+#include <smbios/smbios.h>
 
 namespace smbios {
 
-struct DMIHeader;
-
 /// @brief Basic functionality implementation for any SMBIOS entry
 /// Working with DMI strings, offsets, convert bitwise properties to description etc
 /// Class instance does not "own" this memory, it just provide more convenient interface
@@ -21,51 +21,60 @@ public:
     /// @brief Accept a copy of own header
     AbstractSMBiosEntry(const DMIHeader& header);
 
+    /// @brief Entries are values, could be stored in containers and variants
+    AbstractSMBiosEntry(const AbstractSMBiosEntry&) = default;
+    AbstractSMBiosEntry(AbstractSMBiosEntry&&) = default;
+
     // @brief Parent is abstract
     virtual ~AbstractSMBiosEntry() = default;
 
     /// @brief Entry size without string section
     size_t get_entry_size() const override;
 
+    /// @brief Render with render_to() into temporary buffer
+    std::string render_to_description() const override;
+
 protected:
 
     /// Implementation of SMBIOS string extractor
     /// Note: First string index is 1, 0 is "Not Specified"
     std::string dmi_string(size_t string_index) const;
 
+    /// The same as dmi_string(), but no copy, view into the table
+    boost::string_view dmi_string_view(size_t string_index) const;
+
     /// Print segment-based offset
     std::string address_string(uint16_t string_index) const;
 
     /// Default implementation of SMBIOS bitwise properties to string representation
     template <typename T>
     std::string bitset_to_properties(T properties, const std::map<T, std::string>& properties_map) const
+    {
+        RenderBuffer properties_buffer;
+        append_properties(properties_buffer, properties, properties_map);
+        return properties_buffer.str();
+    }
+
+    /// Append one tab-indented line per known bit set in properties
+    template <typename T>
+    void append_properties(RenderBuffer& out, T properties, const std::map<T, std::string>& properties_map) const
     {
         static_assert(std::is_integral<T>(), "Bitwise type should be integer");
 
-        std::stringstream properties_stream;
         for (T current_property = 0x1; current_property; current_property <<= 1) {
+            if (!(properties & current_property)) {
+                continue;
+            }
             auto it = properties_map.find(current_property);
-            if ((properties & current_property) && (it != properties_map.end())) {
-                properties_stream << '\t' << (*it).second << '\n';
+            if (it != properties_map.end()) {
+                out << '\t' << (*it).second << '\n';
             }
         }
-        return std::move(properties_stream.str());
     }
-private:
-
-    /// Extract all strings from the string section
-    /// which is plain char array separated with \0 symbols
-    /// End of section is \0\0 sequence, which it followed by the next SMBIOS entry
-    /// There is no limit on the length of each individual text string
-    void parse_dmi_strings();
-
 private:
     
-    /// copy of entry header
-    std::unique_ptr<DMIHeader> header_;
-
-    /// Extracted DMI strings
-    std::vector<std::string> dmi_strings_;
+    /// copy of entry header, strings are looked up in its string section
+    DMIHeader header_;
 };
 
 } // namespace smbios
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <map>
 #include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
 
 // BIOS Information entry
 // See http://www.dmtf.org/standards/smbios
@@ -13,37 +14,41 @@ namespace smbios {
 struct DMIHeader;
 struct SMBiosVersion;
 
-// should be aligned to be mapped to physical memory
-#pragma pack(push, 1)
-
-/// @brief SMBIOS BIOS Information entry Ver 2.4
-struct BiosInformationV24 {
-    uint32_t header;
-    uint8_t vendor;
-    uint8_t bios_version;
-    uint16_t starting_segment;
-    uint8_t release_date;
-    uint8_t rom_size;
-    uint64_t bios_properties;
-    uint8_t properties_extension1;
-    uint8_t properties_extension2;
-    uint8_t bios_major_version;
-    uint8_t bios_minor_version;
-    uint8_t firmware_major_version;
-    uint8_t firmware_minor_version;
-};
+/// @brief SMBIOS BIOS Information fields and formatted area length by version
+struct BiosInformationLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 0, 0x12 },
+        { 2, 4, 0x18 },
+        { 3, 1, 0x1A }
+    };
 
-/// @brief SMBIOS BIOS Information entry Ver 3.1
-struct BiosInformationV31 : public BiosInformationV24 {
-    uint16_t extended_rom_size;
+    // Ver 2.0+
+    using Vendor = SMBiosField<uint8_t, 0x04, 2, 0>;
+    using BiosVersion = SMBiosField<uint8_t, 0x05, 2, 0>;
+    using StartingSegment = SMBiosField<uint16_t, 0x06, 2, 0>;
+    using ReleaseDate = SMBiosField<uint8_t, 0x08, 2, 0>;
+    using RomSize = SMBiosField<uint8_t, 0x09, 2, 0>;
+    using Properties = SMBiosField<uint64_t, 0x0A, 2, 0>;
+
+    // Ver 2.4+
+    using PropertiesExtension1 = SMBiosField<uint8_t, 0x12, 2, 4>;
+    using PropertiesExtension2 = SMBiosField<uint8_t, 0x13, 2, 4>;
+    using BiosMajorVersion = SMBiosField<uint8_t, 0x14, 2, 4>;
+    using BiosMinorVersion = SMBiosField<uint8_t, 0x15, 2, 4>;
+    using FirmwareMajorVersion = SMBiosField<uint8_t, 0x16, 2, 4>;
+    using FirmwareMinorVersion = SMBiosField<uint8_t, 0x17, 2, 4>;
+
+    // Ver 3.1+
+    using ExtendedRomSize = SMBiosField<uint16_t, 0x18, 3, 1>;
 };
 
-#pragma pack(pop)
-
 /// @brief  BIOS Information structure
-class BiosInformationEntry : public AbstractSMBiosEntry {
+class BiosInformationEntry final : public AbstractSMBiosEntry {
 public:
 
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::BIOSInformation;
+
     // @brief BIOS Characteristics bitwise layout
     // (*u suffix is obligatory for some compilers)
     enum BiosProperties : uint64_t {
@@ -111,14 +116,18 @@ public:
     /// in BIOS Information SMBIOS entry depending on version and size (should be compliant)
     BiosInformationEntry(const DMIHeader& header, const SMBiosVersion& version);
 
+    /// @brief Value semantic, no heap allocation for the entry itself
+    BiosInformationEntry(const BiosInformationEntry&) = default;
+    BiosInformationEntry(BiosInformationEntry&&) = default;
+
     // @brief Parent is abstract
     virtual ~BiosInformationEntry() = default;
 
     /// @brief String representation
     virtual std::string get_type() const override;
 
-    /// @brief Render all entry information into single string
-    virtual std::string render_to_description() const override;
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
 
     //////////////////////////////////////////////////////////////////////////
     // Byte values
@@ -227,19 +236,23 @@ private:
     /// Format version string
     std::string stream_to_version(uint16_t major, uint16_t minor) const;
 
+    /// Bitwise to string representation, the same for every entry
+    struct StringValues {
+        std::map<uint64_t, std::string> properties_map;
+        std::map<uint8_t, std::string> properties_extensions1_map;
+        std::map<uint8_t, std::string> properties_extensions2_map;
+    };
+
+    /// Maps are filled once, on the first use
+    static const StringValues& string_values();
+
     /// Map flags data to string values
-    void init_string_values();
+    static void init_string_values(StringValues& values);
 
 private:
 
-    /// Initialization depends on SMBIOS version
-    const BiosInformationV24* bios_information24_ = nullptr;
-    const BiosInformationV31* bios_information31_ = nullptr;
-
-    /// Bitwise to string representation
-    std::map<uint64_t, std::string> properties_map_;
-    std::map<uint8_t, std::string> properties_extensions1_map_;
-    std::map<uint8_t, std::string> properties_extensions2_map_;
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
 };
 
 } // namespace smbios
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <smbios/smbios_structure_view.h>
+#include <smbios/bios_information_entry.h>
+
+// BIOS Information typed view
+// Same numeric getters as BiosInformationEntry, strings are returned without copy
+// See BiosInformationEntry for field descriptions
+
+namespace smbios {
+
+/// @brief Trivially copyable view under BIOS Information structure (type 0)
+class BiosInformationView : public SMBiosStructureView {
+public:
+
+    /// Structure type this view could be applied to
+    static constexpr uint8_t structure_type = SMBios::BIOSInformation;
+
+    /// @brief Empty view
+    BiosInformationView() = default;
+
+    /// @brief Point to the BIOS Information structure
+    BiosInformationView(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief String representation
+    std::string get_type() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    uint8_t get_vendor_index() const;
+    uint8_t get_version_index() const;
+    uint16_t get_starting_address() const;
+    uint32_t get_runtime_size() const;
+    uint8_t get_release_date_index() const;
+
+    /// @brief Size of the physical device containing the BIOS, kB
+    /// 0 if size is 16MB or greater, see get_extended_rom_size()
+    uint32_t get_rom_size() const;
+    uint64_t get_properties() const;
+    uint8_t get_properties_extension1() const;
+    uint8_t get_properties_extension2() const;
+    uint8_t get_bios_major_release() const;
+    uint8_t get_bios_minor_release() const;
+    uint8_t get_firmware_major_release() const;
+    uint8_t get_firmware_minor_release() const;
+
+    /// @brief 3.1+ Extended BIOS ROM size
+    /// Bits 15:14 - unit (00b MB, 01b GB), bits 13:0 - size
+    uint16_t get_extended_rom_size() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values, point to the table memory
+
+    boost::string_view get_vendor_string() const;
+    boost::string_view get_version_string() const;
+    boost::string_view get_release_date_string() const;
+};
+
+} // namespace smbios
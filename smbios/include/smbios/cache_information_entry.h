@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+
+// Cache Information entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'Cache Information' chapter
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS CacheInformation fields and formatted area length by version
+struct CacheInformationLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 0, 0x0F },
+        { 2, 1, 0x13 },
+        { 3, 1, 0x1B }
+    };
+
+    // Ver 2.0+
+    using SocketDesignation = SMBiosField<uint8_t, 0x04, 2, 0>;
+    using Configuration = SMBiosField<uint16_t, 0x05, 2, 0>;
+    using MaximumSize = SMBiosField<uint16_t, 0x07, 2, 0>;
+    using InstalledSize = SMBiosField<uint16_t, 0x09, 2, 0>;
+    using SupportedSramType = SMBiosField<uint16_t, 0x0B, 2, 0>;
+    using CurrentSramType = SMBiosField<uint16_t, 0x0D, 2, 0>;
+
+    // Ver 2.1+
+    using CacheSpeed = SMBiosField<uint8_t, 0x0F, 2, 1>;
+    using ErrorCorrectionType = SMBiosField<uint8_t, 0x10, 2, 1>;
+    using SystemCacheType = SMBiosField<uint8_t, 0x11, 2, 1>;
+    using Associativity = SMBiosField<uint8_t, 0x12, 2, 1>;
+
+    // Ver 3.1+
+    using MaximumSize2 = SMBiosField<uint32_t, 0x13, 3, 1>;
+    using InstalledSize2 = SMBiosField<uint32_t, 0x17, 3, 1>;
+};
+
+/// @brief Decode cache size to bytes
+/// 16-bit sizes: bit 15 is granularity (0 - 1K, 1 - 64K), bits 14:0 - size in granularity units
+/// 32-bit sizes: bit 31 is granularity, bits 30:0 - size; used when present in the structure
+uint64_t cache_size_bytes(uint16_t size, uint32_t size2, bool size2_available);
+
+/// @brief Information about one cache memory
+class CacheInformationEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::CacheInformation;
+
+    // @brief Bit-mask values for Configuration: uint16 - offset 0x05
+    enum ConfigurationValue : uint16_t {
+        CacheLevelMask = 0x0007,
+        CacheSocketed = 0x0008,
+        CacheEnabled = 0x0080
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    CacheInformationEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    CacheInformationEntry(const CacheInformationEntry&) = default;
+    CacheInformationEntry(CacheInformationEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~CacheInformationEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x05 offset
+    /// See ConfigurationValue enum
+    uint16_t get_configuration() const;
+
+    /// @brief Cache level 1..8 from the configuration
+    uint8_t get_level() const;
+
+    /// @brief Cache is enabled at boot
+    bool is_enabled() const;
+
+    /// @brief 0x07 and 0x13 offsets
+    /// Maximum size that can be installed, bytes
+    uint64_t get_maximum_size_bytes() const;
+
+    /// @brief 0x09 and 0x17 offsets
+    /// Installed size, bytes, 0 if no cache is installed
+    uint64_t get_installed_size_bytes() const;
+
+    /// @brief 0x0F offset
+    /// Cache module speed, nanoseconds, 0 if unknown
+    uint8_t get_cache_speed() const;
+
+    /// @brief 0x10 offset
+    uint8_t get_error_correction_type() const;
+
+    /// @brief 0x11 offset
+    /// Instruction, Data, Unified etc.
+    uint8_t get_system_cache_type() const;
+
+    /// @brief 0x12 offset
+    uint8_t get_associativity() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values
+
+    /// EXAMPLE : 'L2 Cache'
+    std::string get_socket_designation_string() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include <smbios/render_buffer.h>
+
+// CBOR (RFC 8949) encoding and streaming decoding
+// The writer appends items to RenderBuffer as they are written, like JsonWriter it keeps
+// no DOM; container lengths are either given up front or the container is indefinite
+// and closed by a break. The reader is a pull parser over the encoded bytes: every
+// next() returns the next data item head, byte and text strings refer to the input,
+// nothing is copied or allocated. Indefinite-length strings and UTF-8 validation
+// are not supported, the encoder never produces the former
+
+namespace smbios {
+
+/// @brief Append CBOR data items to the buffer
+/// Caller is responsible for the document structure: key and value pairs in maps etc.
+class CborWriter {
+public:
+
+    explicit CborWriter(RenderBuffer& out);
+
+    /// @brief Container with known number of elements (pairs for maps)
+    CborWriter& begin_array(uint64_t count);
+    CborWriter& begin_map(uint64_t pairs);
+
+    /// @brief Indefinite-length container, closed by end()
+    CborWriter& begin_array();
+    CborWriter& begin_map();
+    CborWriter& end();
+
+    CborWriter& number(uint64_t value);
+    CborWriter& string(boost::string_view text);
+    CborWriter& bytes(const uint8_t* bytes, size_t size);
+    CborWriter& boolean(bool value);
+    CborWriter& null();
+
+    /// @brief Underlying buffer
+    RenderBuffer& buffer() { return out_; }
+
+private:
+
+    /// Major type and argument in the shortest form
+    void head(uint8_t major, uint64_t argument);
+
+private:
+
+    RenderBuffer& out_;
+};
+
+/// @brief Major types, simple values and floats are split for convenience
+enum class CborType : uint8_t {
+    Unsigned,
+    Negative,
+    Bytes,
+    Text,
+    Array,
+    Map,
+    Tag,
+    Simple,
+    Float,
+    Break
+};
+
+/// @brief Simple values of RFC 8949 section 3.3
+constexpr uint64_t cbor_false = 20;
+constexpr uint64_t cbor_true = 21;
+constexpr uint64_t cbor_null = 22;
+
+/// @brief Head of single data item
+struct CborItem {
+    CborType type;
+
+    /// Container length is not encoded, elements are followed by a break
+    bool indefinite;
+
+    /// Unsigned: the value; Negative: -1 - value; Bytes and Text: length;
+    /// Array: count; Map: pairs; Tag: tag number; Simple: the value; Float: IEEE bits
+    uint64_t value;
+
+    /// Bytes and Text content, nullptr for other types
+    const uint8_t* data;
+
+    boost::string_view text() const
+    {
+        return boost::string_view(reinterpret_cast<const char*>(data), static_cast<size_t>(value));
+    }
+};
+
+/// @brief Pull parser over encoded data
+/// Throws std::runtime_error on truncated or malformed data
+class CborReader {
+public:
+
+    /// Deeper nesting is rejected by skip()
+    static constexpr size_t max_depth = 64;
+
+    CborReader(const uint8_t* data, size_t size);
+
+    /// @brief Head of the next item, contents of strings are consumed as well
+    CborItem next();
+
+    /// @brief Consume elements of the container or the tagged item, nothing for other items
+    void skip(const CborItem& item);
+
+    /// @brief All bytes are consumed
+    bool at_end() const { return position_ == size_; }
+
+    /// @brief Bytes consumed so far
+    size_t position() const { return position_; }
+
+private:
+
+    uint64_t read_argument(uint8_t additional);
+
+    void skip(const CborItem& item, size_t depth);
+
+private:
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t position_ = 0;
+};
+
+} // namespace smbios
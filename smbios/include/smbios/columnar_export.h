@@ -0,0 +1,135 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+
+// Binary columnar export for fleet analytics
+// Tables of many hosts are collected into one column block per structure type and field,
+// fields are described by the structure schemas (see smbios_schema.h).
+//
+// File layout, all integers little-endian, every block starts at 8-byte boundary:
+//   header   "SMBC", u16 format version, u16 reserved
+//   blocks   validity bitmap (bit per row, LSB first), then values:
+//            number column - rows * width bytes
+//            bytes column  - rows * width bytes (UUID etc.)
+//            string column - rows * u32 dictionary codes,
+//                            then u32 count, u32 offsets[count + 1], characters
+//   index    32-byte entry per column, then column names
+//   trailer  u64 index offset, u32 columns count, "SMBC"
+//
+// Reader needs only the trailer and the index to reach any column, so the file
+// could be mapped into memory and read in place. Every type has "host", "handle"
+// and "length" columns, then snake_case schema field names: type 17 "size", "locator" etc.
+
+namespace smbios {
+
+/// @brief How column values are stored
+enum class ColumnKind : uint8_t {
+    Number = 0,     // unsigned little-endian integers of the column width
+    String = 1,     // u32 codes into the column dictionary
+    Bytes = 2       // raw byte arrays of the column width
+};
+
+/// @brief Snake case column name for the schema field name: "Bank Locator" -> "bank_locator"
+std::string column_name(boost::string_view field_name);
+
+/// @brief Collects structures of many tables and serializes them column by column
+class ColumnarExporter {
+public:
+
+    ColumnarExporter();
+    ~ColumnarExporter();
+
+    ColumnarExporter(const ColumnarExporter&) = delete;
+    ColumnarExporter& operator=(const ColumnarExporter&) = delete;
+
+    /// @brief Append every structure of the table as a row of its type
+    /// The table should outlive the exporter, strings are not copied until serialization
+    void add_table(const SMBios& smbios, boost::string_view host);
+
+    /// @brief Rows collected for the structure type
+    size_t get_rows(uint8_t type) const;
+
+    /// @brief Whole file in memory
+    std::vector<uint8_t> serialize() const;
+
+private:
+
+    struct TypeColumns;
+
+    /// Column sets by structure type, nullptr if there is no structure of the type
+    std::unique_ptr<TypeColumns> types_[256];
+
+    /// Host names of the added tables, deque keeps them in place
+    std::deque<std::string> hosts_;
+};
+
+/// @brief Single column of the mapped file, no copy
+class ColumnView {
+public:
+
+    ColumnView() = default;
+    ColumnView(ColumnKind kind, uint8_t width, uint32_t rows, const uint8_t* block, const uint8_t* block_end);
+
+    /// @brief Column has been found
+    bool valid() const { return nullptr != validity_; }
+
+    ColumnKind get_kind() const { return kind_; }
+    uint8_t get_width() const { return width_; }
+    uint32_t get_rows() const { return rows_; }
+
+    /// @brief Field is present in the structure of the row, false for rows out of range
+    bool has_value(uint32_t row) const;
+
+    /// @brief Number column value, 0 if the row has no value
+    uint64_t get_number(uint32_t row) const;
+
+    /// @brief String column value, empty if the row has no value
+    boost::string_view get_string(uint32_t row) const;
+
+    /// @brief Bytes column value, get_width() bytes, nullptr for rows out of range
+    const uint8_t* get_bytes(uint32_t row) const;
+
+    /// @brief Distinct strings of the column
+    uint32_t get_dictionary_size() const { return dictionary_size_; }
+
+private:
+    ColumnKind kind_ = ColumnKind::Number;
+    uint8_t width_ = 0;
+    uint32_t rows_ = 0;
+    const uint8_t* validity_ = nullptr;
+    const uint8_t* values_ = nullptr;
+
+    /// String columns only
+    uint32_t dictionary_size_ = 0;
+    const uint8_t* offsets_ = nullptr;
+    const char* characters_ = nullptr;
+};
+
+/// @brief Random access to the columns of serialized export
+/// Only the trailer and the index are validated, data is not copied
+class ColumnarReader {
+public:
+
+    /// @brief Memory should outlive the reader, throws std::runtime_error on malformed file
+    ColumnarReader(const uint8_t* data, size_t size);
+
+    /// @brief Columns of all types
+    size_t get_columns_count() const { return columns_count_; }
+
+    /// @brief Column by structure type and column name, invalid view if there is no one
+    ColumnView find_column(uint8_t type, boost::string_view name) const;
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    const uint8_t* index_;
+    size_t columns_count_;
+};
+
+} // namespace smbios
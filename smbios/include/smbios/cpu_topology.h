@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Processor and cache topology summary
+// Processor Information (type 4) structures with their Cache Information (type 7)
+// structures, linked through the handle graph
+// Summary is exported in compact binary form (for node registration messages)
+// and in text form (one line per socket)
+
+namespace smbios {
+
+class SMBios;
+class RenderBuffer;
+
+/// @brief Single processor socket
+struct CpuSocketSummary {
+    uint16_t handle;
+    bool populated;
+    uint16_t cores;
+    uint16_t cores_enabled;
+    uint16_t threads;
+
+    /// MHz, 0 if unknown
+    uint16_t max_speed;
+    uint16_t current_speed;
+
+    /// Installed cache sizes by level, bytes
+    uint64_t l1_cache_size;
+    uint64_t l2_cache_size;
+    uint64_t l3_cache_size;
+};
+
+/// @brief Whole host summary, totals include populated sockets only
+struct CpuTopology {
+    uint16_t populated_sockets = 0;
+    uint32_t cores = 0;
+    uint32_t threads = 0;
+
+    /// Sockets in table order
+    std::vector<CpuSocketSummary> sockets;
+};
+
+/// @brief Walk processors once, caches are resolved through SMBios::handle_graph()
+CpuTopology summarize_cpu_topology(const SMBios& smbios);
+
+/// @brief Compact little-endian binary form
+/// 'CPUT' magic, format version byte, reserved byte, 16-bit sockets count,
+/// then fixed 26-byte record for every socket, cache sizes in kilobytes
+std::vector<uint8_t> serialize_cpu_topology(const CpuTopology& topology);
+
+/// @brief Restore topology from binary form, throws std::runtime_error on malformed data
+CpuTopology deserialize_cpu_topology(const uint8_t* data, size_t size);
+
+/// @brief Text form: totals line, then one line per socket
+std::string render_cpu_topology(const CpuTopology& topology);
+
+/// @brief Append the text form to the buffer
+void render_cpu_topology(const CpuTopology& topology, RenderBuffer& out);
+
+} // namespace smbios
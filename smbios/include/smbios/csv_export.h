@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/render_buffer.h>
+
+// Delimited text export: one row per structure of the chosen type
+// Columns are the same as in the columnar export (see columnar_export.h):
+// optional "host", "handle", "length", then snake_case schema field names.
+//
+// Values: strings and enum names as text, enums with unknown value and all other
+// numbers in decimal, bitfields as names of the set bits joined with '|',
+// byte arrays as hex digits. Fields missing in the structure are empty in CSV
+// and \N in TSV, so clickhouse-local reads them as NULL.
+// CSV follows RFC 4180 quoting, TSV escapes tab, line feed, carriage return
+// and backslash the way TabSeparated format expects
+
+namespace smbios {
+
+/// @brief Text form of the export
+enum class DelimitedFormat : uint8_t {
+    Csv,
+    Tsv
+};
+
+/// @brief Renders rows of one structure type into the buffer
+/// Exporter keeps no state between tables, so the caller may flush
+/// the buffer at any row boundary and reuse it
+class CsvExporter {
+public:
+
+    CsvExporter(uint8_t type, DelimitedFormat format, bool host_column);
+
+    /// @brief Append the column names line
+    void render_header(RenderBuffer& out) const;
+
+    /// @brief Append a line for every structure of the type in the table, in table order
+    /// Return the number of rows
+    size_t render_rows(const SMBios& smbios, boost::string_view host, RenderBuffer& out) const;
+
+private:
+
+    /// Text escaped for the format
+    void append_text(RenderBuffer& out, boost::string_view text) const;
+
+    /// Missing field marker
+    void append_missing(RenderBuffer& out) const;
+
+private:
+
+    uint8_t type_;
+    DelimitedFormat format_;
+    bool host_column_;
+    char separator_;
+};
+
+} // namespace smbios
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+
+// DIMM locator recognizer
+// Memory Device (type 17) device and bank locators are vendor-specific strings:
+// 'CPU1_DIMM_A2', 'P0 CHANNEL B' + 'DIMM 1', 'ChannelC-DIMM0', 'PROC 1 DIMM 3' etc.
+// Patterns are matched by hand-written code without allocation or regular expressions;
+// numeric fields backtrack to shorter digit runs if the rest of the pattern does not match
+//
+// Pattern syntax, letters are case-insensitive:
+//   {s}   socket number, decimal
+//   {c}   channel, single letter (A is 0) or decimal; letter only if followed by another field
+//   {d}   slot number, decimal
+//   ' '   any run of ' ', '_' and '-' separators, possibly empty
+//   other characters should match literally
+
+namespace smbios {
+
+class MemoryDeviceView;
+class MemoryDeviceEntry;
+
+/// @brief Numeric DIMM position, numbers are as printed in the locator
+struct DimmCoordinates {
+
+    /// Coordinate is not present in the locator
+    static constexpr uint8_t unknown = 0xFF;
+
+    uint8_t socket = unknown;
+    uint8_t channel = unknown;
+    uint8_t slot = unknown;
+};
+
+/// @brief Vendor pattern for the device locator and (optionally) the bank locator
+/// Empty pattern accepts any locator; both non-empty patterns should match
+struct DimmLocatorPattern {
+    std::string device_locator;
+    std::string bank_locator;
+};
+
+/// @brief Match one pattern against the text, set coordinates of the pattern fields
+/// Coordinates are left untouched if the text does not match
+bool match_locator_pattern(boost::string_view pattern, boost::string_view text, DimmCoordinates& coordinates);
+
+/// @brief Ordered list of patterns, the first matching one wins
+class DimmLocatorParser {
+public:
+
+    /// @brief Parser with the built-in vendor patterns
+    DimmLocatorParser();
+
+    /// @brief Parser with own patterns only
+    explicit DimmLocatorParser(const std::vector<DimmLocatorPattern>& patterns);
+
+    /// @brief Built-in patterns, the most specific first
+    static const std::vector<DimmLocatorPattern>& get_default_patterns();
+
+    /// @brief Try the pattern before all existing ones (vendor overrides)
+    /// Throws std::invalid_argument on malformed pattern
+    void add_pattern(const DimmLocatorPattern& pattern);
+
+    /// @brief Recognize coordinates, false if no pattern matches
+    bool parse(boost::string_view device_locator, boost::string_view bank_locator,
+        DimmCoordinates& coordinates) const;
+
+    /// @brief Recognize locators of the Memory Device
+    bool parse(const MemoryDeviceView& device, DimmCoordinates& coordinates) const;
+    bool parse(const MemoryDeviceEntry& device, DimmCoordinates& coordinates) const;
+
+private:
+
+    std::vector<DimmLocatorPattern> patterns_;
+};
+
+} // namespace smbios
@@ -0,0 +1,39 @@
+#pragma once
+#include <bitset>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/render_buffer.h>
+
+// dmidecode-compatible text
+// Legacy tooling parses dmidecode output, so the same layout is rendered from the table
+// in memory: "Handle 0x0011, DMI type 17, 40 bytes" line, structure name, tab-indented
+// "Name: value" attributes and lists, dmidecode wording, units and <OUT OF SPEC> marks.
+// BIOS, system, baseboard, chassis, processor, cache, OEM strings, configuration options,
+// memory array, memory device, mapped address and boot structures are decoded; other types
+// are printed as dmidecode -u does, header and data in hex followed by the strings.
+// The banner line is a comment naming this library, not a dmidecode version
+
+namespace smbios {
+
+/// @brief Structure types selected by dmidecode -t, nothing set selects every type
+using DmidecodeTypes = std::bitset<256>;
+
+/// @brief Parse -t argument: comma-separated type numbers (decimal or 0x hex) and keywords
+/// bios, system, baseboard, chassis, processor, memory, cache, connector, slot
+/// Throws std::invalid_argument on anything else
+DmidecodeTypes parse_dmidecode_types(boost::string_view types);
+
+/// @brief Keyword is known to dmidecode -s (bios-vendor, system-uuid, processor-version etc.)
+bool is_dmidecode_keyword(boost::string_view keyword);
+
+/// @brief Banner, entry point version and structures of the selected types, as dmidecode prints them
+void render_dmidecode(const SMBios& smbios, const DmidecodeTypes& types, RenderBuffer& out);
+
+/// @brief Single structure, from the handle line to the empty line after it
+void render_dmidecode_structure(const DMIHeader& header, const SMBiosVersion& version, RenderBuffer& out);
+
+/// @brief Value of dmidecode -s keyword, one line per structure which has it, nothing else
+/// Throws std::invalid_argument for unknown keyword
+void render_dmidecode_string(const SMBios& smbios, boost::string_view keyword, RenderBuffer& out);
+
+} // namespace smbios
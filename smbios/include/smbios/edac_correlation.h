@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <smbios/smbios.h>
+
+// EDAC sysfs correlation
+// Linux EDAC exposes per-DIMM error counters in /sys/devices/system/edac/mc/mc*/dimm*/
+// DIMMs are matched to Memory Device (type 17) structures once, by label
+// ("<bank locator> <device locator>" for firmware-first ghes_edac, or a label
+// ending with the device locator), falling back to table order when labels
+// are not informative. After that every poll is a counters read by position
+
+namespace smbios {
+
+/// @brief DIMM directory of EDAC memory controller
+struct EdacDimm {
+    /// N of mcN
+    uint32_t controller;
+
+    /// M of dimmM
+    uint32_t index;
+
+    /// dimm_label and dimm_location files content
+    std::string label;
+    std::string location;
+
+    /// size file, MB
+    uint64_t size_mb;
+
+    /// DIMM directory
+    std::string path;
+};
+
+/// @brief Error counters of one DIMM
+struct EdacCounters {
+    uint64_t corrected;
+    uint64_t uncorrected;
+};
+
+/// @brief How EDAC DIMM has been matched to Memory Device
+enum class EdacMatch : uint8_t {
+    Unmatched,
+    BankAndDeviceLocator,
+    DeviceLocator,
+    TableOrder
+};
+
+/// @brief Enumerate EDAC DIMMs sorted by controller and DIMM index
+/// Missing root (no EDAC driver) gives empty list, not an error
+std::vector<EdacDimm> read_edac_dimms(const std::string& edac_root = "/sys/devices/system/edac/mc");
+
+/// @brief Read dimm_ce_count and dimm_ue_count of the DIMM directory
+/// Return false if counters are not readable
+bool read_edac_counters(const std::string& dimm_path, EdacCounters& counters);
+
+/// @brief Immutable mapping from EDAC DIMM position to Memory Device header index
+class EdacCorrelation {
+public:
+
+    /// Header index value for unmatched DIMM
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Match DIMMs to populated Memory Devices, each device is matched once
+    EdacCorrelation(const SMBios& smbios, std::vector<EdacDimm> dimms);
+
+    /// @brief DIMMs in the order returned by read_edac_dimms()
+    const std::vector<EdacDimm>& get_dimms() const;
+
+    /// @brief Memory Device header index of the DIMM at position, npos if unmatched
+    size_t get_header_index(size_t dimm_position) const;
+
+    /// @brief Matching rule which produced the pair
+    EdacMatch get_match(size_t dimm_position) const;
+
+    /// @brief Matched DIMMs count
+    size_t get_matched_count() const;
+
+    /// @brief Read counters of all DIMMs, counters[i] belongs to get_dimms()[i]
+    /// Unreadable counters are zero; reuse the vector between polls
+    void read_counters(std::vector<EdacCounters>& counters) const;
+
+private:
+
+    std::vector<EdacDimm> dimms_;
+    std::vector<size_t> header_indices_;
+    std::vector<EdacMatch> matches_;
+
+    /// Counter file paths, composed once
+    std::vector<std::string> ce_count_paths_;
+    std::vector<std::string> ue_count_paths_;
+};
+
+} // namespace smbios
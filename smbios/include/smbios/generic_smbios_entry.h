@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_schema.h>
+
+// Generic SMBIOS entry
+// Decodes any standard structure type which has no dedicated entry class,
+// using the field descriptors from smbios_schema.h
+
+namespace smbios {
+
+/// @brief Entry decoded by the schema of its structure type
+class GenericSMBiosEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// @brief Find the schema for the header type
+    /// Throws std::runtime_error if the type has no schema (OEM-specific types)
+    GenericSMBiosEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    GenericSMBiosEntry(const GenericSMBiosEntry&) = default;
+    GenericSMBiosEntry(GenericSMBiosEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~GenericSMBiosEntry() = default;
+
+    /// @brief String representation, structure name from the schema
+    virtual std::string get_type() const override;
+
+    /// @brief Append all available fields to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    /// @brief Schema used for decoding
+    const StructureSchema& get_schema() const;
+
+    /// @brief Call visitor(const DecodedField&) for every field available in the structure
+    template <typename Visitor>
+    void for_each_field(Visitor&& visitor) const
+    {
+        decode_structure(*schema_, header_, version_, std::forward<Visitor>(visitor));
+    }
+
+private:
+
+    /// copy of entry header
+    DMIHeader header_;
+
+    /// Table version, defines available fields
+    SMBiosVersion version_;
+
+    /// Static descriptor of the structure type
+    const StructureSchema* schema_ = nullptr;
+};
+
+} // namespace smbios
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <boost/range/iterator_range.hpp>
+#include <smbios/smbios.h>
+
+// Handle reference graph
+// Structures reference each other by handle: Memory Device (17) refers to
+// Physical Memory Array (16), Memory Device Mapped Address (20) refers to 17 and 19,
+// Processor (4) refers to its Caches (7) etc. All handle fields known to the schema
+// are resolved once into header indices and stored in compressed adjacency arrays,
+// so topology queries are array walks without any search
+
+namespace smbios {
+
+/// @brief Header indices adjacent to one structure
+using HandleGraphRange = boost::iterator_range<const uint32_t*>;
+
+/// @brief Immutable graph, vertices are header indices in table order
+class HandleGraph {
+public:
+
+    /// Index value for missing handle
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Resolve handle fields of all structures
+    /// Special handles (FFFEh, FFFFh) and handles of absent structures are skipped
+    HandleGraph(const std::vector<DMIHeader>& headers, const SMBiosVersion& version);
+
+    /// @brief Header index of the structure with the handle, npos if there is no one
+    size_t find_index(uint16_t handle) const;
+
+    /// @brief Structures this one refers to (e.g. array of a memory device, caches of a processor)
+    HandleGraphRange get_references(size_t header_index) const;
+
+    /// @brief Structures which refer to this one (e.g. memory devices of an array)
+    HandleGraphRange get_referrers(size_t header_index) const;
+
+    /// @brief Vertices count, the same as headers count
+    size_t get_vertices_count() const;
+
+    /// @brief Resolved references count
+    size_t get_edges_count() const;
+
+private:
+
+    /// @brief Compressed sparse rows: edges of vertex i are [offsets[i], offsets[i + 1])
+    struct Adjacency {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> edges;
+
+        /// Build from (vertex, adjacent vertex) pairs
+        void assign(size_t vertices_count, const std::vector<std::pair<uint32_t, uint32_t>>& pairs);
+
+        HandleGraphRange range(size_t vertex) const;
+    };
+
+private:
+
+    /// (handle, header index) sorted by handle
+    std::vector<std::pair<uint16_t, uint32_t>> handles_;
+
+    /// Outgoing references
+    Adjacency references_;
+
+    /// Incoming references
+    Adjacency referrers_;
+};
+
+} // namespace smbios
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+
+// IPMI Device Information entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'IPMI Device Information' chapter and IPMI specification, appendix C1
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS IpmiDevice fields and formatted area length by version
+/// Base address modifier and interrupt number are present only if length is 12h
+struct IpmiDeviceLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 3, 0x12 }
+    };
+
+    // Ver 2.3+
+    using InterfaceType = SMBiosField<uint8_t, 0x04, 2, 3>;
+    using SpecificationRevision = SMBiosField<uint8_t, 0x05, 2, 3>;
+    using I2CTargetAddress = SMBiosField<uint8_t, 0x06, 2, 3>;
+    using NVStorageDeviceAddress = SMBiosField<uint8_t, 0x07, 2, 3>;
+    using BaseAddress = SMBiosField<uint64_t, 0x08, 2, 3>;
+    using BaseAddressModifier = SMBiosField<uint8_t, 0x10, 2, 3>;
+    using InterruptNumber = SMBiosField<uint8_t, 0x11, 2, 3>;
+};
+
+/// @brief How to reach the baseboard management controller over IPMI
+class IpmiDeviceEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::IpmiDevice;
+
+    // @brief Interface Type: uint8 - offset 0x04
+    enum InterfaceTypeValue : uint8_t {
+        InterfaceUnknown = 0x00,
+        InterfaceKCS = 0x01,
+        InterfaceSMIC = 0x02,
+        InterfaceBT = 0x03,
+        InterfaceSSIF = 0x04
+    };
+
+    // @brief Bit-mask values for Base Address Modifier: uint8 - offset 0x10
+    enum BaseAddressModifierValue : uint8_t {
+        RegisterSpacingMask = 0xC0,
+        AddressLsb = 0x10,
+        InterruptSpecified = 0x08,
+        InterruptActiveHigh = 0x02,
+        InterruptLevelTriggered = 0x01
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    IpmiDeviceEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    IpmiDeviceEntry(const IpmiDeviceEntry&) = default;
+    IpmiDeviceEntry(IpmiDeviceEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~IpmiDeviceEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x04 offset
+    /// See InterfaceTypeValue enum
+    uint8_t get_interface_type() const;
+
+    /// @brief 0x05 offset, BCD major.minor
+    uint8_t get_specification_major() const;
+    uint8_t get_specification_minor() const;
+
+    /// @brief 0x06 offset
+    uint8_t get_i2c_target_address() const;
+
+    /// @brief 0x07 offset
+    /// FFh if there is no storage device
+    uint8_t get_nv_storage_device_address() const;
+
+    /// @brief 0x08 and 0x10 offsets
+    /// Register base address with the least significant bit from the modifier;
+    /// SMBus target address for SSIF
+    uint64_t get_base_address() const;
+
+    /// @brief Base address is in I/O space, otherwise memory-mapped
+    bool is_io_space() const;
+
+    /// @brief 0x10 offset, bits 7:6
+    /// Distance between registers in bytes: 1, 4 or 16; 0 if reserved
+    uint8_t get_register_spacing() const;
+
+    /// @brief 0x11 offset
+    /// Interrupt number, 0 if not specified
+    uint8_t get_interrupt_number() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values
+
+    /// @brief Interface type name, EXAMPLE : 'KCS'
+    std::string get_interface_type_string() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include <smbios/render_buffer.h>
+
+// Streaming JSON writer
+// Values are appended to RenderBuffer as soon as they are written, there is no DOM.
+// The writer only tracks whether a separator is needed on each nesting level,
+// so it has fixed size and never allocates by itself
+
+namespace smbios {
+
+/// @brief Append quoted JSON string, control symbols, quote and backslash are escaped
+/// Well-formed UTF-8 sequences are copied as is, other bytes 80h and above are
+/// escaped as \u00XX, i.e. read as Latin-1, so that the output is always valid JSON
+void append_json_string(RenderBuffer& out, boost::string_view text);
+
+/// @brief Compact JSON output into the buffer
+/// Caller is responsible for the document structure: key() only inside objects etc.
+class JsonWriter {
+public:
+
+    /// Deeper nesting is not checked
+    static constexpr size_t max_depth = 64;
+
+    explicit JsonWriter(RenderBuffer& out);
+
+    JsonWriter& begin_object();
+    JsonWriter& end_object();
+    JsonWriter& begin_array();
+    JsonWriter& end_array();
+
+    /// @brief Key known at compile time, written without escaping
+    template <size_t N>
+    JsonWriter& key(const char (&name)[N])
+    {
+        separate();
+        out_ << '"';
+        out_.append(name, N - 1);
+        out_.append("\":", 2);
+        after_key_ = true;
+        return *this;
+    }
+
+    /// @brief Key from data (schema names etc.), escaped
+    JsonWriter& key(boost::string_view name);
+
+    JsonWriter& string(boost::string_view text);
+    JsonWriter& number(uint64_t value);
+    JsonWriter& boolean(bool value);
+    JsonWriter& null();
+
+    /// @brief Raw bytes as a string of hex digit pairs, e.g. "0a1b"
+    JsonWriter& hex_bytes(const uint8_t* bytes, size_t size);
+
+    /// @brief Underlying buffer
+    RenderBuffer& buffer() { return out_; }
+
+private:
+
+    /// Comma before all elements but the first one on the level
+    void separate();
+
+    void open(char bracket);
+    void close(char bracket);
+
+private:
+
+    RenderBuffer& out_;
+
+    /// Bit per nesting level: the level already has an element
+    uint64_t has_elements_ = 0;
+    size_t depth_ = 0;
+
+    /// Value follows the key, no separator
+    bool after_key_ = false;
+};
+
+} // namespace smbios
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <smbios/smbios.h>
+#include <smbios/management_host_interface_entry.h>
+
+// Management controller discovery
+// IPMI Device Information (type 38) tells which system interface (KCS, SMIC, BT, SSIF)
+// and which registers the BMC uses; Management Controller Host Interface (type 42)
+// describes the Redfish network host interface. Agents use the summary to open
+// the right interface directly instead of probing all of them
+
+namespace smbios {
+
+/// @brief IPMI system interface of the BMC
+struct IpmiInterface {
+    uint16_t handle;
+
+    /// See IpmiDeviceEntry::InterfaceTypeValue
+    uint8_t interface_type;
+    uint8_t specification_major;
+    uint8_t specification_minor;
+    uint8_t i2c_target_address;
+
+    /// I/O port or memory address, SMBus target address for SSIF
+    uint64_t base_address;
+    bool io_space;
+
+    /// Distance between registers in bytes
+    uint8_t register_spacing;
+
+    /// 0 if interrupts are not used
+    uint8_t interrupt_number;
+};
+
+/// @brief Host interface of the management controller
+struct HostInterface {
+    uint16_t handle;
+
+    /// See ManagementHostInterfaceEntry::InterfaceTypeValue and NetworkDeviceTypeValue
+    uint8_t interface_type;
+    uint8_t network_device_type;
+
+    /// Redfish over IP protocol records, in structure order
+    std::vector<RedfishOverIpRecord> redfish_services;
+};
+
+/// @brief All management interfaces described by the table, in table order
+struct ManagementControllers {
+    std::vector<IpmiInterface> ipmi_interfaces;
+    std::vector<HostInterface> host_interfaces;
+};
+
+/// @brief Decode types 38 and 42 in one walk
+ManagementControllers find_management_controllers(const std::vector<DMIHeader>& headers,
+    const SMBiosVersion& version);
+
+} // namespace smbios
@@ -0,0 +1,153 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+
+// Management Controller Host Interface entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'Management Controller Host Interface' chapter and DMTF DSP0270 (Redfish Host Interface)
+// Interface data and protocol records are variable-length, parsed on request
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS ManagementHostInterface fixed fields and formatted area length by version
+/// Protocol records follow the interface specific data since 3.0
+struct ManagementHostInterfaceLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 7, 0x06 }
+    };
+
+    // Ver 2.7+
+    using InterfaceType = SMBiosField<uint8_t, 0x04, 2, 7>;
+    using InterfaceDataLength = SMBiosField<uint8_t, 0x05, 2, 7>;
+};
+
+/// @brief One protocol record, data points into the table
+struct HostInterfaceProtocolRecord {
+    uint8_t protocol_type;
+    uint8_t length;
+    const uint8_t* data;
+};
+
+/// @brief Redfish over IP protocol record data (protocol type 04h), DSP0270
+struct RedfishOverIpRecord {
+    /// Service UUID in RFC 4122 byte order
+    uint8_t service_uuid[16];
+
+    /// Unknown, static, DHCP, AutoConfigure, HostSelected
+    uint8_t host_ip_assignment_type;
+    uint8_t host_ip_address_format;
+    uint8_t host_ip_address[16];
+    uint8_t host_ip_mask[16];
+
+    uint8_t service_ip_discovery_type;
+    uint8_t service_ip_address_format;
+    uint8_t service_ip_address[16];
+    uint8_t service_ip_mask[16];
+    uint16_t service_ip_port;
+    uint32_t service_vlan_id;
+    std::string service_hostname;
+};
+
+/// @brief Decode Redfish over IP record, false if the record is of another type or truncated
+bool decode_redfish_over_ip(const HostInterfaceProtocolRecord& record, RedfishOverIpRecord& redfish);
+
+/// @brief Text form of IPv4 (format 1) or IPv6 (format 2) address, empty for unknown format
+std::string format_ip_address(uint8_t address_format, const uint8_t (&address)[16]);
+
+/// @brief Append the same text as format_ip_address() to the buffer
+void append_ip_address(RenderBuffer& text, uint8_t address_format, const uint8_t (&address)[16]);
+
+/// @brief Interface between the host and the management controller (BMC):
+/// KCS, UART or network interface for Redfish
+class ManagementHostInterfaceEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::ManagementHostInterface;
+
+    // @brief Interface Type: uint8 - offset 0x04
+    enum InterfaceTypeValue : uint8_t {
+        InterfaceKCS = 0x02,
+        InterfaceUart8250 = 0x03,
+        InterfaceUart16450 = 0x04,
+        InterfaceUart16550 = 0x05,
+        InterfaceUart16650 = 0x06,
+        InterfaceUart16750 = 0x07,
+        InterfaceUart16850 = 0x08,
+        InterfaceNetwork = 0x40,
+        InterfaceOem = 0xF0
+    };
+
+    // @brief Network Host Interface device type, the first byte of the interface data
+    enum NetworkDeviceTypeValue : uint8_t {
+        DeviceUsbNetwork = 0x02,
+        DevicePciNetwork = 0x03,
+        DeviceUsbNetworkV2 = 0x04,
+        DevicePciNetworkV2 = 0x05
+    };
+
+    // @brief Protocol Type of protocol records
+    enum ProtocolTypeValue : uint8_t {
+        ProtocolIpmi = 0x02,
+        ProtocolMctp = 0x03,
+        ProtocolRedfishOverIp = 0x04,
+        ProtocolOem = 0xF0
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    ManagementHostInterfaceEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    ManagementHostInterfaceEntry(const ManagementHostInterfaceEntry&) = default;
+    ManagementHostInterfaceEntry(ManagementHostInterfaceEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~ManagementHostInterfaceEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x04 offset
+    /// See InterfaceTypeValue enum
+    uint8_t get_interface_type() const;
+
+    /// @brief 0x05 offset
+    uint8_t get_interface_data_length() const;
+
+    /// @brief 0x06 offset
+    /// Interface type specific data, nullptr if it does not fit into the structure
+    const uint8_t* get_interface_data() const;
+
+    /// @brief See NetworkDeviceTypeValue enum, 0 for non-network interfaces
+    uint8_t get_network_device_type() const;
+
+    /// @brief Protocol records following the interface data, empty before 3.0
+    /// Truncated records are skipped
+    std::vector<HostInterfaceProtocolRecord> get_protocol_records() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+
+    /// Formatted area length, variable part should fit into it
+    uint8_t length_ = 0;
+
+    /// Protocol records are defined since 3.0
+    bool protocol_records_ = false;
+};
+
+} // namespace smbios
@@ -0,0 +1,140 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <smbios/memory_array_mapped_address_entry.h>
+#include <smbios/memory_device_mapped_address_entry.h>
+#include <smbios/memory_device_entry.h>
+
+// Physical address to memory device lookup
+// Built once from Memory Array Mapped Address (type 19),
+// Memory Device Mapped Address (type 20) and Memory Device (type 17) structures,
+// then every address (e.g. from machine-check event) is resolved in logarithmic time
+
+namespace smbios {
+
+class SMBios;
+
+/// @brief Sorted set of inclusive address ranges with attached values
+/// Ranges may overlap (interleaved devices share the range), the containing range
+/// with the greatest beginning is returned, so the nested range wins.
+/// Ends of the sorted ranges are kept in a max tree, so the lookup is O(log n)
+/// however wide the overlapping ranges are
+template <typename Value>
+class AddressIntervals {
+public:
+
+    /// @brief Add the range, call build() after all ranges are added
+    void add(const MappedAddressRange& range, Value value)
+    {
+        if (!range.empty()) {
+            intervals_.push_back(Interval{ range, value });
+        }
+    }
+
+    /// @brief Sort ranges and prepare lookup data
+    void build()
+    {
+        std::stable_sort(intervals_.begin(), intervals_.end(),
+            [](const Interval& lhs, const Interval& rhs) { return lhs.range.begin < rhs.range.begin; });
+
+        begins_.clear();
+        begins_.reserve(intervals_.size());
+        for (const Interval& interval : intervals_) {
+            begins_.push_back(interval.range.begin);
+        }
+
+        // leaves are the range ends, padding leaves are never reached by find()
+        leaves_ = 1;
+        while (leaves_ < intervals_.size()) {
+            leaves_ *= 2;
+        }
+        max_ends_.assign(2 * leaves_, 0);
+        for (size_t i = 0; i < intervals_.size(); ++i) {
+            max_ends_[leaves_ + i] = intervals_[i].range.end;
+        }
+        for (size_t node = leaves_ - 1; node > 0; --node) {
+            max_ends_[node] = std::max(max_ends_[2 * node], max_ends_[2 * node + 1]);
+        }
+    }
+
+    /// @brief Value of the range containing the address, default value if there is no one
+    Value find(uint64_t address, Value not_found = Value()) const
+    {
+        // ranges which begin not after the address, the last of them reaching the address wins
+        const size_t count = std::upper_bound(begins_.begin(), begins_.end(), address) - begins_.begin();
+        if (count > 0 && intervals_[count - 1].range.end >= address) {
+            // usual case of ranges which do not overlap
+            return intervals_[count - 1].value;
+        }
+        const size_t index = find_last(1, 0, leaves_, count, address);
+        return index < count ? intervals_[index].value : not_found;
+    }
+
+    /// @brief Ranges count
+    size_t size() const
+    {
+        return intervals_.size();
+    }
+
+private:
+
+    /// Last range of the node subtree before the limit which ends not before the address, limit if none
+    /// Subtrees entirely before the limit are either skipped by their maximum or descended to the answer,
+    /// so only the path to the limit is split
+    size_t find_last(size_t node, size_t first, size_t width, size_t limit, uint64_t address) const
+    {
+        if (first >= limit || max_ends_[node] < address) {
+            return limit;
+        }
+        if (1 == width) {
+            return first;
+        }
+        const size_t half = width / 2;
+        const size_t right = find_last(2 * node + 1, first + half, half, limit, address);
+        return right != limit ? right : find_last(2 * node, first, half, limit, address);
+    }
+
+private:
+
+    struct Interval {
+        MappedAddressRange range;
+        Value value;
+    };
+
+    /// Range beginnings only, dense for the binary search
+    std::vector<uint64_t> begins_;
+    std::vector<Interval> intervals_;
+
+    /// Implicit binary tree, node n has children 2n and 2n + 1, leaf i is at leaves_ + i
+    std::vector<uint64_t> max_ends_;
+    size_t leaves_ = 0;
+};
+
+/// @brief Resolve physical address to the memory device (DIMM) in O(log n)
+/// Entries are owned by SMBios entry cache, SMBios should outlive the index
+class MemoryAddressIndex {
+public:
+
+    /// @brief Decode types 17, 19, 20 and build sorted ranges
+    explicit MemoryAddressIndex(const SMBios& smbios);
+
+    /// @brief Memory device mapped to the address, nullptr if address is not mapped
+    /// Locator strings are available with get_device_locator_string(), get_bank_locator_string()
+    const MemoryDeviceEntry* find_device(uint64_t address) const;
+
+    /// @brief Memory array mapped range containing the address, nullptr if address is not mapped
+    const MemoryArrayMappedAddressEntry* find_array_range(uint64_t address) const;
+
+    /// @brief Device ranges count
+    size_t get_device_ranges_count() const;
+
+    /// @brief Array ranges count
+    size_t get_array_ranges_count() const;
+
+private:
+    AddressIntervals<const MemoryDeviceEntry*> devices_;
+    AddressIntervals<const MemoryArrayMappedAddressEntry*> arrays_;
+};
+
+} // namespace smbios
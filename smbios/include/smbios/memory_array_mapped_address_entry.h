@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+
+// Memory Array Mapped Address entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'Memory Array Mapped Address' chapter
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief Physical address range in bytes, both bounds are inclusive
+struct MappedAddressRange {
+    uint64_t begin;
+    uint64_t end;
+
+    /// @brief Address belongs to the range
+    bool contains(uint64_t address) const
+    {
+        return begin <= address && address <= end;
+    }
+
+    /// @brief Nothing is mapped, the end is before the beginning
+    bool empty() const
+    {
+        return end < begin;
+    }
+};
+
+/// @brief Resolve 32-bit (in kilobytes) or 64-bit extended (in bytes) address range
+/// Extended addresses are used when the starting address is FFFFFFFFh,
+/// the range is empty if the structure is too old or short to have them
+MappedAddressRange resolve_mapped_range(uint32_t starting_kb, uint32_t ending_kb,
+    bool extended_present, uint64_t extended_starting, uint64_t extended_ending);
+
+/// @brief SMBIOS MemoryArrayMappedAddress fields and formatted area length by version
+struct MemoryArrayMappedAddressLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 1, 0x0F },
+        { 2, 7, 0x1F }
+    };
+
+    // Ver 2.1+
+    using StartingAddress = SMBiosField<uint32_t, 0x04, 2, 1>;
+    using EndingAddress = SMBiosField<uint32_t, 0x08, 2, 1>;
+    using ArrayHandle = SMBiosField<uint16_t, 0x0C, 2, 1>;
+    using PartitionWidth = SMBiosField<uint8_t, 0x0E, 2, 1>;
+
+    // Ver 2.7+
+    using ExtendedStartingAddress = SMBiosField<uint64_t, 0x0F, 2, 7>;
+    using ExtendedEndingAddress = SMBiosField<uint64_t, 0x17, 2, 7>;
+};
+
+/// @brief Address mapping for a Physical Memory Array
+/// One structure is present for each contiguous address range described
+class MemoryArrayMappedAddressEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::MemoryArrayMappedAddress;
+
+    /// @brief Parse the header, recognize how much information do we have
+    MemoryArrayMappedAddressEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    MemoryArrayMappedAddressEntry(const MemoryArrayMappedAddressEntry&) = default;
+    MemoryArrayMappedAddressEntry(MemoryArrayMappedAddressEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~MemoryArrayMappedAddressEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Raw values
+
+    /// @brief 0x04 offset
+    /// Physical address, in kilobytes, of a range of memory
+    /// FFFFFFFFh means the address is in Extended Starting Address field
+    uint32_t get_starting_address_kb() const;
+
+    /// @brief 0x08 offset
+    /// Physical ending address of the last kilobyte of the range
+    uint32_t get_ending_address_kb() const;
+
+    /// @brief 0x0C offset
+    /// Handle of the Physical Memory Array (type 16) this range is mapped to
+    uint16_t get_array_handle() const;
+
+    /// @brief 0x0E offset
+    /// Number of Memory Devices that form a single row of memory
+    uint8_t get_partition_width() const;
+
+    /// @brief 0x0F offset
+    /// Physical address, in bytes, of a range of memory
+    uint64_t get_extended_starting_address() const;
+
+    /// @brief 0x17 offset
+    /// Physical ending address, in bytes, of the last of the range
+    uint64_t get_extended_ending_address() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Resolved values
+
+    /// @brief Range in bytes, extended addresses are taken into account
+    MappedAddressRange get_address_range() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
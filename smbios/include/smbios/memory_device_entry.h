@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <map>
 #include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
 
 // Memory device entry
 // See http://www.dmtf.org/standards/smbios
@@ -14,59 +15,61 @@ namespace smbios {
 struct DMIHeader;
 struct SMBiosVersion;
 
-// should be aligned to be mapped to physical memory
-#pragma pack(push, 1)
-
-/// @brief SMBIOS MemoryDevice entry Ver 2.1+
-struct MemoryDeviceV21 {
-    uint32_t header;
-    uint16_t array_handle;
-    uint16_t array_error_handle;
-    uint16_t total_width;
-    uint16_t data_width;
-    uint16_t device_size;
-    uint8_t device_form_factor;
-    uint8_t device_set;
-    uint8_t device_locator;
-    uint8_t bank_locator;
-    uint8_t device_type;
-    uint16_t type_detail;
-};
-
-/// @brief SMBIOS MemoryDevice entry Ver 2.3+
-struct MemoryDeviceV23 : public MemoryDeviceV21 {
-    uint16_t device_speed;
-    uint8_t manufacturer;
-    uint8_t serial_number;
-    uint8_t asset_tag;
-    uint8_t part_number;
-};
-
-/// @brief SMBIOS MemoryDevice entry Ver 2.6+
-struct MemoryDeviceV26 : public MemoryDeviceV23 {
-    uint8_t device_rank;
-};
-
-/// @brief SMBIOS MemoryDevice entry Ver 2.7+
-struct MemoryDeviceV27 : public MemoryDeviceV26 {
-    
-    uint32_t extended_size;
-    uint16_t memory_clock_speed;
-};
+/// @brief SMBIOS MemoryDevice fields and formatted area length by version
+struct MemoryDeviceLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 1, 0x15 },
+        { 2, 3, 0x1B },
+        { 2, 6, 0x1C },
+        { 2, 7, 0x22 },
+        { 2, 8, 0x28 }
+    };
 
-/// @brief SMBIOS MemoryDevice entry Ver 2.8+
-struct MemoryDeviceV28 : public MemoryDeviceV27 {
-    uint16_t minimum_voltage;
-    uint16_t maximum_voltage;
-    uint16_t configured_voltage;
+    // Ver 2.1+
+    using ArrayHandle = SMBiosField<uint16_t, 0x04, 2, 1>;
+    using ErrorHandle = SMBiosField<uint16_t, 0x06, 2, 1>;
+    using TotalWidth = SMBiosField<uint16_t, 0x08, 2, 1>;
+    using DataWidth = SMBiosField<uint16_t, 0x0A, 2, 1>;
+    using DeviceSize = SMBiosField<uint16_t, 0x0C, 2, 1>;
+    using FormFactor = SMBiosField<uint8_t, 0x0E, 2, 1>;
+    using DeviceSet = SMBiosField<uint8_t, 0x0F, 2, 1>;
+    using DeviceLocator = SMBiosField<uint8_t, 0x10, 2, 1>;
+    using BankLocator = SMBiosField<uint8_t, 0x11, 2, 1>;
+    using DeviceType = SMBiosField<uint8_t, 0x12, 2, 1>;
+    using TypeDetail = SMBiosField<uint16_t, 0x13, 2, 1>;
+
+    // Ver 2.3+
+    using DeviceSpeed = SMBiosField<uint16_t, 0x15, 2, 3>;
+    using Manufacturer = SMBiosField<uint8_t, 0x17, 2, 3>;
+    using SerialNumber = SMBiosField<uint8_t, 0x18, 2, 3>;
+    using AssetTag = SMBiosField<uint8_t, 0x19, 2, 3>;
+    using PartNumber = SMBiosField<uint8_t, 0x1A, 2, 3>;
+
+    // Ver 2.6+
+    using DeviceRank = SMBiosField<uint8_t, 0x1B, 2, 6>;
+
+    // Ver 2.7+
+    using ExtendedSize = SMBiosField<uint32_t, 0x1C, 2, 7>;
+    using MemoryClockSpeed = SMBiosField<uint16_t, 0x20, 2, 7>;
+
+    // Ver 2.8+
+    using MinimumVoltage = SMBiosField<uint16_t, 0x22, 2, 8>;
+    using MaximumVoltage = SMBiosField<uint16_t, 0x24, 2, 8>;
+    using ConfiguredVoltage = SMBiosField<uint16_t, 0x26, 2, 8>;
 };
 
-#pragma pack(pop)
+/// @brief Device size in bytes from Size (0x0C) and Extended Size (0x1C) fields
+/// Size bit 15 selects kilobyte granularity, 7FFFh means the size in megabytes is in Extended Size
+/// Return 0 for not installed devices and unknown size
+uint64_t memory_device_size_bytes(uint16_t device_size, uint32_t extended_size);
 
 /// @brief Class-wrapper under raw memory structures
-class MemoryDeviceEntry : public AbstractSMBiosEntry {
+class MemoryDeviceEntry final : public AbstractSMBiosEntry {
 public:
 
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::MemoryDevice;
+
     // @brief special values for ErrorHandle: uint16 - offset 0x06
     enum ErrorHandleValue : uint16_t {
         ErrorHandleNotProvided = 0xFFFE,
@@ -180,14 +183,18 @@ public:
     /// do we have in MemoryDevice SMBIOS entry
     MemoryDeviceEntry(const DMIHeader& header, const SMBiosVersion& version);
 
+    /// @brief Value semantic, no heap allocation for the entry itself
+    MemoryDeviceEntry(const MemoryDeviceEntry&) = default;
+    MemoryDeviceEntry(MemoryDeviceEntry&&) = default;
+
     // @brief Parent is abstract
     virtual ~MemoryDeviceEntry() = default;
 
     /// @brief String representation
     virtual std::string get_type() const override;
 
-    /// @brief Render all entry information into single string
-    virtual std::string render_to_description() const override;
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
 
     //////////////////////////////////////////////////////////////////////////
     // Bitwise values
@@ -277,6 +284,14 @@ public:
     /// Bits 7-4: reserved; Bits 3 - 0: rank; Value = 0 for unknown rank
     uint8_t get_device_rank() const;
 
+    /// @brief 0x1C offset
+    /// Size in MB, valid when device size is 0x7FFF
+    uint32_t get_extended_size() const;
+
+    /// @brief Size in bytes, extended size and granularity are taken into account
+    /// 0 if no module installed or size is unknown
+    uint64_t get_device_size_bytes() const;
+
     //////////////////////////////////////////////////////////////////////////
     // String values
 
@@ -311,6 +326,12 @@ public:
     /// EXAMPLE: 'Bank 0' or 'A'
     std::string get_bank_locator_string() const;
 
+    /// The same as get_device_locator_string(), but no copy, view into the table
+    boost::string_view get_device_locator_view() const;
+
+    /// The same as get_bank_locator_string(), but no copy, view into the table
+    boost::string_view get_bank_locator_view() const;
+
     /// DeviceType string representation
     std::string get_device_type_string() const;
 
@@ -337,27 +358,28 @@ public:
 
 private:
 
+    /// Bitwise to string representation, the same for every entry
+    struct StringValues {
+        std::map<uint16_t, std::string> error_handle_map;
+        std::map<uint16_t, std::string> data_width_map;
+        std::map<uint16_t, std::string> device_size_map;
+        std::map<uint8_t, std::string> form_factor_map;
+        std::map<uint8_t, std::string> device_set_map;
+        std::map<uint8_t, std::string> device_type_map;
+        std::map<uint16_t, std::string> device_properties_map;
+        std::map<uint16_t, std::string> device_speed_map;
+    };
+
+    /// Maps are filled once, on the first use
+    static const StringValues& string_values();
+
     /// Map flags data to string values
-    void init_string_values();
+    static void init_string_values(StringValues& values);
 
 private:
 
-    /// Init pointers depend on SMBIOS version
-    const MemoryDeviceV21* memory_device_v21_ = nullptr;
-    const MemoryDeviceV23* memory_device_v23_ = nullptr;
-    const MemoryDeviceV26* memory_device_v26_ = nullptr;
-    const MemoryDeviceV27* memory_device_v27_ = nullptr;
-    const MemoryDeviceV28* memory_device_v28_ = nullptr;
-
-    /// Bitwise to string representation
-    std::map<uint16_t, std::string> error_handle_map_;
-    std::map<uint16_t, std::string> data_width_map_;
-    std::map<uint16_t, std::string> device_size_map_;
-    std::map<uint8_t, std::string> form_factor_map_;
-    std::map<uint8_t, std::string> device_set_map_;
-    std::map<uint8_t, std::string> device_type_map_;
-    std::map<uint16_t, std::string> device_properties_map_;
-    std::map<uint16_t, std::string> device_speed_map_;
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
 };
 
 } // namespace smbios
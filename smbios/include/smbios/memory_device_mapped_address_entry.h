@@ -0,0 +1,119 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+#include <smbios/memory_array_mapped_address_entry.h>
+
+// Memory Device Mapped Address entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'Memory Device Mapped Address' chapter
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS MemoryDeviceMappedAddress fields and formatted area length by version
+struct MemoryDeviceMappedAddressLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 1, 0x13 },
+        { 2, 7, 0x23 }
+    };
+
+    // Ver 2.1+
+    using StartingAddress = SMBiosField<uint32_t, 0x04, 2, 1>;
+    using EndingAddress = SMBiosField<uint32_t, 0x08, 2, 1>;
+    using DeviceHandle = SMBiosField<uint16_t, 0x0C, 2, 1>;
+    using ArrayMappedAddressHandle = SMBiosField<uint16_t, 0x0E, 2, 1>;
+    using PartitionRowPosition = SMBiosField<uint8_t, 0x10, 2, 1>;
+    using InterleavePosition = SMBiosField<uint8_t, 0x11, 2, 1>;
+    using InterleavedDataDepth = SMBiosField<uint8_t, 0x12, 2, 1>;
+
+    // Ver 2.7+
+    using ExtendedStartingAddress = SMBiosField<uint64_t, 0x13, 2, 7>;
+    using ExtendedEndingAddress = SMBiosField<uint64_t, 0x1B, 2, 7>;
+};
+
+/// @brief Maps a Memory Device (type 17) to the physical address range
+class MemoryDeviceMappedAddressEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::MemoryDeviceMappedAddress;
+
+    // @brief special values for PartitionRowPosition, InterleavePosition and InterleavedDataDepth
+    enum PositionValue : uint8_t {
+        PositionNonInterleaved = 0x00,
+        PositionUnknown = 0xFF
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    MemoryDeviceMappedAddressEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    MemoryDeviceMappedAddressEntry(const MemoryDeviceMappedAddressEntry&) = default;
+    MemoryDeviceMappedAddressEntry(MemoryDeviceMappedAddressEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~MemoryDeviceMappedAddressEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Raw values
+
+    /// @brief 0x04 offset
+    /// Physical address, in kilobytes, of a range of memory
+    /// FFFFFFFFh means the address is in Extended Starting Address field
+    uint32_t get_starting_address_kb() const;
+
+    /// @brief 0x08 offset
+    /// Physical ending address of the last kilobyte of the range
+    uint32_t get_ending_address_kb() const;
+
+    /// @brief 0x0C offset
+    /// Handle of the Memory Device (type 17) this range is mapped to
+    uint16_t get_device_handle() const;
+
+    /// @brief 0x0E offset
+    /// Handle of the Memory Array Mapped Address (type 19) this range belongs to
+    uint16_t get_array_mapped_address_handle() const;
+
+    /// @brief 0x10 offset
+    /// Position of the device in a row of the address partition
+    uint8_t get_partition_row_position() const;
+
+    /// @brief 0x11 offset
+    /// Position of the device in an interleave, see PositionValue enum for special values
+    uint8_t get_interleave_position() const;
+
+    /// @brief 0x12 offset
+    /// Maximum number of consecutive rows from the device accessed in a single interleaved transfer
+    uint8_t get_interleaved_data_depth() const;
+
+    /// @brief 0x13 offset
+    /// Physical address, in bytes, of a range of memory
+    uint64_t get_extended_starting_address() const;
+
+    /// @brief 0x1B offset
+    /// Physical ending address, in bytes, of the last of the range
+    uint64_t get_extended_ending_address() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Resolved values
+
+    /// @brief Range in bytes, extended addresses are taken into account
+    MappedAddressRange get_address_range() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <smbios/smbios_structure_view.h>
+#include <smbios/memory_device_entry.h>
+
+// Memory Device typed view
+// Same numeric getters as MemoryDeviceEntry, strings are returned without copy
+// See MemoryDeviceEntry for field descriptions and special values
+
+namespace smbios {
+
+/// @brief Trivially copyable view under Memory Device structure (type 17)
+class MemoryDeviceView : public SMBiosStructureView {
+public:
+
+    /// Structure type this view could be applied to
+    static constexpr uint8_t structure_type = SMBios::MemoryDevice;
+
+    /// @brief Empty view
+    MemoryDeviceView() = default;
+
+    /// @brief Point to the Memory Device structure
+    MemoryDeviceView(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief String representation
+    std::string get_type() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // 2.1+ values
+
+    uint16_t get_array_handle() const;
+    uint16_t get_error_handle() const;
+    uint16_t get_total_width() const;
+    uint16_t get_data_width() const;
+    uint16_t get_device_size() const;
+    uint8_t get_form_factor() const;
+    uint8_t get_device_set() const;
+    uint8_t get_device_locator_index() const;
+    uint8_t get_bank_locator_index() const;
+    uint8_t get_device_type() const;
+    uint16_t get_device_detail() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // 2.3+ values
+
+    uint16_t get_device_speed() const;
+    uint8_t get_manufacturer_index() const;
+    uint8_t get_serial_number_index() const;
+    uint8_t get_asset_tag_index() const;
+    uint8_t get_part_number_index() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // 2.6+ values
+
+    uint8_t get_device_rank() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // 2.7+ values
+
+    /// @brief Size in MB, valid when device size is 0x7FFF
+    uint32_t get_extended_size() const;
+
+    /// @brief Size in bytes, extended size and granularity are taken into account
+    /// 0 if no module installed or size is unknown
+    uint64_t get_device_size_bytes() const;
+
+    /// @brief Configured memory clock speed, MHz
+    uint16_t get_memory_clock_speed() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // 2.8+ values
+
+    /// @brief Voltages in millivolts, 0 if unknown
+    uint16_t get_minimum_voltage() const;
+    uint16_t get_maximum_voltage() const;
+    uint16_t get_configured_voltage() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values, point to the table memory
+
+    boost::string_view get_device_locator_string() const;
+    boost::string_view get_bank_locator_string() const;
+    boost::string_view get_manufacturer_string() const;
+    boost::string_view get_serial_number_string() const;
+    boost::string_view get_asset_tag_string() const;
+    boost::string_view get_part_number_string() const;
+};
+
+} // namespace smbios
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Memory topology summary
+// Installed memory, slots usage per Physical Memory Array (type 16) and
+// the mix of speed, type and rank of Memory Devices (type 17)
+// Computed by one walk over the table with typed views, no strings involved
+
+namespace smbios {
+
+class SMBios;
+
+/// @brief Number of devices with the same property value
+struct MemoryMixItem {
+    uint16_t value;
+    uint16_t count;
+};
+
+/// @brief Single Physical Memory Array
+struct MemoryArraySummary {
+    uint16_t handle;
+
+    /// See PhysicalMemoryArrayView::UseValue
+    uint8_t use;
+    uint8_t error_correction;
+
+    /// Slots declared by the array
+    uint16_t slots;
+    uint16_t populated_slots;
+    uint16_t empty_slots;
+
+    /// Bytes
+    uint64_t maximum_capacity;
+    uint64_t installed_size;
+};
+
+/// @brief Whole host summary
+/// Totals and mixes include system memory only, devices of video, flash etc. arrays
+/// are counted in their own array summary
+struct MemoryTopology {
+
+    /// Bytes of installed system memory
+    uint64_t installed_size = 0;
+    uint16_t populated_slots = 0;
+    uint16_t empty_slots = 0;
+
+    /// Populated devices which do not report their size
+    uint16_t unknown_size_devices = 0;
+
+    /// Arrays in table order
+    std::vector<MemoryArraySummary> arrays;
+
+    /// Populated devices by speed (MT/s, 0 - unknown), type (MemoryDeviceEntry::DeviceTypeValue)
+    /// and rank (0 - unknown), sorted by value
+    std::vector<MemoryMixItem> speed_mix;
+    std::vector<MemoryMixItem> type_mix;
+    std::vector<MemoryMixItem> rank_mix;
+};
+
+/// @brief Walk types 16 and 17 once and summarize them
+MemoryTopology summarize_memory_topology(const SMBios& smbios);
+
+/// @brief Same, reuse topology storage when many tables are processed in a row
+void summarize_memory_topology(const SMBios& smbios, MemoryTopology& topology);
+
+} // namespace smbios
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <boost/functional/hash.hpp>
+#include <boost/optional.hpp>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+
+// OEM metadata index
+// Provisioning systems put key=value pairs into OEM Strings (type 11) and
+// System Configuration Options (type 12). Strings of both types are split
+// at the first '=' once and hashed, keys and values are views into the table
+
+namespace smbios {
+
+/// @brief Immutable hash index of key=value strings
+class OemStringIndex {
+public:
+
+    /// @brief Index strings of all type 11 and 12 structures
+    /// The first occurrence of a key in table order wins,
+    /// strings without '=' are keys with empty value
+    explicit OemStringIndex(const std::vector<DMIHeader>& headers);
+
+    /// @brief Value for the key, none if there is no such key
+    boost::optional<boost::string_view> find(boost::string_view key) const;
+
+    /// @brief Indexed keys count
+    size_t size() const;
+
+private:
+
+    /// Views into the table memory owned by SMBios
+    std::unordered_map<boost::string_view, boost::string_view, boost::hash<boost::string_view>> values_;
+};
+
+} // namespace smbios
@@ -0,0 +1,28 @@
+#pragma once
+#include <smbios/string_list_entry.h>
+
+// OEM Strings entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'OEM Strings' chapter
+// Formatted area is the strings count only, the strings are free-form OEM data, often key=value pairs
+// EXAMPLE : 'role=worker'
+
+namespace smbios {
+
+/// @brief Free-form strings defined by the OEM (part numbers, provisioning metadata etc.)
+class OemStringsEntry final : public StringListEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::OemStrings;
+
+    /// @brief Parse the header, recognize how much information do we have
+    OemStringsEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    OemStringsEntry(const OemStringsEntry&) = default;
+    OemStringsEntry(OemStringsEntry&&) = default;
+};
+
+} // namespace smbios
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+#include <smbios/pci_address.h>
+
+// Onboard Devices Extended Information entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'Onboard Devices Extended Information' chapter
+// Replaces obsolete type 10, one structure per device
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS OnboardDevicesExtended fields and formatted area length by version
+struct OnboardDevicesExtendedLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 6, 0x0B }
+    };
+
+    // Ver 2.6+
+    using ReferenceDesignation = SMBiosField<uint8_t, 0x04, 2, 6>;
+    using DeviceType = SMBiosField<uint8_t, 0x05, 2, 6>;
+    using DeviceTypeInstance = SMBiosField<uint8_t, 0x06, 2, 6>;
+    using SegmentGroupNumber = SMBiosField<uint16_t, 0x07, 2, 6>;
+    using BusNumber = SMBiosField<uint8_t, 0x09, 2, 6>;
+    using DeviceFunctionNumber = SMBiosField<uint8_t, 0x0A, 2, 6>;
+};
+
+/// @brief Device soldered onto the motherboard (NIC, storage controller, video etc.)
+class OnboardDevicesExtendedEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::OnboardDevicesExtended;
+
+    // @brief Device Type: uint8 - offset 0x05
+    enum DeviceTypeValue : uint8_t {
+        DeviceTypeMask = 0x7F,
+        DeviceEnabled = 0x80
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    OnboardDevicesExtendedEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    OnboardDevicesExtendedEntry(const OnboardDevicesExtendedEntry&) = default;
+    OnboardDevicesExtendedEntry(OnboardDevicesExtendedEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~OnboardDevicesExtendedEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x05 offset, bits 6:0
+    /// Video, Ethernet, SATA Controller etc.
+    uint8_t get_device_type() const;
+
+    /// @brief 0x05 offset, bit 7
+    bool is_enabled() const;
+
+    /// @brief 0x06 offset
+    /// Instance number among devices of the same type, 1-based
+    uint8_t get_device_type_instance() const;
+
+    /// @brief 0x07, 0x09 and 0x0A offsets
+    PciAddress get_pci_address() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values
+
+    /// EXAMPLE : 'Onboard LAN 1'
+    std::string get_reference_designation_string() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <smbios/smbios.h>
+#include <smbios/render_buffer.h>
+
+// Parallel ordered rendering
+// Structures are rendered independently, so the header index is split into contiguous
+// chunks which worker threads take in order from a shared counter. Each worker renders
+// into its own buffer and remembers where every chunk landed; the chunks are then
+// appended to the output in table order, so the text is byte-identical to the serial
+// loop regardless of the thread count and scheduling
+
+namespace smbios {
+
+/// @brief Append the text of the structure with the header index to the buffer
+/// Called concurrently for different indexes, it should not touch shared state
+using StructureRenderer = std::function<void(size_t header_index, RenderBuffer& out)>;
+
+/// @brief Structures per chunk: small enough to balance the workers, large enough to amortize the counter
+constexpr size_t default_render_chunk = 64;
+
+/// @brief Render structures [0, count) into the buffer in table order using up to 'threads' threads
+/// 0 threads means the hardware concurrency; small tables and a single thread are rendered serially.
+/// The first exception thrown by render() is rethrown when all workers have stopped,
+/// nothing is appended to the buffer then
+void render_ordered(size_t count, size_t threads, RenderBuffer& out, const StructureRenderer& render,
+    size_t chunk_size = default_render_chunk);
+
+/// @brief Text of every structure as smbios_util prints it: "Header ID = <type>" line,
+/// then the decoded entry followed by an empty line if there is a decoder for the type
+void render_structures(const SMBios& smbios, RenderBuffer& out, size_t threads = 1);
+
+} // namespace smbios
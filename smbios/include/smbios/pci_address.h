@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <boost/utility/string_view.hpp>
+
+// PCI address as used by System Slots (type 9) and Onboard Devices Extended (type 41)
+// Segment group, bus and device/function numbers, the same as Linux 'SSSS:BB:DD.F' names
+
+namespace smbios {
+
+/// @brief PCI segment/bus/device/function
+struct PciAddress {
+    uint16_t segment;
+    uint8_t bus;
+
+    /// Device number in bits 7:3, function number in bits 2:0
+    uint8_t device_function;
+
+    uint8_t get_device() const { return device_function >> 3; }
+    uint8_t get_function() const { return device_function & 0x07; }
+
+    /// @brief Single integer ordered the same way as segment, bus, device, function
+    uint32_t key() const
+    {
+        return (static_cast<uint32_t>(segment) << 16) | (static_cast<uint32_t>(bus) << 8) | device_function;
+    }
+
+    /// @brief Structures use FFh bus and device/function if the device is not on PCI
+    bool is_valid() const { return !(bus == 0xFF && device_function == 0xFF); }
+};
+
+inline bool operator==(const PciAddress& lhs, const PciAddress& rhs) { return lhs.key() == rhs.key(); }
+inline bool operator!=(const PciAddress& lhs, const PciAddress& rhs) { return lhs.key() != rhs.key(); }
+inline bool operator<(const PciAddress& lhs, const PciAddress& rhs) { return lhs.key() < rhs.key(); }
+
+/// @brief Parse 'SSSS:BB:DD.F' or 'BB:DD.F' (segment 0) hex notation
+/// Return false if the text is malformed, no allocation
+bool parse_pci_address(boost::string_view text, PciAddress& address);
+
+/// @brief Format as 'ssss:bb:dd.f', lower-case hex like Linux sysfs names
+std::string format_pci_address(const PciAddress& address);
+
+} // namespace smbios
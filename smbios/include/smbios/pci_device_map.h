@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/pci_address.h>
+
+// PCI device map
+// System Slots (type 9) and Onboard Devices Extended Information (type 41)
+// give the PCI address of slots and onboard devices. Addresses are collected once
+// into an array sorted by segment/bus/device/function, so a device name
+// (slot designation or onboard label) is one binary search away
+
+namespace smbios {
+
+/// @brief Slot or onboard device with known PCI address
+struct PciDeviceRecord {
+    PciAddress address;
+
+    /// SMBios::SystemSlots or SMBios::OnboardDevicesExtended
+    uint8_t structure_type;
+    uint16_t handle;
+
+    /// Slot designation or onboard device reference designation, view into the table
+    boost::string_view label;
+};
+
+/// @brief Immutable sorted lookup table
+class PciDeviceMap {
+public:
+
+    /// @brief Collect slots and onboard devices with valid PCI addresses
+    PciDeviceMap(const std::vector<DMIHeader>& headers, const SMBiosVersion& version);
+
+    /// @brief Record for the exact address; if there is no one,
+    /// the record for function 0 of the same device (structures usually name function 0)
+    /// Return nullptr if the device is not described
+    const PciDeviceRecord* find(const PciAddress& address) const;
+
+    /// @brief All records sorted by address, table order for the same address
+    const std::vector<PciDeviceRecord>& get_records() const;
+
+private:
+
+    /// First record with exactly this key, nullptr if none
+    const PciDeviceRecord* find_exact(uint32_t key) const;
+
+private:
+
+    std::vector<PciDeviceRecord> records_;
+};
+
+} // namespace smbios
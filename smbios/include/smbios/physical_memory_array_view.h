@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <smbios/smbios_structure_view.h>
+#include <smbios/smbios_field.h>
+
+// Physical Memory Array typed view
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version, 'Physical Memory Array' chapter
+
+namespace smbios {
+
+/// @brief SMBIOS PhysicalMemoryArray fields and formatted area length by version
+struct PhysicalMemoryArrayLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 1, 0x0F },
+        { 2, 7, 0x17 }
+    };
+
+    // Ver 2.1+
+    using Location = SMBiosField<uint8_t, 0x04, 2, 1>;
+    using Use = SMBiosField<uint8_t, 0x05, 2, 1>;
+    using ErrorCorrection = SMBiosField<uint8_t, 0x06, 2, 1>;
+    using MaximumCapacity = SMBiosField<uint32_t, 0x07, 2, 1>;
+    using ErrorHandle = SMBiosField<uint16_t, 0x0B, 2, 1>;
+    using NumberOfDevices = SMBiosField<uint16_t, 0x0D, 2, 1>;
+
+    // Ver 2.7+
+    using ExtendedMaximumCapacity = SMBiosField<uint64_t, 0x0F, 2, 7>;
+};
+
+/// @brief Trivially copyable view under Physical Memory Array structure (type 16)
+/// Collection of memory devices which operate together to form a memory address space
+class PhysicalMemoryArrayView : public SMBiosStructureView {
+public:
+
+    /// Structure type this view could be applied to
+    static constexpr uint8_t structure_type = SMBios::PhysicalMemoryArray;
+
+    // @brief Use field: uint8 - offset 0x05
+    enum UseValue : uint8_t {
+        UseOther = 0x01,
+        UseUnknown = 0x02,
+        SystemMemory = 0x03,
+        VideoMemory = 0x04,
+        FlashMemory = 0x05,
+        NonVolatileRAM = 0x06,
+        CacheMemory = 0x07
+    };
+
+    /// @brief Empty view
+    PhysicalMemoryArrayView() = default;
+
+    /// @brief Point to the Physical Memory Array structure
+    PhysicalMemoryArrayView(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief String representation
+    std::string get_type() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    uint8_t get_location() const;
+
+    /// @brief See UseValue enum
+    uint8_t get_use() const;
+    uint8_t get_error_correction() const;
+
+    /// @brief Maximum memory capacity, in kilobytes
+    /// 80000000h means the capacity is in Extended Maximum Capacity field
+    uint32_t get_maximum_capacity() const;
+    uint16_t get_error_handle() const;
+
+    /// @brief Number of slots or sockets available for Memory Devices in this array
+    uint16_t get_number_of_devices() const;
+
+    /// @brief Maximum memory capacity, in bytes
+    uint64_t get_extended_maximum_capacity() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Resolved values
+
+    /// @brief Maximum memory capacity in bytes, extended capacity is taken into account
+    uint64_t get_maximum_capacity_bytes() const;
+};
+
+} // namespace smbios
@@ -32,9 +32,12 @@ struct PortConnection {
 /// (for example, parallel, serial, keyboard, or mouse ports)
 /// The port's type and connector information are provided
 /// One structure is present for each port provided by the system
-class PortConnectionEntry : public AbstractSMBiosEntry {
+class PortConnectionEntry final : public AbstractSMBiosEntry {
 public:
 
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::PortConnection;
+
     // @brief Connector Types field
     enum ConnectorType : uint8_t {
         NoneConnector = 0x00,
@@ -125,14 +128,18 @@ public:
     /// in MemoryDevice SMBIOS entry
     PortConnectionEntry(const DMIHeader& header, const SMBiosVersion& version);
 
+    /// @brief Value semantic, no heap allocation for the entry itself
+    PortConnectionEntry(const PortConnectionEntry&) = default;
+    PortConnectionEntry(PortConnectionEntry&&) = default;
+
     // @brief Parent is abstract
     virtual ~PortConnectionEntry() = default;
 
     /// @brief String representation
     virtual std::string get_type() const override;
 
-    /// @brief Render all entry information into single string
-    virtual std::string render_to_description() const override;
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
 
     //////////////////////////////////////////////////////////////////////////
     // Byte values
@@ -166,17 +173,22 @@ public:
 
 private:
 
+    /// Bitwise to string representation, the same for every entry
+    struct StringValues {
+        std::map<uint8_t, std::string> connection_type_map;
+        std::map<uint8_t, std::string> port_type_map;
+    };
+
+    /// Maps are filled once, on the first use
+    static const StringValues& string_values();
+
     /// Map flags data to string values
-    void init_string_values();
+    static void init_string_values(StringValues& values);
 
 private:
 
     /// Raw structure
-    const PortConnection* port_connection_;
-
-    /// Bitwise to string representation
-    std::map<uint8_t, std::string> connection_type_map_;
-    std::map<uint8_t, std::string> port_type_map_;
+    const PortConnection* port_connection_ = nullptr;
 };
 
 } // namespace smbios
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+
+// Processor Information entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'Processor Information' chapter
+// Entry format changes version to version
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS ProcessorInformation fields and formatted area length by version
+struct ProcessorInformationLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 0, 0x1A },
+        { 2, 1, 0x20 },
+        { 2, 3, 0x23 },
+        { 2, 5, 0x28 },
+        { 2, 6, 0x2A },
+        { 3, 0, 0x30 },
+        { 3, 6, 0x32 }
+    };
+
+    // Ver 2.0+
+    using SocketDesignation = SMBiosField<uint8_t, 0x04, 2, 0>;
+    using ProcessorType = SMBiosField<uint8_t, 0x05, 2, 0>;
+    using ProcessorFamily = SMBiosField<uint8_t, 0x06, 2, 0>;
+    using Manufacturer = SMBiosField<uint8_t, 0x07, 2, 0>;
+    using ProcessorId = SMBiosField<uint64_t, 0x08, 2, 0>;
+    using ProcessorVersion = SMBiosField<uint8_t, 0x10, 2, 0>;
+    using Voltage = SMBiosField<uint8_t, 0x11, 2, 0>;
+    using ExternalClock = SMBiosField<uint16_t, 0x12, 2, 0>;
+    using MaxSpeed = SMBiosField<uint16_t, 0x14, 2, 0>;
+    using CurrentSpeed = SMBiosField<uint16_t, 0x16, 2, 0>;
+    using Status = SMBiosField<uint8_t, 0x18, 2, 0>;
+    using ProcessorUpgrade = SMBiosField<uint8_t, 0x19, 2, 0>;
+
+    // Ver 2.1+
+    using L1CacheHandle = SMBiosField<uint16_t, 0x1A, 2, 1>;
+    using L2CacheHandle = SMBiosField<uint16_t, 0x1C, 2, 1>;
+    using L3CacheHandle = SMBiosField<uint16_t, 0x1E, 2, 1>;
+
+    // Ver 2.3+
+    using SerialNumber = SMBiosField<uint8_t, 0x20, 2, 3>;
+    using AssetTag = SMBiosField<uint8_t, 0x21, 2, 3>;
+    using PartNumber = SMBiosField<uint8_t, 0x22, 2, 3>;
+
+    // Ver 2.5+
+    using CoreCount = SMBiosField<uint8_t, 0x23, 2, 5>;
+    using CoreEnabled = SMBiosField<uint8_t, 0x24, 2, 5>;
+    using ThreadCount = SMBiosField<uint8_t, 0x25, 2, 5>;
+    using Characteristics = SMBiosField<uint16_t, 0x26, 2, 5>;
+
+    // Ver 2.6+
+    using ProcessorFamily2 = SMBiosField<uint16_t, 0x28, 2, 6>;
+
+    // Ver 3.0+
+    using CoreCount2 = SMBiosField<uint16_t, 0x2A, 3, 0>;
+    using CoreEnabled2 = SMBiosField<uint16_t, 0x2C, 3, 0>;
+    using ThreadCount2 = SMBiosField<uint16_t, 0x2E, 3, 0>;
+
+    // Ver 3.6+
+    using ThreadEnabled = SMBiosField<uint16_t, 0x30, 3, 6>;
+};
+
+/// @brief Information about one processor socket
+/// One structure is present for each processor instance (populated or not)
+class ProcessorInformationEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::ProcessorInformation;
+
+    // @brief Bit-mask values for Status: uint8 - offset 0x18
+    enum StatusValue : uint8_t {
+        CpuStatusMask = 0x07,
+        CpuStatusUnknown = 0x00,
+        CpuEnabled = 0x01,
+        CpuDisabledByUser = 0x02,
+        CpuDisabledByBios = 0x03,
+        CpuIdle = 0x04,
+        CpuStatusOther = 0x07,
+        SocketPopulated = 0x40
+    };
+
+    // @brief special values for cache handles, offsets 0x1A, 0x1C, 0x1E
+    enum CacheHandleValue : uint16_t {
+        CacheNotProvided = 0xFFFF
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    ProcessorInformationEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    ProcessorInformationEntry(const ProcessorInformationEntry&) = default;
+    ProcessorInformationEntry(ProcessorInformationEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~ProcessorInformationEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x05 offset
+    /// Central Processor, Math Processor etc.
+    uint8_t get_processor_type() const;
+
+    /// @brief 0x06 offset, or 0x28 offset when 0x06 is FEh
+    uint16_t get_processor_family() const;
+
+    /// @brief 0x08 offset
+    /// Raw processor identification data (CPUID signature and features on x86)
+    uint64_t get_processor_id() const;
+
+    /// @brief 0x11 offset
+    uint8_t get_voltage() const;
+
+    /// @brief 0x12 offset
+    /// External clock frequency, MHz, 0 if unknown
+    uint16_t get_external_clock() const;
+
+    /// @brief 0x14 offset
+    /// Maximum processor speed supported by the system, MHz, 0 if unknown
+    uint16_t get_max_speed() const;
+
+    /// @brief 0x16 offset
+    /// Speed at boot, MHz, 0 if unknown
+    uint16_t get_current_speed() const;
+
+    /// @brief 0x18 offset
+    /// See StatusValue enum
+    uint8_t get_status() const;
+
+    /// @brief Socket has a processor installed
+    bool is_populated() const;
+
+    /// @brief 0x19 offset
+    uint8_t get_processor_upgrade() const;
+
+    /// @brief 0x1A, 0x1C, 0x1E offsets
+    /// Handles of Cache Information structures, see CacheHandleValue enum
+    uint16_t get_l1_cache_handle() const;
+    uint16_t get_l2_cache_handle() const;
+    uint16_t get_l3_cache_handle() const;
+
+    /// @brief 0x23 offset, or 0x2A offset when 0x23 is FFh
+    /// Number of cores per processor socket, 0 if unknown
+    uint16_t get_core_count() const;
+
+    /// @brief 0x24 offset, or 0x2C offset when 0x24 is FFh
+    uint16_t get_core_enabled() const;
+
+    /// @brief 0x25 offset, or 0x2E offset when 0x25 is FFh
+    /// Number of threads per processor socket, 0 if unknown
+    uint16_t get_thread_count() const;
+
+    /// @brief 0x26 offset
+    uint16_t get_characteristics() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values
+
+    /// EXAMPLE : 'CPU0'
+    std::string get_socket_designation_string() const;
+    std::string get_manufacturer_string() const;
+    std::string get_version_string() const;
+    std::string get_serial_number_string() const;
+    std::string get_asset_tag_string() const;
+    std::string get_part_number_string() const;
+
+    /// @brief Processor family name, number if unknown
+    std::string get_processor_family_string() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/smbios_schema.h>
+#include <smbios/render_buffer.h>
+
+// Field projection queries
+// Selection like "type17.size,type17.speed,type17.part_number" is compiled once
+// into per-type lists of schema fields (names are the snake_case column names,
+// see columnar_export.h). Extraction decodes only those fields; the string
+// section is walked once per structure and only if a string field is selected.
+//
+// Text output is a line per structure in logfmt form:
+//   handle=0x0011 type=17 size=8192 speed=2400 part_number="PN 1"
+// fields missing in the structure are omitted. JSON output is an array
+// of objects with handle, type and the selected fields, missing ones are null
+
+namespace smbios {
+
+/// @brief Field of the selection
+struct ProjectedField {
+    uint8_t type;
+    const FieldSchema* field;
+
+    /// Column name as it has been selected
+    std::string name;
+};
+
+/// @brief Extracted value, decoded is valid only if the field is present
+struct ProjectedValue {
+    const ProjectedField* field;
+    bool present;
+    DecodedField decoded;
+};
+
+/// @brief Compiled field selection
+class Projection {
+public:
+
+    /// @brief Parse comma-separated "type<N>.<column>" list
+    /// Throws std::invalid_argument on syntax error, unknown type or field
+    explicit Projection(boost::string_view selection);
+
+    /// @brief Selected fields grouped by type, in selection order within the type
+    const std::vector<ProjectedField>& get_fields() const { return fields_; }
+
+    /// @brief Some field of the type is selected
+    bool selects(uint8_t type) const { return type_begin_[type] != type_begin_[type + 1]; }
+
+    /// @brief Replace values with the selected fields of the structure, in get_fields() order
+    /// Reuse the same vector to avoid any allocation in batch processing
+    void extract(const DMIHeader& header, const SMBiosVersion& version, std::vector<ProjectedValue>& values) const;
+
+    /// @brief Append logfmt line for every structure of the selected types
+    void render_to(const SMBios& smbios, RenderBuffer& out) const;
+
+    /// @brief Append JSON array of objects for every structure of the selected types
+    void render_json(const SMBios& smbios, RenderBuffer& out) const;
+
+private:
+
+    std::vector<ProjectedField> fields_;
+
+    /// Fields of type T are [type_begin_[T], type_begin_[T + 1])
+    uint16_t type_begin_[257];
+
+    /// Type has a selected string field
+    bool has_strings_[256];
+};
+
+} // namespace smbios
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <smbios/smbios.h>
+#include <smbios/render_buffer.h>
+
+// Raw SMBIOS entry
+// Placeholder for any structure which has no dedicated decoder yet:
+// OEM-specific types (128-255) and standard types unknown to the schema
+
+namespace smbios {
+
+/// @brief Lightweight value keeping only the header of undecoded structure
+/// It has the same interface as decoded entries, but no virtual functions
+/// and no string parsing, so it is cheap to create for every header
+class RawSMBiosEntry {
+public:
+
+    /// @brief Accept a copy of the header, version is not needed
+    explicit RawSMBiosEntry(const DMIHeader& header);
+
+    /// @brief String representation
+    std::string get_type() const;
+
+    /// @brief Render header information into single string
+    std::string render_to_description() const;
+
+    /// @brief Append header information to the buffer
+    void render_to(RenderBuffer& out) const;
+
+    /// @brief Entry size without string section
+    size_t get_entry_size() const;
+
+    /// @brief Access to the raw structure
+    const DMIHeader& get_header() const;
+
+private:
+
+    /// copy of entry header
+    DMIHeader header_;
+};
+
+} // namespace smbios
@@ -0,0 +1,105 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+
+// Text rendering sink
+// Entries and tables append their descriptions into caller-provided buffer:
+// no locale, no virtual streambuf calls, integers are formatted by hand.
+// Buffer keeps its capacity after clear(), so the whole table could be rendered
+// reusing single allocation
+
+namespace smbios {
+
+/// @brief Hex formatting request, see hex() and hex_digits()
+struct HexFormat {
+    uint64_t value;
+
+    /// Minimum number of digits, padded with zeroes
+    uint8_t width;
+
+    /// Print '0x' prefix for non-zero values
+    bool base;
+};
+
+/// @brief Same as std::hex << std::showbase: lower-case digits, zero is printed as "0"
+inline HexFormat hex(uint64_t value) { return HexFormat{ value, 1, true }; }
+
+/// @brief Zero-padded lower-case digits without prefix
+inline HexFormat hex_digits(uint64_t value, uint8_t width) { return HexFormat{ value, width, false }; }
+
+/// @brief Growable byte buffer with stream-like interface
+/// Integers are rendered in decimal, as std::ostream does by default
+class RenderBuffer {
+public:
+
+    RenderBuffer() = default;
+
+    /// @brief Preallocate capacity
+    explicit RenderBuffer(size_t capacity);
+
+    /// @brief Drop the content, keep the capacity
+    void clear() { size_ = 0; }
+
+    /// @brief Drop the content after the first 'size' bytes, keep the capacity
+    void truncate(size_t size) { size_ = std::min(size_, size); }
+
+    /// @brief Make sure the next 'size' bytes do not reallocate
+    void reserve(size_t size);
+
+    const char* data() const { return buffer_.data(); }
+    size_t size() const { return size_; }
+    bool empty() const { return 0 == size_; }
+
+    /// @brief Rendered text, valid until the next append
+    boost::string_view view() const { return boost::string_view(buffer_.data(), size_); }
+
+    /// @brief Copy of the rendered text
+    std::string str() const { return std::string(buffer_.data(), size_); }
+
+    void append(const char* text, size_t length)
+    {
+        if (size_ + length > buffer_.size()) {
+            grow(length);
+        }
+        if (length) {
+            std::memcpy(&buffer_[size_], text, length);
+            size_ += length;
+        }
+    }
+
+    void append_decimal(uint64_t value);
+    void append_signed(int64_t value);
+    void append_hex(const HexFormat& format);
+
+    RenderBuffer& operator<<(boost::string_view text) { append(text.data(), text.size()); return *this; }
+    RenderBuffer& operator<<(const std::string& text) { append(text.data(), text.size()); return *this; }
+    RenderBuffer& operator<<(const char* text) { append(text, std::strlen(text)); return *this; }
+    RenderBuffer& operator<<(char symbol) { append(&symbol, 1); return *this; }
+
+    RenderBuffer& operator<<(int value) { append_signed(value); return *this; }
+    RenderBuffer& operator<<(long value) { append_signed(value); return *this; }
+    RenderBuffer& operator<<(long long value) { append_signed(value); return *this; }
+    RenderBuffer& operator<<(unsigned value) { append_decimal(value); return *this; }
+    RenderBuffer& operator<<(unsigned long value) { append_decimal(value); return *this; }
+    RenderBuffer& operator<<(unsigned long long value) { append_decimal(value); return *this; }
+
+    RenderBuffer& operator<<(const HexFormat& format) { append_hex(format); return *this; }
+
+private:
+
+    /// Reallocate at least twice as large
+    void grow(size_t length);
+
+private:
+
+    /// Storage, only first size_ bytes are rendered
+    std::vector<char> buffer_;
+    size_t size_ = 0;
+};
+
+} // namespace smbios
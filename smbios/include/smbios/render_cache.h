@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/render_buffer.h>
+
+// Memoized rendering
+// Fleets repeat the same firmware and DIMM population, so the rendered form of a table
+// is cached by a 128-bit hash of the raw table bytes, SMBIOS version and format options
+// (MurmurHash3 x64 128, not cryptographic: the key identifies content, it does not
+// protect from crafted collisions). The cache is an in-process LRU limited by the total
+// size of the rendered texts, optionally backed by a directory with a file per key.
+// Disk errors are not reported: a broken or missing file is a miss
+
+namespace smbios {
+
+/// @brief 128-bit content hash
+struct RenderKey {
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const RenderKey& other) const { return low == other.low && high == other.high; }
+    bool operator!=(const RenderKey& other) const { return !(*this == other); }
+
+    /// @brief 32 lower-case hex digits, high part first
+    std::string to_string() const;
+};
+
+/// @brief MurmurHash3 x64 128 of the bytes, seed is applied to both halves
+RenderKey hash128(const void* data, size_t size, uint64_t seed = 0);
+
+/// @brief Version of the rendered output, part of every key
+/// Bump it whenever any renderer or output format changes, so that caches written by
+/// older builds are not served after an upgrade
+constexpr uint32_t render_format_version = 1;
+
+/// @brief Key of the rendered table: options (format, type, selection etc.), SMBIOS version
+/// and render format version are hashed first, the result seeds the hash of the table bytes
+RenderKey make_render_key(const uint8_t* table, size_t table_size, const SMBiosVersion& version,
+    boost::string_view options, uint32_t format_version = render_format_version);
+
+/// @brief Thread-safe LRU of rendered tables
+class RenderCache {
+public:
+
+    /// @brief In-memory cache only
+    explicit RenderCache(size_t max_bytes);
+
+    /// @brief Cache backed by the directory, it is created if needed
+    RenderCache(size_t max_bytes, const std::string& directory);
+
+    RenderCache(const RenderCache&) = delete;
+    RenderCache& operator=(const RenderCache&) = delete;
+
+    /// @brief Append cached text to the buffer, false if the key is unknown
+    /// Entries found on disk are loaded into memory
+    bool find(const RenderKey& key, RenderBuffer& out);
+
+    /// @brief Remember rendered text, evicting least recently used entries over the limit
+    /// Text larger than the limit is written to disk only
+    void put(const RenderKey& key, boost::string_view text);
+
+    /// @brief Cached text or render it: render(out) appends to the buffer, the appended part is cached
+    /// Return true on cache hit
+    bool render(const RenderKey& key, RenderBuffer& out, const std::function<void(RenderBuffer&)>& render);
+
+    size_t get_entries_count() const;
+    size_t get_bytes() const;
+    uint64_t get_hits() const;
+    uint64_t get_misses() const;
+
+private:
+
+    struct KeyHash {
+        size_t operator()(const RenderKey& key) const { return static_cast<size_t>(key.low); }
+    };
+
+    struct Entry {
+        RenderKey key;
+        std::string text;
+    };
+
+    /// Make the entry most recently used and evict over the limit, lock is held
+    void insert(const RenderKey& key, std::string text);
+
+    std::string file_path(const RenderKey& key) const;
+    bool load(const RenderKey& key, std::string& text) const;
+    void store(const RenderKey& key, boost::string_view text) const;
+
+private:
+
+    size_t max_bytes_;
+    std::string directory_;
+
+    mutable std::mutex mutex_;
+
+    /// Most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<RenderKey, std::list<Entry>::iterator, KeyHash> index_;
+    size_t bytes_ = 0;
+
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+} // namespace smbios
@@ -1,7 +1,10 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <cstdint>
+#include <boost/optional.hpp>
+#include <boost/utility/string_view.hpp>
 
 // Main SMBIOS table implementation
 
@@ -10,6 +13,15 @@ class PhysicalMemory;
 namespace smbios {
 
 class SMBiosImpl;
+class AbstractSMBiosEntry;
+class SMBiosEntryFactory;
+class HandleGraph;
+struct SystemIdentity;
+class OemStringIndex;
+class PciDeviceMap;
+struct ManagementControllers;
+class RenderBuffer;
+class JsonWriter;
 
 // should be aligned to be mapped to the physical memory
 #pragma pack(push, 1)
@@ -105,20 +117,31 @@ public:
     {
         BIOSInformation = 0,
         SystemInformation = 1,
+        BaseboardInformation = 2,
         SystemEnclosure = 3,
         ProcessorInformation = 4,
         CacheInformation = 7,
         PortConnection = 8,
         SystemSlots = 9,
+        OemStrings = 11,
+        SystemConfigurationOptions = 12,
         PhysicalMemoryArray = 16,
         MemoryDevice = 17,
         MemoryArrayMappedAddress = 19,
+        MemoryDeviceMappedAddress = 20,
         SystemBootInformation = 32,
+        IpmiDevice = 38,
+        OnboardDevicesExtended = 41,
+        ManagementHostInterface = 42,
         EndOfTable = 127
     };
 
     /// @brief Read SMBIOS table using native OS-specific method
     SMBios();
+
+    /// @brief Use already read SMBIOS table (file dump, test data), no system calls
+    /// Table is the structures area only, without entry point
+    SMBios(std::vector<uint8_t> table_dump, const SMBiosVersion& version);
     
     /// @brief Should be exist to satisfy compiler
     ~SMBios();
@@ -138,6 +161,78 @@ public:
     /// Display SMBIOS description
     std::string render_to_description() const;
 
+    /// @brief Append the entry point description to the buffer
+    void render_to(RenderBuffer& out) const;
+
+    /// @brief Write the entry point fields as JSON object, null if there is no valid entry point
+    void render_entry_point_json(JsonWriter& writer) const;
+
+    /// @brief Append typed views (MemoryDeviceView, BiosInformationView etc.)
+    /// for every structure of the view type, in table order
+    /// Reuse the same vector to avoid any allocation in batch processing
+    template <typename View>
+    void view_all(std::vector<View>& views) const
+    {
+        const SMBiosVersion version = get_smbios_version();
+        for (const DMIHeader& header : headers_list_) {
+            if (header.type == View::structure_type) {
+                views.emplace_back(header, version);
+            }
+        }
+    }
+
+    /// @brief Typed views for every structure of the view type, in table order
+    template <typename View>
+    std::vector<View> view_all() const
+    {
+        std::vector<View> views;
+        view_all(views);
+        return views;
+    }
+
+    /// @brief Parsed headers in table order, index is the same as for entry()
+    const std::vector<DMIHeader>& get_headers() const;
+
+    /// @brief Decoded entry for the header with provided index (in table order)
+    /// Each structure is decoded once on first request, then cached; thread-safe
+    /// Return nullptr if there is no decoder for the structure type
+    const AbstractSMBiosEntry* entry(size_t header_index) const;
+
+    /// @brief Cached decoded entries of one type (BiosInformationEntry, MemoryDeviceEntry etc.)
+    template <typename Entry>
+    std::vector<const Entry*> entries_of_type() const
+    {
+        std::vector<const Entry*> entries;
+        for (size_t i = 0; i < headers_list_.size(); ++i) {
+            if (headers_list_[i].type == Entry::structure_type) {
+                entries.push_back(static_cast<const Entry*>(entry(i)));
+            }
+        }
+        return entries;
+    }
+
+    /// @brief Handle references between structures, vertices are header indices
+    /// Built once on first request; thread-safe
+    const HandleGraph& handle_graph() const;
+
+    /// @brief System UUID and serial numbers (see system_identity.h)
+    /// Raw table scan which stops as soon as types 1, 2 and 3 are found,
+    /// does not touch cached entries
+    SystemIdentity identity() const;
+
+    /// @brief Value of key=value string from OEM Strings (type 11) or
+    /// System Configuration Options (type 12), view into the table
+    /// Strings are hashed once on first request; thread-safe
+    boost::optional<boost::string_view> oem_value(boost::string_view key) const;
+
+    /// @brief Slots and onboard devices sorted by PCI address (see pci_device_map.h)
+    /// Built once on first request; thread-safe
+    const PciDeviceMap& pci_devices() const;
+
+    /// @brief IPMI interfaces and Redfish host interfaces (see management_controllers.h)
+    /// Built once on first request; thread-safe
+    const ManagementControllers& management_controllers() const;
+
     /// @brief Implement bidirectional iterator for STL-style processing
     class iterator {
     public:
@@ -239,9 +334,37 @@ private:
     /// Save SMBIOS entry point here
     std::vector<uint8_t> entry_point_buffer_;
 
+    /// Table provided by the caller instead of native implementation
+    std::vector<uint8_t> table_dump_;
+
     /// Cached SMBIOS headers
     std::vector<DMIHeader> headers_list_;
 
+    /// Decoded entries, index is the same as in headers list
+    mutable std::vector<std::unique_ptr<AbstractSMBiosEntry>> entries_cache_;
+
+    /// Decode every entry once, even if requested concurrently
+    std::unique_ptr<std::once_flag[]> entries_decoded_;
+
+    /// Entries generator for the cache
+    std::unique_ptr<SMBiosEntryFactory> entries_factory_;
+
+    /// References between structures, built on demand
+    mutable std::unique_ptr<HandleGraph> handle_graph_;
+    std::unique_ptr<std::once_flag> handle_graph_built_;
+
+    /// OEM key=value strings, built on demand
+    mutable std::unique_ptr<OemStringIndex> oem_index_;
+    std::unique_ptr<std::once_flag> oem_index_built_;
+
+    /// PCI addresses of slots and onboard devices, built on demand
+    mutable std::unique_ptr<PciDeviceMap> pci_devices_;
+    std::unique_ptr<std::once_flag> pci_devices_built_;
+
+    /// BMC interfaces, built on demand
+    mutable std::unique_ptr<ManagementControllers> management_controllers_;
+    std::unique_ptr<std::once_flag> management_controllers_built_;
+
     /// Entry points, mapped to memory dump
     const SMBIOSEntryPoint32* smbios_entry32_ = nullptr;
     const SMBIOSEntryPoint64* smbios_entry64_ = nullptr;
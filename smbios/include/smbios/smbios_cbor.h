@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/cbor.h>
+#include <smbios/smbios_schema.h>
+
+// CBOR message of the SMBIOS table for collector transport
+// The decoded table as in smbios_json.h, but maps have small integer keys instead of names
+// and values are not resolved to text. Keys of every map are written in ascending order:
+//
+// {0: [major, minor], 1: table_size, 2: "host", 3: [
+//     {0: handle, 1: type, 2: length, 3: ["string 1", ...], 4: {field offset: value, ...}}, ...]}
+//
+// Host is omitted when empty, fields are omitted for structures without schema (OEM-specific).
+// String fields are string indexes into the structure strings (0 is "Not Specified"),
+// enums and bitfields are raw numbers, byte arrays are byte strings, other fields are numbers;
+// the collector resolves names with the same schema by structure type and field offset.
+// Messages of several hosts could be concatenated into a CBOR sequence (RFC 8742).
+// Entry point is not encoded
+
+namespace smbios {
+
+/// @brief Keys of the message map
+enum class CborMessageKey : uint8_t {
+    Version = 0,
+    TableSize = 1,
+    Host = 2,
+    Structures = 3
+};
+
+/// @brief Keys of the structure map
+enum class CborStructureKey : uint8_t {
+    Handle = 0,
+    Type = 1,
+    Length = 2,
+    Strings = 3,
+    Fields = 4
+};
+
+/// @brief Decoded field value in the form described above, the key is written by the caller
+void write_cbor_field_value(const DecodedField& field, CborWriter& writer);
+
+/// @brief Single structure as CBOR map
+void render_structure_cbor(const DMIHeader& header, const SMBiosVersion& version, CborWriter& writer);
+
+/// @brief Whole table as single message appended to the buffer
+/// The buffer is meant to be reused: clear() keeps its capacity for the next message
+void render_cbor(const SMBios& smbios, boost::string_view host, RenderBuffer& out);
+
+/// @brief Structure being decoded, strings are available before the fields
+struct MessageStructure {
+    uint16_t handle;
+    uint8_t type;
+    uint8_t length;
+
+    /// nullptr for OEM-specific and unknown types
+    const StructureSchema* schema;
+
+    /// Refer to the message data
+    const boost::string_view* strings;
+    size_t strings_count;
+};
+
+/// @brief Field of the structure being decoded
+struct MessageField {
+    uint8_t offset;
+
+    /// nullptr if the schema has no field at the offset
+    const FieldSchema* schema;
+
+    /// Number, byte string etc., see CborItem
+    CborItem value;
+
+    /// Resolved string for String fields, enum name for Enum fields, empty otherwise
+    boost::string_view text;
+};
+
+/// @brief Callbacks of the streaming decoder, called in message order
+/// Strings and texts refer to the message data and are valid as long as the data is
+class CborMessageVisitor {
+public:
+    virtual ~CborMessageVisitor() = default;
+
+    /// Called once before the structures
+    virtual void table(const SMBiosVersion& /*version*/, uint64_t /*table_size*/, boost::string_view /*host*/) {}
+
+    virtual void begin_structure(const MessageStructure& /*structure*/) {}
+    virtual void field(const MessageStructure& /*structure*/, const MessageField& /*field*/) {}
+    virtual void end_structure(const MessageStructure& /*structure*/) {}
+};
+
+/// @brief Decode single message from the data, the visitor is called as the items are read
+/// Unknown keys are skipped. Returns size of the message, the next one of a sequence follows it.
+/// Throws std::runtime_error on malformed or truncated message
+size_t decode_cbor_message(const uint8_t* data, size_t size, CborMessageVisitor& visitor);
+
+} // namespace smbios
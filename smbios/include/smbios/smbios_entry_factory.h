@@ -2,17 +2,30 @@
 #include <cstdint>
 #include <memory>
 #include <map>
+#include <vector>
 #include <boost/function.hpp>
 
 #include <smbios/bios_information_entry.h>
+#include <smbios/processor_information_entry.h>
+#include <smbios/cache_information_entry.h>
 #include <smbios/port_connection_entry.h>
+#include <smbios/system_slots_entry.h>
+#include <smbios/oem_strings_entry.h>
+#include <smbios/system_configuration_options_entry.h>
 #include <smbios/memory_device_entry.h>
+#include <smbios/memory_array_mapped_address_entry.h>
+#include <smbios/memory_device_mapped_address_entry.h>
+#include <smbios/ipmi_device_entry.h>
+#include <smbios/onboard_devices_extended_entry.h>
+#include <smbios/management_host_interface_entry.h>
+#include <smbios/smbios_entry_variant.h>
 
 namespace smbios {
 
 class AbstractSMBiosEntry;
 class DMIHeader;
 class SMBiosVersion;
+class SMBios;
 
 /// @brief Abstract factory class. Generates SMBIOS headers according to header and version provided
 /// Header represent type, version usually helps to know the amount of useful information in the structure
@@ -24,8 +37,16 @@ public:
     SMBiosEntryFactory();
 
     /// @brief Create concrete instance of the SMBIOS entry
+    /// Standard types without dedicated class are decoded by GenericSMBiosEntry,
+    /// nullptr for OEM-specific types
     std::unique_ptr<AbstractSMBiosEntry> create(const DMIHeader&, const SMBiosVersion&);
 
+    /// @brief Create SMBIOS entry by value, OEM-specific types are kept as RawSMBiosEntry
+    SMBiosEntryVariant create_variant(const DMIHeader&, const SMBiosVersion&) const;
+
+    /// @brief Decode the whole table into contiguous storage, in table order
+    std::vector<SMBiosEntryVariant> create_all(SMBios& smbios) const;
+
 private:
 
     /// Map SMBIOS header types to class instance generators
@@ -3,6 +3,8 @@
 
 namespace smbios {
 
+class RenderBuffer;
+
 /// @brief Interface for any SMBIOS entry
 class SMBiosInterface {
 
@@ -17,6 +19,9 @@ public:
     /// @brief Render all entry information into single string
     virtual std::string render_to_description() const = 0;
 
+    /// @brief Append all entry information to the buffer, same text as render_to_description()
+    virtual void render_to(RenderBuffer& out) const = 0;
+
     /// @brief Entry size without string section
     virtual size_t get_entry_size() const = 0;
 };
@@ -0,0 +1,96 @@
+#pragma once
+#include <string>
+#include <boost/variant.hpp>
+
+#include <smbios/raw_smbios_entry.h>
+#include <smbios/bios_information_entry.h>
+#include <smbios/processor_information_entry.h>
+#include <smbios/cache_information_entry.h>
+#include <smbios/port_connection_entry.h>
+#include <smbios/system_slots_entry.h>
+#include <smbios/oem_strings_entry.h>
+#include <smbios/system_configuration_options_entry.h>
+#include <smbios/memory_device_entry.h>
+#include <smbios/memory_array_mapped_address_entry.h>
+#include <smbios/memory_device_mapped_address_entry.h>
+#include <smbios/ipmi_device_entry.h>
+#include <smbios/onboard_devices_extended_entry.h>
+#include <smbios/management_host_interface_entry.h>
+#include <smbios/generic_smbios_entry.h>
+
+// Value model for SMBIOS entries
+// Whole table could be decoded into single std::vector<SMBiosEntryVariant>
+// and processed with boost::apply_visitor, without per-entry heap allocation.
+// Entries are views: fields and strings are read from the table, which should outlive them.
+// Alternatives still derive from AbstractSMBiosEntry and carry its vtable pointer,
+// but all decoded entry classes are final, so visitor calls are not virtual
+
+namespace smbios {
+
+/// @brief Any SMBIOS entry by value
+/// RawSMBiosEntry is the first alternative so that default-constructed
+/// variant is never required to parse anything
+using SMBiosEntryVariant = boost::variant<
+    RawSMBiosEntry,
+    BiosInformationEntry,
+    ProcessorInformationEntry,
+    CacheInformationEntry,
+    PortConnectionEntry,
+    SystemSlotsEntry,
+    OemStringsEntry,
+    SystemConfigurationOptionsEntry,
+    MemoryDeviceEntry,
+    MemoryArrayMappedAddressEntry,
+    MemoryDeviceMappedAddressEntry,
+    IpmiDeviceEntry,
+    OnboardDevicesExtendedEntry,
+    ManagementHostInterfaceEntry,
+    GenericSMBiosEntry>;
+
+/// @brief Visitor for the entry string representation
+struct EntryTypeVisitor : public boost::static_visitor<std::string> {
+    template <typename Entry>
+    std::string operator()(const Entry& entry) const
+    {
+        return entry.get_type();
+    }
+};
+
+/// @brief Visitor rendering all entry information into single string
+struct RenderVisitor : public boost::static_visitor<std::string> {
+    template <typename Entry>
+    std::string operator()(const Entry& entry) const
+    {
+        return entry.render_to_description();
+    }
+};
+
+/// @brief Visitor appending all entry information to the buffer
+struct RenderToVisitor : public boost::static_visitor<void> {
+    explicit RenderToVisitor(RenderBuffer& out) : out_(out) {}
+
+    template <typename Entry>
+    void operator()(const Entry& entry) const
+    {
+        entry.render_to(out_);
+    }
+
+    RenderBuffer& out_;
+};
+
+/// @brief Visitor for the entry size without string section
+struct EntrySizeVisitor : public boost::static_visitor<size_t> {
+    template <typename Entry>
+    size_t operator()(const Entry& entry) const
+    {
+        return entry.get_entry_size();
+    }
+};
+
+/// @brief Check whether variant holds decoded entry (not a raw one)
+inline bool is_decoded(const SMBiosEntryVariant& entry)
+{
+    return nullptr == boost::get<RawSMBiosEntry>(&entry);
+}
+
+} // namespace smbios
@@ -0,0 +1,173 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <smbios/smbios.h>
+
+// Compile-time descriptors of SMBIOS structure fields
+// Every structure type declares its revisions: formatted area length defined
+// by each SMBIOS version. Table version and structure length are resolved once
+// into single "available length", after that any field access is one comparison
+// and one unaligned load
+
+namespace smbios {
+
+/// @brief Formatted area length defined by specific SMBIOS version
+struct SMBiosRevision {
+    uint16_t major_version;
+    uint16_t minor_version;
+    uint8_t length;
+};
+
+/// @brief Field of the structure: type, offset from the structure beginning
+/// and the first SMBIOS version which defines it
+template <typename T, size_t Offset, uint16_t Major, uint16_t Minor>
+struct SMBiosField {
+    static_assert(std::is_integral<T>::value, "Only integer fields are supported");
+
+    using value_type = T;
+
+    /// Offset from the structure beginning (header included)
+    static constexpr size_t offset = Offset;
+
+    /// Minimal structure length containing the field
+    static constexpr size_t length = Offset + sizeof(T);
+
+    /// Version which introduced the field
+    static constexpr uint16_t major_version = Major;
+    static constexpr uint16_t minor_version = Minor;
+};
+
+/// @brief Formatted area length defined by the version, 0 if structure is not defined yet
+template <size_t N>
+constexpr uint8_t revision_length(const SMBiosRevision (&revisions)[N], uint16_t major, uint16_t minor)
+{
+    uint8_t length = 0;
+    for (size_t i = 0; i < N; ++i) {
+        if ((major > revisions[i].major_version) ||
+            (major == revisions[i].major_version && minor >= revisions[i].minor_version)) {
+            length = revisions[i].length;
+        }
+    }
+    return length;
+}
+
+/// @brief Compile-time check that field is placed inside the revision declaring it
+template <typename Field, size_t N>
+constexpr bool field_in_revision(const SMBiosRevision (&revisions)[N])
+{
+    return Field::length <= revision_length(revisions, Field::major_version, Field::minor_version);
+}
+
+/// @brief Length of the structure which could be read for the table version
+template <size_t N>
+uint8_t resolve_available_length(const SMBiosRevision (&revisions)[N], const DMIHeader& header,
+    const SMBiosVersion& version)
+{
+    const uint8_t version_length = revision_length(revisions, version.major_version, version.minor_version);
+    return header.length < version_length ? header.length : version_length;
+}
+
+/// @brief Unaligned little-endian load, caller is responsible for bounds
+template <typename Field>
+typename Field::value_type load_field(const uint8_t* data)
+{
+    typename Field::value_type value;
+    std::memcpy(&value, data + Field::offset, sizeof(value));
+    return value;
+}
+
+/// @brief Little-endian value of 'width' bytes, up to 8, for widths known at run time only
+/// Caller is responsible for bounds
+inline uint64_t load_uint(const uint8_t* data, size_t width)
+{
+    uint64_t value = 0;
+    for (size_t i = width; i > 0; --i) {
+        value = (value << 8) | data[i - 1];
+    }
+    return value;
+}
+
+/// @brief Version-resolved structure accessor
+/// Keeps only the pointer and available length, no per-field version checks
+class SMBiosFieldReader {
+public:
+
+    /// @brief Nothing is available
+    SMBiosFieldReader() = default;
+
+    /// @brief Resolve structure version once
+    template <size_t N>
+    SMBiosFieldReader(const DMIHeader& header, const SMBiosVersion& version,
+        const SMBiosRevision (&revisions)[N])
+        : data_(header.data), available_length_(resolve_available_length(revisions, header, version))
+    {
+    }
+
+    /// @brief Field is defined by table version and present in the structure
+    template <typename Field>
+    bool has() const
+    {
+        return Field::length <= available_length_;
+    }
+
+    /// @brief Field value or default one if field is not available
+    template <typename Field>
+    typename Field::value_type get(typename Field::value_type default_value) const
+    {
+        return has<Field>() ? load_field<Field>(data_) : default_value;
+    }
+
+    /// @brief Structure beginning
+    const uint8_t* data() const
+    {
+        return data_;
+    }
+
+    /// @brief Version-resolved length
+    uint8_t available_length() const
+    {
+        return available_length_;
+    }
+
+private:
+    const uint8_t* data_ = nullptr;
+    uint8_t available_length_ = 0;
+};
+
+/// @brief Extract one field from a range of views (or readers) into output iterator
+/// Structures of the same type from one table differ only in length, so the check
+/// is done once per run of equal available length, not for every structure
+template <typename Field, typename ForwardIt, typename OutputIt>
+OutputIt read_field_batch(ForwardIt first, ForwardIt last,
+    typename Field::value_type default_value, OutputIt out)
+{
+    while (first != last) {
+        const uint8_t run_length = first->available_length();
+        const bool available = Field::length <= run_length;
+        for (; first != last && first->available_length() == run_length; ++first) {
+            *out++ = available ? load_field<Field>(first->data()) : default_value;
+        }
+    }
+    return out;
+}
+
+/// @brief The same for headers of one structure type right from the table, no views are built
+/// Table version and structure length are resolved against the revisions once per run
+/// of equal structure length instead of once per structure
+template <typename Field, size_t N, typename OutputIt>
+OutputIt read_field_batch(const SMBiosRevision (&revisions)[N], const SMBiosVersion& version,
+    const DMIHeader* first, const DMIHeader* last, typename Field::value_type default_value, OutputIt out)
+{
+    while (first != last) {
+        const uint8_t run_length = first->length;
+        const bool available = Field::length <= resolve_available_length(revisions, *first, version);
+        for (; first != last && first->length == run_length; ++first) {
+            *out++ = available ? load_field<Field>(first->data) : default_value;
+        }
+    }
+    return out;
+}
+
+} // namespace smbios
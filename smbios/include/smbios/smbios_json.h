@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <smbios/smbios.h>
+#include <smbios/json_writer.h>
+#include <smbios/smbios_schema.h>
+
+// JSON form of the SMBIOS table
+// Every standard structure is decoded with its schema (see smbios_schema.h),
+// fields are written straight into the output buffer in table order:
+//
+// {"version":{"major":3,"minor":2},"table_size":N,"entry_point":{...},
+//  "structures":[{"handle":0,"type":0,"length":24,"name":"BIOS Information",
+//                 "fields":{"Vendor":"...",...},"strings":["...",...]},...]}
+//
+// String fields are strings, enums are names (numbers if the value is unknown),
+// bitfields are arrays of names of the set bits, byte arrays are hex strings,
+// all other fields are numbers. OEM-specific structures have no "fields"
+
+namespace smbios {
+
+/// @brief Decoded field value in the form described above, the key is written by the caller
+void write_field_value(const DecodedField& field, JsonWriter& writer);
+
+/// @brief Single structure as JSON object
+void render_structure_json(const DMIHeader& header, const SMBiosVersion& version, JsonWriter& writer);
+
+/// @brief Whole table as single JSON document
+void render_json(const SMBios& smbios, RenderBuffer& out);
+
+/// @brief Whole table as single JSON document
+std::string render_json(const SMBios& smbios);
+
+} // namespace smbios
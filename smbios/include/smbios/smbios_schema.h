@@ -0,0 +1,273 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/render_buffer.h>
+
+// Table-driven description of SMBIOS structures
+// Every structure type is described by constexpr field descriptors:
+// offset, width, version which introduced the field, kind and optional name table.
+// Single generic decoder loop serves all types, adding a type means adding data only.
+// Only the fixed part of the formatted area is described, repeated groups
+// (slot peer groups, contained elements etc.) are left to dedicated decoders
+
+namespace smbios {
+
+/// @brief How to interpret the field value
+enum class FieldKind : uint8_t {
+    Integer,    // plain number
+    String,     // index in the string section
+    Enum,       // value from the name table
+    Bitfield,   // bit numbers from the name table
+    Handle,     // reference to another structure
+    Bytes       // raw byte array (UUID etc.)
+};
+
+/// @brief Name of the enumerated value or of the bit in bitfield
+struct FieldName {
+    uint16_t value;
+    const char* name;
+};
+
+/// @brief Compile-time descriptor of a single field
+struct FieldSchema {
+    const char* name;
+    uint8_t offset;
+    uint8_t width;
+    FieldKind kind;
+    uint8_t major_version;
+    uint8_t minor_version;
+
+    /// Number of value bits, 0 - whole field (e.g. bit 7 of chassis type is a lock flag)
+    uint8_t value_bits;
+
+    /// Enum values or bit names
+    const FieldName* names;
+    uint8_t names_count;
+};
+
+/// @brief Compile-time descriptor of the structure type
+struct StructureSchema {
+    uint8_t type;
+    const char* name;
+    const FieldSchema* fields;
+    uint8_t fields_count;
+};
+
+/// @brief Plain number field
+constexpr FieldSchema integer_field(const char* name, uint8_t offset, uint8_t width,
+    uint8_t major = 2, uint8_t minor = 0)
+{
+    return FieldSchema{ name, offset, width, FieldKind::Integer, major, minor, 0, nullptr, 0 };
+}
+
+/// @brief String index field
+constexpr FieldSchema string_field(const char* name, uint8_t offset, uint8_t major = 2, uint8_t minor = 0)
+{
+    return FieldSchema{ name, offset, 1, FieldKind::String, major, minor, 0, nullptr, 0 };
+}
+
+/// @brief Structure handle field
+constexpr FieldSchema handle_field(const char* name, uint8_t offset, uint8_t major = 2, uint8_t minor = 0)
+{
+    return FieldSchema{ name, offset, 2, FieldKind::Handle, major, minor, 0, nullptr, 0 };
+}
+
+/// @brief Raw bytes field
+constexpr FieldSchema bytes_field(const char* name, uint8_t offset, uint8_t width,
+    uint8_t major = 2, uint8_t minor = 0)
+{
+    return FieldSchema{ name, offset, width, FieldKind::Bytes, major, minor, 0, nullptr, 0 };
+}
+
+/// @brief Enumeration field, value_bits limits the value to the lower bits
+template <size_t N>
+constexpr FieldSchema enum_field(const char* name, uint8_t offset, uint8_t width, const FieldName (&names)[N],
+    uint8_t major = 2, uint8_t minor = 0, uint8_t value_bits = 0)
+{
+    return FieldSchema{ name, offset, width, FieldKind::Enum, major, minor, value_bits, names, N };
+}
+
+/// @brief Bitfield, names contain bit numbers
+template <size_t N>
+constexpr FieldSchema bitfield_field(const char* name, uint8_t offset, uint8_t width, const FieldName (&names)[N],
+    uint8_t major = 2, uint8_t minor = 0)
+{
+    return FieldSchema{ name, offset, width, FieldKind::Bitfield, major, minor, 0, names, N };
+}
+
+/// @brief Structure descriptor
+template <size_t N>
+constexpr StructureSchema structure_schema(uint8_t type, const char* name, const FieldSchema (&fields)[N])
+{
+    return StructureSchema{ type, name, fields, N };
+}
+
+/// @brief Descriptor of the standard structure type, nullptr if there is no one
+const StructureSchema* find_structure_schema(uint8_t type);
+
+/// @brief Descriptor of the field at the offset, nullptr if the schema has no one
+const FieldSchema* find_field_schema(const StructureSchema& schema, uint8_t offset);
+
+/// @brief Name of the enumerated value or bit, nullptr if the value is unknown
+const char* find_field_name(const FieldSchema& field, uint16_t value);
+
+/// @brief Strings of the structure string section in table order, no copy
+/// The walk ends at the '\0\0' terminator. SMBios checks that every structure has it inside
+/// the table, so its headers need no limit; raw memory should pass its end as the limit,
+/// then a string cut by the limit ends the walk as well
+class DmiStrings {
+public:
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = boost::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const boost::string_view*;
+        using reference = const boost::string_view&;
+
+        /// @brief Past-the-end iterator
+        const_iterator() = default;
+
+        const_iterator(const char* current, const char* limit);
+
+        reference operator*() const { return string_; }
+        pointer operator->() const { return &string_; }
+
+        const_iterator& operator++();
+        const_iterator operator++(int)
+        {
+            const_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const { return string_.data() == other.string_.data(); }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+
+        /// The string at 'current' or the end
+        void load(const char* current);
+
+    private:
+
+        /// nullptr data at the end
+        boost::string_view string_;
+        const char* limit_ = nullptr;
+    };
+
+    /// @brief Strings following the formatted area of 'length' bytes, limit is nullptr or the end of memory
+    DmiStrings(const uint8_t* structure, uint8_t length, const uint8_t* limit = nullptr)
+        : section_(reinterpret_cast<const char*>(structure + length)),
+          limit_(reinterpret_cast<const char*>(limit))
+    {
+    }
+
+    explicit DmiStrings(const DMIHeader& header) : DmiStrings(header.data, header.length)
+    {
+    }
+
+    const_iterator begin() const { return const_iterator(section_, limit_); }
+    const_iterator end() const { return const_iterator(); }
+
+    /// @brief Number of strings, walks the section
+    size_t size() const { return static_cast<size_t>(std::distance(begin(), end())); }
+
+private:
+
+    const char* section_;
+    const char* limit_;
+};
+
+/// @brief String from the string section of the structure, no copy
+/// Note: First string index is 1, 0 is "Not Specified", missing string is "Bad index"
+/// Limit is the end of memory the structure lies in, see DmiStrings
+boost::string_view find_dmi_string(const uint8_t* structure, uint8_t length, uint8_t string_index,
+    const uint8_t* limit = nullptr);
+
+/// @brief Single decoded field
+struct DecodedField {
+    const FieldSchema* schema;
+
+    /// Numeric value: integer, enum, bit set, handle or string index
+    /// For Bytes fields it is 0, see bytes
+    uint64_t value;
+
+    /// Resolved string for String fields, enum name for Enum fields
+    boost::string_view text;
+
+    /// Field memory for Bytes fields
+    const uint8_t* bytes;
+};
+
+/// @brief Field is defined for the table version and present in the structure
+inline bool field_available(const FieldSchema& field, const DMIHeader& header, const SMBiosVersion& version)
+{
+    return (static_cast<size_t>(field.offset) + field.width <= header.length) &&
+        ((version.major_version > field.major_version) ||
+         (version.major_version == field.major_version && version.minor_version >= field.minor_version));
+}
+
+/// @brief Decode one field, field should be available
+DecodedField decode_field(const FieldSchema& field, const DMIHeader& header);
+
+/// @brief Names of the set bits of the Bitfield field joined with '|', bits without a name are skipped
+/// Names are cleared first, one buffer serves every field
+void join_bit_names(const DecodedField& decoded, std::string& names);
+
+/// @brief Flat text form of the decoded field, shared by the line-oriented exporters:
+/// strings and enum names as text, unnamed enum values and integers in decimal,
+/// bit sets as joined names, bytes as hex digits
+/// Text goes through append_text(out, text), so that every exporter applies own quoting
+template <typename AppendText>
+void append_field_value(RenderBuffer& out, const DecodedField& decoded, std::string& bit_names,
+    AppendText&& append_text)
+{
+    const FieldSchema& field = *decoded.schema;
+    switch (field.kind) {
+    case FieldKind::String:
+        append_text(out, decoded.text);
+        break;
+    case FieldKind::Enum:
+        if (!decoded.text.empty()) {
+            append_text(out, decoded.text);
+        }
+        else {
+            out.append_decimal(decoded.value);
+        }
+        break;
+    case FieldKind::Bitfield:
+        join_bit_names(decoded, bit_names);
+        append_text(out, bit_names);
+        break;
+    case FieldKind::Bytes:
+        for (size_t i = 0; i < field.width; ++i) {
+            out << hex_digits(decoded.bytes[i], 2);
+        }
+        break;
+    default:
+        out.append_decimal(decoded.value);
+        break;
+    }
+}
+
+/// @brief Generic decoder loop: call visitor(const DecodedField&) for every available field
+template <typename Visitor>
+void decode_structure(const StructureSchema& schema, const DMIHeader& header, const SMBiosVersion& version,
+    Visitor&& visitor)
+{
+    const FieldSchema* const fields_end = schema.fields + schema.fields_count;
+    for (const FieldSchema* field = schema.fields; field != fields_end; ++field) {
+        if (field_available(*field, header, version)) {
+            visitor(decode_field(*field, header));
+        }
+    }
+}
+
+} // namespace smbios
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <boost/utility/string_view.hpp>
+#include <smbios/smbios.h>
+#include <smbios/smbios_field.h>
+
+// Lightweight typed views over raw SMBIOS structures
+// Unlike entries, views do not parse strings and do not build any maps at creation,
+// they are trivially copyable and fit into 16 bytes, so that thousands of them
+// could be stored in a contiguous vector without any allocation per structure
+
+namespace smbios {
+
+/// @brief Common part of all typed views: pointer to the structure, its length
+/// and length available for the table version (see SMBiosFieldReader)
+class SMBiosStructureView {
+public:
+
+    /// @brief Empty view, all getters return default values
+    SMBiosStructureView() = default;
+
+    /// @brief Point to the structure, memory is owned by SMBios
+    template <size_t N>
+    SMBiosStructureView(const DMIHeader& header, const SMBiosVersion& version,
+        const SMBiosRevision (&revisions)[N])
+        : data_(header.data), length_(header.length),
+          available_length_(resolve_available_length(revisions, header, version))
+    {
+    }
+
+    /// @brief Structure type ID
+    uint8_t get_type_id() const
+    {
+        return data_ ? data_[0] : static_cast<uint8_t>(SMBios::EndOfTable);
+    }
+
+    /// @brief Structure handle
+    uint16_t get_handle() const
+    {
+        return data_ ? load_field<HandleField>(data_) : 0xFFFF;
+    }
+
+    /// @brief Entry size without string section
+    size_t get_entry_size() const
+    {
+        return static_cast<size_t>(length_);
+    }
+
+    /// @brief Structure beginning, for batch field extraction
+    const uint8_t* data() const
+    {
+        return data_;
+    }
+
+    /// @brief Version-resolved length, for batch field extraction
+    uint8_t available_length() const
+    {
+        return available_length_;
+    }
+
+    /// @brief Any field of the structure, default value if it is not available
+    template <typename Field>
+    typename Field::value_type get(typename Field::value_type default_value) const
+    {
+        return Field::length <= available_length_ ? load_field<Field>(data_) : default_value;
+    }
+
+protected:
+
+    /// Handle is a part of the header, available in any version
+    using HandleField = SMBiosField<uint16_t, 0x02, 2, 0>;
+
+    /// String by index from the string section, no copy
+    /// Note: First string index is 1, 0 is "Not Specified"
+    boost::string_view dmi_string(uint8_t string_index) const;
+
+private:
+
+    /// Structure beginning (header included)
+    const uint8_t* data_ = nullptr;
+
+    /// Formatted area length, strings begin right after it
+    uint8_t length_ = 0;
+
+    /// Formatted area length which could be read for the table version
+    uint8_t available_length_ = 0;
+};
+
+} // namespace smbios
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+
+// String list entry
+// See http://www.dmtf.org/standards/smbios
+// Base of the structures which formatted area is the strings count only:
+// 'OEM Strings' and 'System Configuration Options' chapters
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS string list fields and formatted area length by version
+struct StringListLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 0, 0x05 }
+    };
+
+    // Ver 2.0+
+    using Count = SMBiosField<uint8_t, 0x04, 2, 0>;
+};
+
+/// @brief Strings count followed by the strings, decoded the same way for every type
+class StringListEntry : public AbstractSMBiosEntry {
+public:
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    StringListEntry(const StringListEntry&) = default;
+    StringListEntry(StringListEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~StringListEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x04 offset
+    /// Number of strings
+    uint8_t get_count() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values
+
+    /// @brief String by 1-based index, view into the table memory
+    boost::string_view get_string(uint8_t string_index) const;
+
+    /// @brief All strings in order, views into the table memory
+    std::vector<boost::string_view> get_strings() const;
+
+protected:
+
+    /// @brief Parse the header of the expected type, label is the type name for get_type()
+    StringListEntry(const DMIHeader& header, const SMBiosVersion& version, uint8_t structure_type,
+        const char* label);
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+
+    /// Formatted area length, strings section starts right after it
+    uint8_t length_ = 0;
+
+    /// Structure type name, static string
+    const char* label_;
+};
+
+} // namespace smbios
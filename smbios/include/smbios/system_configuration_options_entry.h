@@ -0,0 +1,28 @@
+#pragma once
+#include <smbios/string_list_entry.h>
+
+// System Configuration Options entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'System Configuration Options' chapter
+// Formatted area is the strings count only, the strings are jumper and switch settings
+// EXAMPLE : 'JP2: 1-2 Cache Size is 256K'
+
+namespace smbios {
+
+/// @brief Information required to configure the baseboard (jumpers and switches)
+class SystemConfigurationOptionsEntry final : public StringListEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::SystemConfigurationOptions;
+
+    /// @brief Parse the header, recognize how much information do we have
+    SystemConfigurationOptionsEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    SystemConfigurationOptionsEntry(const SystemConfigurationOptionsEntry&) = default;
+    SystemConfigurationOptionsEntry(SystemConfigurationOptionsEntry&&) = default;
+};
+
+} // namespace smbios
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <boost/utility/string_view.hpp>
+
+// Host identity fast path
+// System UUID and serial (type 1), baseboard serial (type 2) and chassis serial (type 3)
+// are read right from the raw table: headers are walked only until all three
+// structures are met, no entries are decoded and nothing is allocated
+
+namespace smbios {
+
+struct SMBiosVersion;
+class RenderBuffer;
+
+/// @brief Fixed-size identity record, could be copied and compared as is
+struct SystemIdentity {
+
+    /// Longer serial numbers are truncated
+    static constexpr size_t max_serial_length = 64;
+
+    /// UUID in RFC 4122 (network) byte order regardless of SMBIOS version
+    uint8_t uuid[16];
+
+    /// Zero-terminated serial numbers, empty if not specified or the string is missing
+    char system_serial[max_serial_length + 1];
+    char baseboard_serial[max_serial_length + 1];
+    char chassis_serial[max_serial_length + 1];
+
+    /// UUID is not all 00h (not present) or all FFh (not set)
+    bool uuid_present;
+
+    /// Which structures were found in the table
+    bool system_found;
+    bool baseboard_found;
+    bool chassis_found;
+
+    /// @brief All three singleton structures have been found
+    bool complete() const { return system_found && baseboard_found && chassis_found; }
+};
+
+/// @brief Convert UUID stored in the table to RFC 4122 byte order
+/// Since 2.6 the first three fields are little-endian
+void normalize_uuid(uint8_t (&uuid)[16], const SMBiosVersion& version);
+
+/// @brief Walk structures of the table until types 1, 2 and 3 are found
+/// Table is the structures area only, without entry point
+SystemIdentity read_system_identity(const uint8_t* table, size_t table_size, const SMBiosVersion& version);
+
+/// @brief Canonical UUID text, 8-4-4-4-12 upper-case hex digits
+std::string format_uuid(const uint8_t (&uuid)[16]);
+
+/// @brief Append the same 36 characters as format_uuid() to the buffer
+void append_uuid(RenderBuffer& out, const uint8_t (&uuid)[16]);
+
+/// @brief Text form, one "Key: value" line per field
+std::string render_system_identity(const SystemIdentity& identity);
+
+/// @brief Append the text form to the buffer
+void render_system_identity(const SystemIdentity& identity, RenderBuffer& out);
+
+} // namespace smbios
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstdint>
+#include <smbios/abstract_smbios_entry.h>
+#include <smbios/smbios_field.h>
+#include <smbios/pci_address.h>
+
+// System Slots entry
+// See http://www.dmtf.org/standards/smbios
+// Standard according to current SMBIOS version
+// 'System Slots' chapter
+// PCI address of the slot is present since 2.6
+
+namespace smbios {
+
+struct DMIHeader;
+struct SMBiosVersion;
+
+/// @brief SMBIOS SystemSlots fields and formatted area length by version
+/// Peer groups (3.2+) and later fields are variable-length and not mapped
+struct SystemSlotsLayout {
+    static constexpr SMBiosRevision revisions[] = {
+        { 2, 0, 0x0C },
+        { 2, 1, 0x0D },
+        { 2, 6, 0x11 },
+        { 3, 2, 0x13 }
+    };
+
+    // Ver 2.0+
+    using SlotDesignation = SMBiosField<uint8_t, 0x04, 2, 0>;
+    using SlotType = SMBiosField<uint8_t, 0x05, 2, 0>;
+    using SlotDataBusWidth = SMBiosField<uint8_t, 0x06, 2, 0>;
+    using CurrentUsage = SMBiosField<uint8_t, 0x07, 2, 0>;
+    using SlotLength = SMBiosField<uint8_t, 0x08, 2, 0>;
+    using SlotId = SMBiosField<uint16_t, 0x09, 2, 0>;
+    using SlotCharacteristics1 = SMBiosField<uint8_t, 0x0B, 2, 0>;
+
+    // Ver 2.1+
+    using SlotCharacteristics2 = SMBiosField<uint8_t, 0x0C, 2, 1>;
+
+    // Ver 2.6+
+    using SegmentGroupNumber = SMBiosField<uint16_t, 0x0D, 2, 6>;
+    using BusNumber = SMBiosField<uint8_t, 0x0F, 2, 6>;
+    using DeviceFunctionNumber = SMBiosField<uint8_t, 0x10, 2, 6>;
+
+    // Ver 3.2+
+    using DataBusWidth = SMBiosField<uint8_t, 0x11, 3, 2>;
+    using PeerGroupingCount = SMBiosField<uint8_t, 0x12, 3, 2>;
+};
+
+/// @brief Attributes of one system slot
+/// One structure is present for each slot, populated or not
+class SystemSlotsEntry final : public AbstractSMBiosEntry {
+public:
+
+    /// Structure type this entry is decoded from
+    static constexpr uint8_t structure_type = SMBios::SystemSlots;
+
+    // @brief Current Usage: uint8 - offset 0x07
+    enum CurrentUsageValue : uint8_t {
+        UsageOther = 0x01,
+        UsageUnknown = 0x02,
+        UsageAvailable = 0x03,
+        UsageInUse = 0x04,
+        UsageUnavailable = 0x05
+    };
+
+    /// @brief Parse the header, recognize how much information do we have
+    SystemSlotsEntry(const DMIHeader& header, const SMBiosVersion& version);
+
+    /// @brief Value semantic, no heap allocation for the entry itself
+    SystemSlotsEntry(const SystemSlotsEntry&) = default;
+    SystemSlotsEntry(SystemSlotsEntry&&) = default;
+
+    // @brief Parent is abstract
+    virtual ~SystemSlotsEntry() = default;
+
+    /// @brief String representation
+    virtual std::string get_type() const override;
+
+    /// @brief Append all entry information to the buffer
+    virtual void render_to(RenderBuffer& out) const override;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Byte values
+
+    /// @brief 0x05 offset
+    /// PCI Express x16, M.2 Socket 3 etc.
+    uint8_t get_slot_type() const;
+
+    /// @brief 0x06 offset
+    uint8_t get_slot_data_bus_width() const;
+
+    /// @brief 0x07 offset
+    /// See CurrentUsageValue enum
+    uint8_t get_current_usage() const;
+
+    /// @brief 0x08 offset
+    uint8_t get_slot_length() const;
+
+    /// @brief 0x09 offset
+    uint16_t get_slot_id() const;
+
+    /// @brief 0x0B and 0x0C offsets
+    uint8_t get_slot_characteristics1() const;
+    uint8_t get_slot_characteristics2() const;
+
+    /// @brief 0x0D, 0x0F and 0x10 offsets
+    /// Address of the device in the slot, not valid before 2.6 and for non-PCI slots
+    PciAddress get_pci_address() const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // String values
+
+    /// EXAMPLE : 'PCIE1'
+    std::string get_slot_designation_string() const;
+
+private:
+
+    /// Fields available for SMBIOS version and structure length
+    SMBiosFieldReader fields_;
+};
+
+} // namespace smbios
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <smbios/smbios.h>
+
+// SMBIOS table dumps stored in files
+// Two layouts are recognized:
+//  - raw structures area (smbios_util --dump-file, /sys/firmware/dmi/tables/DMI),
+//    it has no entry point, so the version is provided by the caller
+//  - dmidecode --dump-bin image: entry point at the beginning,
+//    its table address field is the offset of the structures in the file
+
+namespace smbios {
+
+/// @brief Version assumed for raw dumps
+/// Fields are still limited by the structure length, so a newer version only trusts the length
+constexpr SMBiosVersion raw_dump_version = { 3, 0 };
+
+/// @brief Structures area and version of the dump
+struct TableDump {
+    std::vector<uint8_t> table;
+    SMBiosVersion version;
+};
+
+/// @brief Split file content into the table and version, throws std::runtime_error on malformed entry point
+TableDump parse_table_dump(std::vector<uint8_t> file, const SMBiosVersion& raw_version = raw_dump_version);
+
+/// @brief Read and parse the dump file, throws std::runtime_error if it is not readable
+TableDump read_table_dump(const std::string& path, const SMBiosVersion& raw_version = raw_dump_version);
+
+/// @brief Regular files of the directory sorted by name
+/// Throws std::runtime_error if it is not a directory or it could not be read completely
+std::vector<std::string> list_table_dumps(const std::string& directory);
+
+} // namespace smbios
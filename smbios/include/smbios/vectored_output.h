@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <smbios/render_buffer.h>
+
+// Vectored output to a file descriptor
+// Text is rendered into a chain of large chunks; when a chunk is full the next one
+// is started, nothing is written. All pending chunks are passed to a single writev()
+// (split by IOV_MAX only), so a whole table normally leaves the process in one call.
+// Chunks keep their capacity between flushes. Windows has no writev, chunks are
+// written one by one there
+
+namespace smbios {
+
+/// @brief Chunked output buffer flushed with vectored writes
+class VectoredOutput {
+public:
+
+    /// Chunk is sealed when it grows over this size
+    static constexpr size_t default_chunk_size = 256 * 1024;
+
+    /// Pending chunks are flushed when there are this many, it limits memory of bulk exports
+    static constexpr size_t default_max_chunks = 64;
+
+    explicit VectoredOutput(int fd, size_t chunk_size = default_chunk_size, size_t max_chunks = default_max_chunks);
+
+    /// @brief Pending output is written
+    ~VectoredOutput();
+
+    VectoredOutput(const VectoredOutput&) = delete;
+    VectoredOutput& operator=(const VectoredOutput&) = delete;
+
+    /// @brief Chunk to render into, reference is valid until the next commit() or flush()
+    RenderBuffer& buffer() { return chunks_[active_]; }
+
+    /// @brief Mark a boundary of the output (line, structure, table)
+    /// Start the next chunk if the current one is full, flush if there are too many chunks
+    void commit();
+
+    /// @brief Write all pending chunks, throws std::runtime_error on write failure
+    void flush();
+
+    /// @brief Bytes passed to the descriptor
+    uint64_t get_bytes_written() const { return bytes_written_; }
+
+    /// @brief Write system calls made
+    size_t get_write_calls() const { return write_calls_; }
+
+private:
+
+    /// Write chunks up to the active one, retry on partial writes and interrupts
+    void write_pending();
+
+private:
+
+    int fd_;
+    size_t chunk_size_;
+    size_t max_chunks_;
+
+    /// deque keeps buffer references valid when a chunk is added
+    std::deque<RenderBuffer> chunks_;
+    size_t active_ = 0;
+
+    uint64_t bytes_written_ = 0;
+    size_t write_calls_ = 0;
+};
+
+} // namespace smbios
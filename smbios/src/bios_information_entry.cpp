@@ -6,6 +6,15 @@
 
 using namespace smbios;
 
+constexpr uint8_t BiosInformationEntry::structure_type;
+
+constexpr SMBiosRevision BiosInformationLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<BiosInformationLayout::Properties>(BiosInformationLayout::revisions), "2.0 layout");
+static_assert(field_in_revision<BiosInformationLayout::FirmwareMinorVersion>(BiosInformationLayout::revisions), "2.4 layout");
+static_assert(field_in_revision<BiosInformationLayout::ExtendedRomSize>(BiosInformationLayout::revisions), "3.1 layout");
+
 BiosInformationEntry::BiosInformationEntry(const DMIHeader& header, const SMBiosVersion& version) 
     : AbstractSMBiosEntry(header) 
 {
@@ -15,21 +24,7 @@ BiosInformationEntry::BiosInformationEntry(const DMIHeader& header, const SMBios
         throw std::runtime_error(err.str().c_str());
     }
 
-    init_string_values();
-
-    // check empty entry
-    if ((header.length < 0x12) || (version < SMBiosVersion{2, 1}))
-        return;
-
-    // 2.4+
-    if ((header.length >= 0x12) && (version > SMBiosVersion{ 2, 3 })) {
-        bios_information24_ = reinterpret_cast<const BiosInformationV24*>(header.data);
-    }
-
-    // 3.1+
-    if ((header.length > 0x18) && (version > SMBiosVersion{ 3, 0 })){
-        bios_information31_ = reinterpret_cast<const BiosInformationV31*>(header.data);
-    }
+    fields_ = SMBiosFieldReader(header, version, BiosInformationLayout::revisions);
 }
 
 std::string BiosInformationEntry::get_type() const
@@ -37,187 +32,162 @@ std::string BiosInformationEntry::get_type() const
     return "BIOS Information";
 }
 
-std::string BiosInformationEntry::render_to_description() const
+void BiosInformationEntry::render_to(RenderBuffer& out) const
 {
-    std::stringstream decsription;
-    decsription << "Header type: " << get_type() << '\n';
-    decsription << "Vendor: " << get_vendor_string() << '\n';
-    decsription << "Version: " << get_version_string() << '\n';
-    decsription << "Address: " << get_starting_address_string() << '\n';
-    decsription << "Runtime size: " << get_runtime_size_string() << '\n';
-    decsription << "Release Date: " << get_release_date_string() << '\n';
-    decsription << "ROM Size: " << get_rom_size_string() << '\n';
-    decsription << "BIOS properties: " << '\n' << get_properties_string();
-    decsription << "BIOS properties extend1: " << '\n' << get_properties_extension1_string();
-    decsription << "BIOS properties extend2: " << '\n' << get_properties_extension2_string();
-    decsription << "BIOS Revision: " << get_bios_version_string() << '\n';
-    decsription << "Firmware Revision: " << get_firmware_version_string() << '\n';
-
-    return std::move(decsription.str());
+    out << "Header type: " << get_type() << '\n';
+    out << "Vendor: " << dmi_string_view(get_vendor_index()) << '\n';
+    out << "Version: " << dmi_string_view(get_version_index()) << '\n';
+    out << "Address: " << hex(get_starting_address()) << '\n';
+    out << "Runtime size: " << get_runtime_size_string() << '\n';
+    out << "Release Date: " << dmi_string_view(get_release_date_index()) << '\n';
+    out << "ROM Size: " << get_rom_size() << " kB\n";
+    out << "BIOS properties: " << '\n';
+    append_properties(out, get_properties(), string_values().properties_map);
+    out << "BIOS properties extend1: " << '\n';
+    append_properties(out, get_properties_extension1(), string_values().properties_extensions1_map);
+    out << "BIOS properties extend2: " << '\n';
+    append_properties(out, get_properties_extension2(), string_values().properties_extensions2_map);
+    out << "BIOS Revision: " << get_bios_major_release() << '.' << get_bios_minor_release() << '\n';
+    out << "Firmware Revision: " << get_firmware_major_release() << '.' << get_firmware_minor_release() << '\n';
 }
 
 uint8_t BiosInformationEntry::get_vendor_index() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->vendor;
+    return fields_.get<BiosInformationLayout::Vendor>(0);
 }
 
 uint8_t BiosInformationEntry::get_version_index() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->bios_version;
+    return fields_.get<BiosInformationLayout::BiosVersion>(0);
 }
 
 uint16_t BiosInformationEntry::get_starting_address() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->starting_segment;
+    return fields_.get<BiosInformationLayout::StartingSegment>(0);
 }
 
 uint32_t BiosInformationEntry::get_runtime_size() const
 {
-    if (nullptr == bios_information24_) {
+    if (!fields_.has<BiosInformationLayout::StartingSegment>()) {
         return 0;
     }
-    return static_cast<uint32_t>((0x10000 - bios_information24_->starting_segment) << 4);
+    return static_cast<uint32_t>((0x10000 - get_starting_address()) << 4);
 }
 
 uint8_t BiosInformationEntry::get_release_date_index() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->release_date;
+    return fields_.get<BiosInformationLayout::ReleaseDate>(0);
 }
 
 uint8_t BiosInformationEntry::get_rom_size() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
+    const uint8_t rom_size = fields_.get<BiosInformationLayout::RomSize>(0xFF);
 
     // see extended_rom_size then
-    if (0xFF == bios_information24_->rom_size) {
+    if (0xFF == rom_size) {
         return 0;
     }
 
-    return (bios_information24_->rom_size + 1) << 6;
+    return (rom_size + 1) << 6;
 }
 
 uint64_t BiosInformationEntry::get_properties() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->bios_properties;
+    return fields_.get<BiosInformationLayout::Properties>(0);
 }
 
 uint8_t BiosInformationEntry::get_properties_extension1() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->properties_extension1;
+    return fields_.get<BiosInformationLayout::PropertiesExtension1>(0);
 }
 
 uint8_t BiosInformationEntry::get_properties_extension2() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->properties_extension2;
+    return fields_.get<BiosInformationLayout::PropertiesExtension2>(0);
 }
 
 uint8_t BiosInformationEntry::get_bios_major_release() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->bios_major_version;
+    return fields_.get<BiosInformationLayout::BiosMajorVersion>(0);
 }
 
 uint8_t BiosInformationEntry::get_bios_minor_release() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->bios_minor_version;
+    return fields_.get<BiosInformationLayout::BiosMinorVersion>(0);
 }
 
 uint8_t BiosInformationEntry::get_firmware_major_release() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->firmware_major_version;
+    return fields_.get<BiosInformationLayout::FirmwareMajorVersion>(0);
 }
 
 uint8_t BiosInformationEntry::get_firmware_minor_release() const
 {
-    if (nullptr == bios_information24_) {
-        return 0;
-    }
-    return bios_information24_->firmware_minor_version;
+    return fields_.get<BiosInformationLayout::FirmwareMinorVersion>(0);
+}
+
+const BiosInformationEntry::StringValues& BiosInformationEntry::string_values()
+{
+    static const StringValues values = []() {
+        StringValues filled;
+        init_string_values(filled);
+        return filled;
+    }();
+    return values;
 }
 
-void BiosInformationEntry::init_string_values()
+void BiosInformationEntry::init_string_values(StringValues& values)
 {
-    properties_map_[BiosPropertiesOutOfSpec] = "OutOfSpec";
-    properties_map_[Reserved1] = "Reserved";
-    properties_map_[Reserved2] = "Reserved";
-    properties_map_[Unknown] = "Unknown";
-    properties_map_[NotSupported] = "BIOS characteristics not supported";
-    properties_map_[ISASupported] = "ISA is supported";
-    properties_map_[MCASupported] = "MCA is supported";
-    properties_map_[EISASupported] = "EISA is supported";
-    properties_map_[PCISupported] = "PCI is supported";
-    properties_map_[PCMCIASupported] = "PC Card (PCMCIA) is supported";
-    properties_map_[PnPSupported] = "PNP is supported";
-    properties_map_[APMSupported] = "APM is supported";
-    properties_map_[BIOSUpgradeable] = "BIOS is upgradeable";
-    properties_map_[BIOSShadowingAllowed] = "BIOS shadowing is allowed";
-    properties_map_[VLVESASupported] = "VLB is supported";
-    properties_map_[ESCDSupported] = "ESCD support is available";
-    properties_map_[BootFromCDSupported] = "Boot from CD is supported";
-    properties_map_[SelectableBootSupported] = "Selectable boot is supported";
-    properties_map_[BIOSROMSocketed] = "BIOS ROM is socketed";
-    properties_map_[BootFromPCMCIASupported] = "Boot from PC Card (PCMCIA) is supported";
-    properties_map_[EDDSpecificationSupported] = "EDD is supported";
-    properties_map_[FloppyNECSupported] = "Japanese floppy for NEC 9800 1.2 MB is supported (int 13h)";
-    properties_map_[FloppyToshibaSupported] = "Japanese floppy for Toshiba 1.2 MB is supported (int 13h)";
-    properties_map_[Floppy360kSupported] = "5.25\"/360 kB floppy services are supported (int 13h)";
-    properties_map_[Floppy12MSupported] = "5.25\"/1.2 MB floppy services are supported (int 13h)";
-    properties_map_[Floppy720kSupported] = "3.5\"/720 kB floppy services are supported (int 13h)";
-    properties_map_[Floppy28MSupported] = "3.5\"/2.88 MB floppy services are supported (int 13h)";
-    properties_map_[PrintScreenSupported] = "Print screen service is supported (int 5h)";
-    properties_map_[KeyboardServicesSupported] = "8042 keyboard services are supported (int 9h)";
-    properties_map_[SerialServicesSupported] = "Serial services are supported (int 14h)";
-    properties_map_[PrinterServicesSupported] = "Printer services are supported (int 17h)";
-    properties_map_[MonoVideoSupported] = "CGA/mono video services are supported (int 10h)";
-    properties_map_[NECPC] = "NEC PC-98";
-
-    properties_extensions1_map_[BiosPropertiesEx1OutOfSpec] = "OutOfSpec";
-    properties_extensions1_map_[ACPISupported] = "ACPI is supported";
-    properties_extensions1_map_[USBLegacySupported] = "USB Legacy is supported";
-    properties_extensions1_map_[AGPSupported] = "AGP is supported";
-    properties_extensions1_map_[I2OBootSupported] = "I2O boot is supported";
-    properties_extensions1_map_[SuperDiskBootSupported] = "LS-120 SuperDisk boot is supported";
-    properties_extensions1_map_[ZIPDriveBootSupported] = "ATAPI ZIP drive boot is supported";
-    properties_extensions1_map_[IEEE1394BootSupported] = "1394 boot is supported";
-    properties_extensions1_map_[SmartBatterySupported] = "Smart battery is supported";
-
-    properties_extensions2_map_[BiosPropertiesEx2OutOfSpec] = "OutOfSpec";
-    properties_extensions2_map_[BootSpecificationSupported] = "BIOS Boot Specification is supported";
-    properties_extensions2_map_[KeyInitiatedNetworkBoot] = "Function key-initiated network service boot is supported";
-    properties_extensions2_map_[TargetedContentDistribution] = "Enable targeted content distribution";
-    properties_extensions2_map_[UEFISpecificationSupported] = "UEFI Specification is supported";
-    properties_extensions2_map_[VirtualMachine] = "SMBIOS table describes a virtual machine";
+    values.properties_map[BiosPropertiesOutOfSpec] = "OutOfSpec";
+    values.properties_map[Reserved1] = "Reserved";
+    values.properties_map[Reserved2] = "Reserved";
+    values.properties_map[Unknown] = "Unknown";
+    values.properties_map[NotSupported] = "BIOS characteristics not supported";
+    values.properties_map[ISASupported] = "ISA is supported";
+    values.properties_map[MCASupported] = "MCA is supported";
+    values.properties_map[EISASupported] = "EISA is supported";
+    values.properties_map[PCISupported] = "PCI is supported";
+    values.properties_map[PCMCIASupported] = "PC Card (PCMCIA) is supported";
+    values.properties_map[PnPSupported] = "PNP is supported";
+    values.properties_map[APMSupported] = "APM is supported";
+    values.properties_map[BIOSUpgradeable] = "BIOS is upgradeable";
+    values.properties_map[BIOSShadowingAllowed] = "BIOS shadowing is allowed";
+    values.properties_map[VLVESASupported] = "VLB is supported";
+    values.properties_map[ESCDSupported] = "ESCD support is available";
+    values.properties_map[BootFromCDSupported] = "Boot from CD is supported";
+    values.properties_map[SelectableBootSupported] = "Selectable boot is supported";
+    values.properties_map[BIOSROMSocketed] = "BIOS ROM is socketed";
+    values.properties_map[BootFromPCMCIASupported] = "Boot from PC Card (PCMCIA) is supported";
+    values.properties_map[EDDSpecificationSupported] = "EDD is supported";
+    values.properties_map[FloppyNECSupported] = "Japanese floppy for NEC 9800 1.2 MB is supported (int 13h)";
+    values.properties_map[FloppyToshibaSupported] = "Japanese floppy for Toshiba 1.2 MB is supported (int 13h)";
+    values.properties_map[Floppy360kSupported] = "5.25\"/360 kB floppy services are supported (int 13h)";
+    values.properties_map[Floppy12MSupported] = "5.25\"/1.2 MB floppy services are supported (int 13h)";
+    values.properties_map[Floppy720kSupported] = "3.5\"/720 kB floppy services are supported (int 13h)";
+    values.properties_map[Floppy28MSupported] = "3.5\"/2.88 MB floppy services are supported (int 13h)";
+    values.properties_map[PrintScreenSupported] = "Print screen service is supported (int 5h)";
+    values.properties_map[KeyboardServicesSupported] = "8042 keyboard services are supported (int 9h)";
+    values.properties_map[SerialServicesSupported] = "Serial services are supported (int 14h)";
+    values.properties_map[PrinterServicesSupported] = "Printer services are supported (int 17h)";
+    values.properties_map[MonoVideoSupported] = "CGA/mono video services are supported (int 10h)";
+    values.properties_map[NECPC] = "NEC PC-98";
+
+    values.properties_extensions1_map[BiosPropertiesEx1OutOfSpec] = "OutOfSpec";
+    values.properties_extensions1_map[ACPISupported] = "ACPI is supported";
+    values.properties_extensions1_map[USBLegacySupported] = "USB Legacy is supported";
+    values.properties_extensions1_map[AGPSupported] = "AGP is supported";
+    values.properties_extensions1_map[I2OBootSupported] = "I2O boot is supported";
+    values.properties_extensions1_map[SuperDiskBootSupported] = "LS-120 SuperDisk boot is supported";
+    values.properties_extensions1_map[ZIPDriveBootSupported] = "ATAPI ZIP drive boot is supported";
+    values.properties_extensions1_map[IEEE1394BootSupported] = "1394 boot is supported";
+    values.properties_extensions1_map[SmartBatterySupported] = "Smart battery is supported";
+
+    values.properties_extensions2_map[BiosPropertiesEx2OutOfSpec] = "OutOfSpec";
+    values.properties_extensions2_map[BootSpecificationSupported] = "BIOS Boot Specification is supported";
+    values.properties_extensions2_map[KeyInitiatedNetworkBoot] = "Function key-initiated network service boot is supported";
+    values.properties_extensions2_map[TargetedContentDistribution] = "Enable targeted content distribution";
+    values.properties_extensions2_map[UEFISpecificationSupported] = "UEFI Specification is supported";
+    values.properties_extensions2_map[VirtualMachine] = "SMBIOS table describes a virtual machine";
 }
 
 
@@ -265,23 +235,23 @@ std::string BiosInformationEntry::get_runtime_size_string() const
 
 std::string BiosInformationEntry::get_properties_string() const
 {
-    assert(!properties_map_.empty());
+    assert(!string_values().properties_map.empty());
     const uint64_t properties = get_properties();
-    return AbstractSMBiosEntry::bitset_to_properties<uint64_t>(properties, properties_map_);
+    return AbstractSMBiosEntry::bitset_to_properties<uint64_t>(properties, string_values().properties_map);
 }
 
 std::string BiosInformationEntry::get_properties_extension1_string() const
 {
-    assert(!properties_extensions1_map_.empty());
+    assert(!string_values().properties_extensions1_map.empty());
     const uint8_t properties = get_properties_extension1();
-    return AbstractSMBiosEntry::bitset_to_properties<uint8_t>(properties, properties_extensions1_map_);
+    return AbstractSMBiosEntry::bitset_to_properties<uint8_t>(properties, string_values().properties_extensions1_map);
 }
 
 std::string BiosInformationEntry::get_properties_extension2_string() const
 {
-    assert(!properties_extensions2_map_.empty());
+    assert(!string_values().properties_extensions2_map.empty());
     const uint8_t properties = get_properties_extension2();
-    return AbstractSMBiosEntry::bitset_to_properties<uint8_t>(properties, properties_extensions2_map_);
+    return AbstractSMBiosEntry::bitset_to_properties<uint8_t>(properties, string_values().properties_extensions2_map);
 }
 
 std::string BiosInformationEntry::get_bios_version_string() const
@@ -0,0 +1,114 @@
+#include <smbios/bios_information_view.h>
+
+using namespace smbios;
+
+static_assert(sizeof(BiosInformationView) <= 16, "View should be small enough to be passed in registers");
+static_assert(std::is_trivially_copyable<BiosInformationView>::value, "View should be trivially copyable");
+
+constexpr uint8_t BiosInformationView::structure_type;
+
+BiosInformationView::BiosInformationView(const DMIHeader& header, const SMBiosVersion& version)
+    : SMBiosStructureView(header, version, BiosInformationLayout::revisions)
+{
+}
+
+std::string BiosInformationView::get_type() const
+{
+    return "BIOS Information";
+}
+
+uint8_t BiosInformationView::get_vendor_index() const
+{
+    return get<BiosInformationLayout::Vendor>(0);
+}
+
+uint8_t BiosInformationView::get_version_index() const
+{
+    return get<BiosInformationLayout::BiosVersion>(0);
+}
+
+uint16_t BiosInformationView::get_starting_address() const
+{
+    return get<BiosInformationLayout::StartingSegment>(0);
+}
+
+uint32_t BiosInformationView::get_runtime_size() const
+{
+    const uint16_t starting_segment = get_starting_address();
+    if (0 == starting_segment) {
+        return 0;
+    }
+    return static_cast<uint32_t>((0x10000 - starting_segment) << 4);
+}
+
+uint8_t BiosInformationView::get_release_date_index() const
+{
+    return get<BiosInformationLayout::ReleaseDate>(0);
+}
+
+uint32_t BiosInformationView::get_rom_size() const
+{
+    const uint8_t rom_size = get<BiosInformationLayout::RomSize>(0xFF);
+
+    // see extended_rom_size then
+    if (0xFF == rom_size) {
+        return 0;
+    }
+    // 64K * (n+1)
+    return (static_cast<uint32_t>(rom_size) + 1) << 6;
+}
+
+uint64_t BiosInformationView::get_properties() const
+{
+    return get<BiosInformationLayout::Properties>(0);
+}
+
+uint8_t BiosInformationView::get_properties_extension1() const
+{
+    return get<BiosInformationLayout::PropertiesExtension1>(0);
+}
+
+uint8_t BiosInformationView::get_properties_extension2() const
+{
+    return get<BiosInformationLayout::PropertiesExtension2>(0);
+}
+
+uint8_t BiosInformationView::get_bios_major_release() const
+{
+    return get<BiosInformationLayout::BiosMajorVersion>(0);
+}
+
+uint8_t BiosInformationView::get_bios_minor_release() const
+{
+    return get<BiosInformationLayout::BiosMinorVersion>(0);
+}
+
+uint8_t BiosInformationView::get_firmware_major_release() const
+{
+    return get<BiosInformationLayout::FirmwareMajorVersion>(0);
+}
+
+uint8_t BiosInformationView::get_firmware_minor_release() const
+{
+    return get<BiosInformationLayout::FirmwareMinorVersion>(0);
+}
+
+uint16_t BiosInformationView::get_extended_rom_size() const
+{
+    return get<BiosInformationLayout::ExtendedRomSize>(0);
+}
+
+boost::string_view BiosInformationView::get_vendor_string() const
+{
+    return dmi_string(get_vendor_index());
+}
+
+boost::string_view BiosInformationView::get_version_string() const
+{
+    return dmi_string(get_version_index());
+}
+
+boost::string_view BiosInformationView::get_release_date_string() const
+{
+    return dmi_string(get_release_date_index());
+}
@@ -0,0 +1,111 @@
+#include <smbios/cache_information_entry.h>
+#include <smbios/smbios.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t CacheInformationEntry::structure_type;
+
+constexpr SMBiosRevision CacheInformationLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<CacheInformationLayout::CurrentSramType>(
+    CacheInformationLayout::revisions), "2.0 layout");
+static_assert(field_in_revision<CacheInformationLayout::Associativity>(
+    CacheInformationLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<CacheInformationLayout::InstalledSize2>(
+    CacheInformationLayout::revisions), "3.1 layout");
+
+uint64_t smbios::cache_size_bytes(uint16_t size, uint32_t size2, bool size2_available)
+{
+    if (size2_available) {
+        const uint64_t units = size2 & 0x7FFFFFFF;
+        return (size2 & 0x80000000) ? units << 16 : units << 10;
+    }
+    const uint64_t units = size & 0x7FFF;
+    return (size & 0x8000) ? units << 16 : units << 10;
+}
+
+CacheInformationEntry::CacheInformationEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::CacheInformation) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Cache Information, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, CacheInformationLayout::revisions);
+}
+
+std::string CacheInformationEntry::get_type() const
+{
+    return "Cache Information";
+}
+
+void CacheInformationEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Socket Designation: " << dmi_string_view(fields_.get<CacheInformationLayout::SocketDesignation>(0)) << '\n';
+    out << "Level: L" << static_cast<unsigned>(get_level()) << '\n';
+    out << "Enabled: " << (is_enabled() ? "Yes" : "No") << '\n';
+    out << "Maximum Size: " << (get_maximum_size_bytes() >> 10) << " kB\n";
+    out << "Installed Size: " << (get_installed_size_bytes() >> 10) << " kB\n";
+    out << "Speed: " << static_cast<unsigned>(get_cache_speed()) << " ns\n";
+}
+
+uint16_t CacheInformationEntry::get_configuration() const
+{
+    return fields_.get<CacheInformationLayout::Configuration>(0);
+}
+
+uint8_t CacheInformationEntry::get_level() const
+{
+    // stored as level - 1
+    return static_cast<uint8_t>((get_configuration() & CacheLevelMask) + 1);
+}
+
+bool CacheInformationEntry::is_enabled() const
+{
+    return 0 != (get_configuration() & CacheEnabled);
+}
+
+uint64_t CacheInformationEntry::get_maximum_size_bytes() const
+{
+    return cache_size_bytes(fields_.get<CacheInformationLayout::MaximumSize>(0),
+        fields_.get<CacheInformationLayout::MaximumSize2>(0),
+        fields_.has<CacheInformationLayout::MaximumSize2>());
+}
+
+uint64_t CacheInformationEntry::get_installed_size_bytes() const
+{
+    return cache_size_bytes(fields_.get<CacheInformationLayout::InstalledSize>(0),
+        fields_.get<CacheInformationLayout::InstalledSize2>(0),
+        fields_.has<CacheInformationLayout::InstalledSize2>());
+}
+
+uint8_t CacheInformationEntry::get_cache_speed() const
+{
+    return fields_.get<CacheInformationLayout::CacheSpeed>(0);
+}
+
+uint8_t CacheInformationEntry::get_error_correction_type() const
+{
+    return fields_.get<CacheInformationLayout::ErrorCorrectionType>(0x02);
+}
+
+uint8_t CacheInformationEntry::get_system_cache_type() const
+{
+    return fields_.get<CacheInformationLayout::SystemCacheType>(0x02);
+}
+
+uint8_t CacheInformationEntry::get_associativity() const
+{
+    return fields_.get<CacheInformationLayout::Associativity>(0x02);
+}
+
+std::string CacheInformationEntry::get_socket_designation_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<CacheInformationLayout::SocketDesignation>(0));
+}
@@ -0,0 +1,265 @@
+#include <smbios/cbor.h>
+
+#include <stdexcept>
+
+using namespace smbios;
+
+namespace {
+
+constexpr uint8_t major_unsigned = 0;
+constexpr uint8_t major_negative = 1;
+constexpr uint8_t major_bytes = 2;
+constexpr uint8_t major_text = 3;
+constexpr uint8_t major_array = 4;
+constexpr uint8_t major_map = 5;
+constexpr uint8_t major_tag = 6;
+constexpr uint8_t major_simple = 7;
+
+/// Additional information values of the initial byte
+constexpr uint8_t argument_1_byte = 24;
+constexpr uint8_t argument_8_bytes = 27;
+constexpr uint8_t indefinite_length = 31;
+
+constexpr uint8_t break_code = 0xFF;
+
+[[noreturn]] void throw_malformed(const char* what)
+{
+    throw std::runtime_error(std::string("Malformed CBOR: ") + what);
+}
+
+} // namespace
+
+CborWriter::CborWriter(RenderBuffer& out) : out_(out)
+{
+}
+
+void CborWriter::head(uint8_t major, uint64_t argument)
+{
+    char encoded[9];
+    size_t size = 1;
+    const uint8_t major_bits = static_cast<uint8_t>(major << 5);
+    if (argument < argument_1_byte) {
+        encoded[0] = static_cast<char>(major_bits | argument);
+    }
+    else {
+        // 1, 2, 4 or 8 bytes of big-endian argument
+        size_t width = 8;
+        uint8_t additional = argument_8_bytes;
+        if (argument <= 0xFF) {
+            width = 1;
+            additional = argument_1_byte;
+        }
+        else if (argument <= 0xFFFF) {
+            width = 2;
+            additional = argument_1_byte + 1;
+        }
+        else if (argument <= 0xFFFFFFFFull) {
+            width = 4;
+            additional = argument_1_byte + 2;
+        }
+        encoded[0] = static_cast<char>(major_bits | additional);
+        for (size_t i = width; i > 0; --i, argument >>= 8) {
+            encoded[i] = static_cast<char>(argument & 0xFF);
+        }
+        size += width;
+    }
+    out_.append(encoded, size);
+}
+
+CborWriter& CborWriter::begin_array(uint64_t count)
+{
+    head(major_array, count);
+    return *this;
+}
+
+CborWriter& CborWriter::begin_map(uint64_t pairs)
+{
+    head(major_map, pairs);
+    return *this;
+}
+
+CborWriter& CborWriter::begin_array()
+{
+    out_ << static_cast<char>((major_array << 5) | indefinite_length);
+    return *this;
+}
+
+CborWriter& CborWriter::begin_map()
+{
+    out_ << static_cast<char>((major_map << 5) | indefinite_length);
+    return *this;
+}
+
+CborWriter& CborWriter::end()
+{
+    out_ << static_cast<char>(break_code);
+    return *this;
+}
+
+CborWriter& CborWriter::number(uint64_t value)
+{
+    head(major_unsigned, value);
+    return *this;
+}
+
+CborWriter& CborWriter::string(boost::string_view text)
+{
+    head(major_text, text.size());
+    out_.append(text.data(), text.size());
+    return *this;
+}
+
+CborWriter& CborWriter::bytes(const uint8_t* bytes, size_t size)
+{
+    head(major_bytes, size);
+    out_.append(reinterpret_cast<const char*>(bytes), size);
+    return *this;
+}
+
+CborWriter& CborWriter::boolean(bool value)
+{
+    head(major_simple, value ? cbor_true : cbor_false);
+    return *this;
+}
+
+CborWriter& CborWriter::null()
+{
+    head(major_simple, cbor_null);
+    return *this;
+}
+
+constexpr size_t CborReader::max_depth;
+
+CborReader::CborReader(const uint8_t* data, size_t size) : data_(data), size_(size)
+{
+}
+
+uint64_t CborReader::read_argument(uint8_t additional)
+{
+    if (additional < argument_1_byte) {
+        return additional;
+    }
+    if (additional > argument_8_bytes) {
+        throw_malformed("reserved additional information");
+    }
+    const size_t width = size_t(1) << (additional - argument_1_byte);
+    if (size_ - position_ < width) {
+        throw_malformed("truncated argument");
+    }
+    uint64_t argument = 0;
+    for (size_t i = 0; i < width; ++i) {
+        argument = (argument << 8) | data_[position_ + i];
+    }
+    position_ += width;
+    return argument;
+}
+
+CborItem CborReader::next()
+{
+    if (at_end()) {
+        throw_malformed("unexpected end of data");
+    }
+    const uint8_t initial = data_[position_++];
+    const uint8_t major = initial >> 5;
+    const uint8_t additional = initial & 0x1F;
+
+    CborItem item{ CborType::Unsigned, false, 0, nullptr };
+    if (indefinite_length == additional) {
+        switch (major) {
+        case major_array:
+            item.type = CborType::Array;
+            break;
+        case major_map:
+            item.type = CborType::Map;
+            break;
+        case major_simple:
+            item.type = CborType::Break;
+            return item;
+        case major_bytes:
+        case major_text:
+            throw_malformed("indefinite-length strings are not supported");
+        default:
+            throw_malformed("indefinite length of integer or tag");
+        }
+        item.indefinite = true;
+        return item;
+    }
+
+    item.value = read_argument(additional);
+    switch (major) {
+    case major_unsigned:
+        item.type = CborType::Unsigned;
+        break;
+    case major_negative:
+        item.type = CborType::Negative;
+        break;
+    case major_bytes:
+    case major_text:
+        item.type = major_bytes == major ? CborType::Bytes : CborType::Text;
+        if (size_ - position_ < item.value) {
+            throw_malformed("truncated string");
+        }
+        item.data = data_ + position_;
+        position_ += static_cast<size_t>(item.value);
+        break;
+    case major_array:
+        item.type = CborType::Array;
+        break;
+    case major_map:
+        item.type = CborType::Map;
+        break;
+    case major_tag:
+        item.type = CborType::Tag;
+        break;
+    default:
+        // 1-byte simple values, half, single and double precision floats
+        item.type = additional <= argument_1_byte ? CborType::Simple : CborType::Float;
+        break;
+    }
+    return item;
+}
+
+void CborReader::skip(const CborItem& item)
+{
+    skip(item, 0);
+}
+
+void CborReader::skip(const CborItem& item, size_t depth)
+{
+    if (item.type != CborType::Array && item.type != CborType::Map && item.type != CborType::Tag) {
+        return;
+    }
+    if (depth >= max_depth) {
+        throw_malformed("nesting is too deep");
+    }
+
+    if (CborType::Tag == item.type) {
+        const CborItem tagged = next();
+        if (CborType::Break == tagged.type) {
+            throw_malformed("unexpected break");
+        }
+        skip(tagged, depth + 1);
+        return;
+    }
+
+    if (item.indefinite) {
+        // map elements are not paired here, the break is only checked for
+        for (CborItem element = next(); element.type != CborType::Break; element = next()) {
+            skip(element, depth + 1);
+        }
+        return;
+    }
+
+    // every element takes at least a byte
+    if (item.value > size_ - position_) {
+        throw_malformed("truncated container");
+    }
+    const uint64_t elements = CborType::Map == item.type ? item.value * 2 : item.value;
+    for (uint64_t i = 0; i < elements; ++i) {
+        const CborItem element = next();
+        if (CborType::Break == element.type) {
+            throw_malformed("unexpected break");
+        }
+        skip(element, depth + 1);
+    }
+}
@@ -0,0 +1,416 @@
+#include <smbios/columnar_export.h>
+#include <smbios/smbios_schema.h>
+#include <smbios/smbios_field.h>
+
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+
+using namespace smbios;
+
+namespace {
+
+const uint8_t file_magic[4] = { 'S', 'M', 'B', 'C' };
+constexpr uint16_t file_format_version = 1;
+
+constexpr size_t file_header_size = 8;
+constexpr size_t index_entry_size = 32;
+constexpr size_t trailer_size = 16;
+
+void write_u16(std::vector<uint8_t>& out, uint16_t value)
+{
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+void write_u32(std::vector<uint8_t>& out, uint32_t value)
+{
+    write_u16(out, value & 0xFFFF);
+    write_u16(out, value >> 16);
+}
+
+void write_u64(std::vector<uint8_t>& out, uint64_t value)
+{
+    write_u32(out, value & 0xFFFFFFFF);
+    write_u32(out, value >> 32);
+}
+
+uint32_t read_u32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(load_uint(data, 4));
+}
+
+uint64_t read_u64(const uint8_t* data)
+{
+    return load_uint(data, 8);
+}
+
+size_t align8(size_t size)
+{
+    return (size + 7) & ~size_t(7);
+}
+
+void pad8(std::vector<uint8_t>& out)
+{
+    out.resize(align8(out.size()), 0);
+}
+
+size_t validity_size(uint32_t rows)
+{
+    return (static_cast<size_t>(rows) + 7) / 8;
+}
+
+/// Column of a single structure type being collected
+struct Column {
+    std::string name;
+    ColumnKind kind;
+    uint8_t width;
+
+    /// Schema field, nullptr for host, handle and length columns
+    const FieldSchema* field;
+
+    /// Bit per row
+    std::vector<uint8_t> validity;
+
+    /// Number and Bytes columns
+    std::vector<uint8_t> values;
+
+    /// String columns, views into the tables
+    std::vector<boost::string_view> strings;
+
+    void add_number(uint64_t value, bool present)
+    {
+        add_validity(present);
+        for (size_t i = 0; i < width; ++i) {
+            values.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void add_bytes(const uint8_t* bytes, bool present)
+    {
+        add_validity(present);
+        if (present) {
+            values.insert(values.end(), bytes, bytes + width);
+        }
+        else {
+            values.resize(values.size() + width, 0);
+        }
+    }
+
+    void add_string(boost::string_view text, bool present)
+    {
+        add_validity(present);
+        strings.push_back(present ? text : boost::string_view());
+    }
+
+    void add_validity(bool present)
+    {
+        const size_t row = strings.size() + (width ? values.size() / width : 0);
+        if (row % 8 == 0) {
+            validity.push_back(0);
+        }
+        if (present) {
+            validity.back() |= static_cast<uint8_t>(1u << (row % 8));
+        }
+    }
+};
+
+ColumnKind column_kind(const FieldSchema& field)
+{
+    switch (field.kind) {
+    case FieldKind::String:
+        return ColumnKind::String;
+    case FieldKind::Bytes:
+        return ColumnKind::Bytes;
+    default:
+        return ColumnKind::Number;
+    }
+}
+
+/// Codes and dictionary of the string column
+void write_strings(std::vector<uint8_t>& out, const Column& column)
+{
+    std::unordered_map<boost::string_view, uint32_t, boost::hash<boost::string_view>> codes;
+    std::vector<boost::string_view> dictionary;
+
+    for (const boost::string_view& text : column.strings) {
+        auto inserted = codes.emplace(text, static_cast<uint32_t>(dictionary.size()));
+        if (inserted.second) {
+            dictionary.push_back(text);
+        }
+        write_u32(out, inserted.first->second);
+    }
+
+    write_u32(out, static_cast<uint32_t>(dictionary.size()));
+    uint32_t offset = 0;
+    write_u32(out, offset);
+    for (const boost::string_view& text : dictionary) {
+        offset += static_cast<uint32_t>(text.size());
+        write_u32(out, offset);
+    }
+    for (const boost::string_view& text : dictionary) {
+        out.insert(out.end(), text.begin(), text.end());
+    }
+}
+
+} // namespace
+
+std::string smbios::column_name(boost::string_view field_name)
+{
+    std::string name;
+    name.reserve(field_name.size());
+    for (char c : field_name) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            name.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+        else if (!name.empty() && name.back() != '_') {
+            name.push_back('_');
+        }
+    }
+    while (!name.empty() && name.back() == '_') {
+        name.pop_back();
+    }
+    return name;
+}
+
+struct ColumnarExporter::TypeColumns {
+    uint32_t rows = 0;
+    std::vector<Column> columns;
+};
+
+ColumnarExporter::ColumnarExporter() = default;
+
+ColumnarExporter::~ColumnarExporter() = default;
+
+void ColumnarExporter::add_table(const SMBios& smbios, boost::string_view host)
+{
+    // host names are kept by the exporter, the caller's string could be temporary
+    hosts_.emplace_back(host.data(), host.size());
+    const boost::string_view host_name = hosts_.back();
+    const SMBiosVersion version = smbios.get_smbios_version();
+
+    for (const DMIHeader& header : smbios.get_headers()) {
+
+        const StructureSchema* schema = find_structure_schema(header.type);
+        std::unique_ptr<TypeColumns>& type_columns = types_[header.type];
+        if (!type_columns) {
+            type_columns.reset(new TypeColumns());
+            type_columns->columns.push_back(Column{ "host", ColumnKind::String, 0, nullptr, {}, {}, {} });
+            type_columns->columns.push_back(Column{ "handle", ColumnKind::Number, 2, nullptr, {}, {}, {} });
+            type_columns->columns.push_back(Column{ "length", ColumnKind::Number, 1, nullptr, {}, {}, {} });
+            for (size_t i = 0; schema && i < schema->fields_count; ++i) {
+                const FieldSchema& field = schema->fields[i];
+                const ColumnKind kind = column_kind(field);
+                type_columns->columns.push_back(Column{ column_name(field.name), kind,
+                    static_cast<uint8_t>(kind == ColumnKind::String ? 0 : field.width), &field, {}, {}, {} });
+            }
+        }
+
+        std::vector<Column>& columns = type_columns->columns;
+        columns[0].add_string(host_name, true);
+        columns[1].add_number(header.handle, true);
+        columns[2].add_number(header.length, true);
+        for (auto column = columns.begin() + 3; column != columns.end(); ++column) {
+            const FieldSchema& field = *column->field;
+            const bool present = field_available(field, header, version);
+            const DecodedField decoded = present ? decode_field(field, header) : DecodedField{ &field, 0, {}, nullptr };
+            switch (column->kind) {
+            case ColumnKind::String:
+                column->add_string(decoded.text, present);
+                break;
+            case ColumnKind::Bytes:
+                column->add_bytes(decoded.bytes, present);
+                break;
+            default:
+                column->add_number(decoded.value, present);
+                break;
+            }
+        }
+        ++type_columns->rows;
+    }
+}
+
+size_t ColumnarExporter::get_rows(uint8_t type) const
+{
+    return types_[type] ? types_[type]->rows : 0;
+}
+
+std::vector<uint8_t> ColumnarExporter::serialize() const
+{
+    std::vector<uint8_t> out(std::begin(file_magic), std::end(file_magic));
+    write_u16(out, file_format_version);
+    write_u16(out, 0);
+
+    std::vector<uint8_t> index;
+    std::string names;
+    uint32_t columns_count = 0;
+
+    for (size_t type = 0; type < 256; ++type) {
+        if (!types_[type]) {
+            continue;
+        }
+        const uint32_t rows = types_[type]->rows;
+        for (const Column& column : types_[type]->columns) {
+
+            pad8(out);
+            const size_t offset = out.size();
+            out.insert(out.end(), column.validity.begin(), column.validity.end());
+            pad8(out);
+            if (column.kind == ColumnKind::String) {
+                write_strings(out, column);
+            }
+            else {
+                out.insert(out.end(), column.values.begin(), column.values.end());
+            }
+
+            index.push_back(static_cast<uint8_t>(type));
+            index.push_back(static_cast<uint8_t>(column.kind));
+            index.push_back(column.kind == ColumnKind::String ? 4 : column.width);
+            index.push_back(0);
+            write_u32(index, rows);
+            write_u64(index, offset);
+            write_u64(index, out.size() - offset);
+            write_u32(index, static_cast<uint32_t>(names.size()));
+            write_u16(index, static_cast<uint16_t>(column.name.size()));
+            write_u16(index, 0);
+            names += column.name;
+            ++columns_count;
+        }
+    }
+
+    pad8(out);
+    const uint64_t index_offset = out.size();
+    out.insert(out.end(), index.begin(), index.end());
+    out.insert(out.end(), names.begin(), names.end());
+    write_u64(out, index_offset);
+    write_u32(out, columns_count);
+    out.insert(out.end(), std::begin(file_magic), std::end(file_magic));
+    return out;
+}
+
+ColumnView::ColumnView(ColumnKind kind, uint8_t width, uint32_t rows, const uint8_t* block, const uint8_t* block_end)
+    : kind_(kind), width_(width), rows_(rows)
+{
+    const size_t values_offset = align8(validity_size(rows));
+    const size_t values_size = static_cast<size_t>(rows) * width;
+    if (static_cast<size_t>(block_end - block) < values_offset + values_size) {
+        throw std::runtime_error("Column block is truncated");
+    }
+    validity_ = block;
+    values_ = block + values_offset;
+
+    if (kind == ColumnKind::String) {
+        if (width != 4) {
+            throw std::runtime_error("String column should have 4-byte codes");
+        }
+        const uint8_t* dictionary = values_ + values_size;
+        if (block_end - dictionary < 8) {
+            throw std::runtime_error("Column dictionary is truncated");
+        }
+        dictionary_size_ = read_u32(dictionary);
+        offsets_ = dictionary + 4;
+        const size_t offsets_count = static_cast<size_t>(dictionary_size_) + 1;
+        if (static_cast<size_t>(block_end - offsets_) / 4 < offsets_count) {
+            throw std::runtime_error("Column dictionary is truncated");
+        }
+        characters_ = reinterpret_cast<const char*>(offsets_ + offsets_count * 4);
+
+        // offsets are checked once, so get_string() could use any pair of them as is
+        const size_t characters_size = static_cast<size_t>(block_end - reinterpret_cast<const uint8_t*>(characters_));
+        uint32_t previous = 0;
+        for (size_t i = 0; i < offsets_count; ++i) {
+            const uint32_t offset = read_u32(offsets_ + i * 4);
+            if (offset < previous || offset > characters_size) {
+                throw std::runtime_error("Column dictionary offsets are corrupted");
+            }
+            previous = offset;
+        }
+    }
+}
+
+uint64_t ColumnView::get_number(uint32_t row) const
+{
+    if (!has_value(row)) {
+        return 0;
+    }
+    return load_uint(values_ + static_cast<size_t>(row) * width_, width_);
+}
+
+bool ColumnView::has_value(uint32_t row) const
+{
+    return row < rows_ && 0 != (validity_[row >> 3] & (1u << (row & 7)));
+}
+
+const uint8_t* ColumnView::get_bytes(uint32_t row) const
+{
+    if (row >= rows_) {
+        return nullptr;
+    }
+    return values_ + static_cast<size_t>(row) * width_;
+}
+
+boost::string_view ColumnView::get_string(uint32_t row) const
+{
+    if (!has_value(row)) {
+        return boost::string_view();
+    }
+    const uint32_t code = read_u32(values_ + static_cast<size_t>(row) * 4);
+    if (code >= dictionary_size_) {
+        return boost::string_view();
+    }
+    const uint32_t begin = read_u32(offsets_ + static_cast<size_t>(code) * 4);
+    const uint32_t end = read_u32(offsets_ + static_cast<size_t>(code + 1) * 4);
+    return boost::string_view(characters_ + begin, end - begin);
+}
+
+ColumnarReader::ColumnarReader(const uint8_t* data, size_t size)
+    : data_(data), size_(size), index_(nullptr), columns_count_(0)
+{
+    if (size < file_header_size + trailer_size ||
+        !std::equal(std::begin(file_magic), std::end(file_magic), data) ||
+        !std::equal(std::begin(file_magic), std::end(file_magic), data + size - 4)) {
+        throw std::runtime_error("Not a columnar SMBIOS export");
+    }
+    if (load_uint(data + 4, 2) != file_format_version) {
+        throw std::runtime_error("Unsupported columnar SMBIOS export version");
+    }
+
+    const uint8_t* trailer = data + size - trailer_size;
+    const uint64_t index_offset = read_u64(trailer);
+    columns_count_ = read_u32(trailer + 8);
+    if (index_offset > size - trailer_size ||
+        columns_count_ > (size - trailer_size - index_offset) / index_entry_size) {
+        throw std::runtime_error("Columnar SMBIOS export index is truncated");
+    }
+    index_ = data + index_offset;
+}
+
+ColumnView ColumnarReader::find_column(uint8_t type, boost::string_view name) const
+{
+    const char* names = reinterpret_cast<const char*>(index_ + columns_count_ * index_entry_size);
+    const size_t names_size = size_ - trailer_size - (index_ + columns_count_ * index_entry_size - data_);
+
+    for (size_t i = 0; i < columns_count_; ++i) {
+        const uint8_t* entry = index_ + i * index_entry_size;
+        if (entry[0] != type) {
+            continue;
+        }
+        const uint32_t name_offset = read_u32(entry + 24);
+        const uint16_t name_length = static_cast<uint16_t>(load_uint(entry + 28, 2));
+        if (static_cast<size_t>(name_offset) + name_length > names_size ||
+            boost::string_view(names + name_offset, name_length) != name) {
+            continue;
+        }
+
+        const uint64_t offset = read_u64(entry + 8);
+        const uint64_t block_size = read_u64(entry + 16);
+        if (offset > static_cast<size_t>(index_ - data_) || block_size > static_cast<size_t>(index_ - data_) - offset) {
+            throw std::runtime_error("Column block is out of the file");
+        }
+        const uint8_t* block = data_ + offset;
+        return ColumnView(static_cast<ColumnKind>(entry[1]), entry[2], read_u32(entry + 4), block, block + block_size);
+    }
+    return ColumnView();
+}
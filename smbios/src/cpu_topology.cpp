@@ -0,0 +1,179 @@
+#include <smbios/cpu_topology.h>
+#include <smbios/smbios.h>
+#include <smbios/handle_graph.h>
+#include <smbios/processor_information_entry.h>
+#include <smbios/cache_information_entry.h>
+#include <smbios/render_buffer.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace smbios;
+
+namespace {
+
+constexpr uint8_t binary_magic[] = { 'C', 'P', 'U', 'T' };
+constexpr uint8_t binary_format_version = 1;
+constexpr size_t binary_header_size = 8;
+constexpr size_t binary_socket_size = 26;
+
+void write_u16(std::vector<uint8_t>& out, uint16_t value)
+{
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+void write_u32(std::vector<uint8_t>& out, uint32_t value)
+{
+    write_u16(out, value & 0xFFFF);
+    write_u16(out, value >> 16);
+}
+
+uint16_t read_u16(const uint8_t* data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+uint32_t read_u32(const uint8_t* data)
+{
+    return read_u16(data) | (uint32_t(read_u16(data + 2)) << 16);
+}
+
+/// Kilobytes, saturated to 32 bits
+uint32_t to_kilobytes(uint64_t size)
+{
+    const uint64_t kilobytes = size >> 10;
+    return kilobytes > 0xFFFFFFFF ? 0xFFFFFFFF : static_cast<uint32_t>(kilobytes);
+}
+
+void add_to_totals(CpuTopology& topology, const CpuSocketSummary& socket)
+{
+    if (socket.populated) {
+        ++topology.populated_sockets;
+        topology.cores += socket.cores;
+        topology.threads += socket.threads;
+    }
+}
+
+} // namespace
+
+CpuTopology smbios::summarize_cpu_topology(const SMBios& smbios)
+{
+    CpuTopology topology;
+
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    const HandleGraph& graph = smbios.handle_graph();
+    for (size_t i = 0; i < headers.size(); ++i) {
+        if (headers[i].type != SMBios::ProcessorInformation) {
+            continue;
+        }
+
+        const auto processor = static_cast<const ProcessorInformationEntry*>(smbios.entry(i));
+        CpuSocketSummary socket{ headers[i].handle, processor->is_populated(),
+            processor->get_core_count(), processor->get_core_enabled(), processor->get_thread_count(),
+            processor->get_max_speed(), processor->get_current_speed(), 0, 0, 0 };
+
+        // processor refers to its caches only
+        for (uint32_t cache_index : graph.get_references(i)) {
+            if (headers[cache_index].type != SMBios::CacheInformation) {
+                continue;
+            }
+            const auto cache = static_cast<const CacheInformationEntry*>(smbios.entry(cache_index));
+            switch (cache->get_level()) {
+            case 1:
+                socket.l1_cache_size += cache->get_installed_size_bytes();
+                break;
+            case 2:
+                socket.l2_cache_size += cache->get_installed_size_bytes();
+                break;
+            case 3:
+                socket.l3_cache_size += cache->get_installed_size_bytes();
+                break;
+            default:
+                break;
+            }
+        }
+
+        add_to_totals(topology, socket);
+        topology.sockets.push_back(socket);
+    }
+    return topology;
+}
+
+std::vector<uint8_t> smbios::serialize_cpu_topology(const CpuTopology& topology)
+{
+    if (topology.sockets.size() > 0xFFFF) {
+        throw std::runtime_error("Too many processor sockets to serialize");
+    }
+
+    std::vector<uint8_t> out;
+    out.reserve(binary_header_size + topology.sockets.size() * binary_socket_size);
+    out.insert(out.end(), std::begin(binary_magic), std::end(binary_magic));
+    out.push_back(binary_format_version);
+    out.push_back(0);
+    write_u16(out, static_cast<uint16_t>(topology.sockets.size()));
+
+    for (const CpuSocketSummary& socket : topology.sockets) {
+        write_u16(out, socket.handle);
+        out.push_back(socket.populated ? 1 : 0);
+        out.push_back(0);
+        write_u16(out, socket.cores);
+        write_u16(out, socket.cores_enabled);
+        write_u16(out, socket.threads);
+        write_u16(out, socket.max_speed);
+        write_u16(out, socket.current_speed);
+        write_u32(out, to_kilobytes(socket.l1_cache_size));
+        write_u32(out, to_kilobytes(socket.l2_cache_size));
+        write_u32(out, to_kilobytes(socket.l3_cache_size));
+    }
+    return out;
+}
+
+CpuTopology smbios::deserialize_cpu_topology(const uint8_t* data, size_t size)
+{
+    if (size < binary_header_size || !std::equal(std::begin(binary_magic), std::end(binary_magic), data)) {
+        throw std::runtime_error("Not a CPU topology binary");
+    }
+    if (data[4] != binary_format_version) {
+        throw std::runtime_error("Unsupported CPU topology binary version");
+    }
+
+    const size_t sockets_count = read_u16(data + 6);
+    if (size != binary_header_size + sockets_count * binary_socket_size) {
+        throw std::runtime_error("CPU topology binary is truncated");
+    }
+
+    CpuTopology topology;
+    topology.sockets.reserve(sockets_count);
+    for (const uint8_t* record = data + binary_header_size; record != data + size; record += binary_socket_size) {
+        CpuSocketSummary socket{ read_u16(record), record[2] != 0,
+            read_u16(record + 4), read_u16(record + 6), read_u16(record + 8),
+            read_u16(record + 10), read_u16(record + 12),
+            uint64_t(read_u32(record + 14)) << 10, uint64_t(read_u32(record + 18)) << 10,
+            uint64_t(read_u32(record + 22)) << 10 };
+        add_to_totals(topology, socket);
+        topology.sockets.push_back(socket);
+    }
+    return topology;
+}
+
+std::string smbios::render_cpu_topology(const CpuTopology& topology)
+{
+    RenderBuffer decsription;
+    render_cpu_topology(topology, decsription);
+    return decsription.str();
+}
+
+void smbios::render_cpu_topology(const CpuTopology& topology, RenderBuffer& out)
+{
+    out << "sockets=" << topology.populated_sockets << " cores=" << topology.cores
+        << " threads=" << topology.threads << '\n';
+
+    for (const CpuSocketSummary& socket : topology.sockets) {
+        out << "socket handle=" << socket.handle << " populated=" << (socket.populated ? 1 : 0)
+            << " cores=" << socket.cores << " cores_enabled=" << socket.cores_enabled
+            << " threads=" << socket.threads << " max_mhz=" << socket.max_speed
+            << " current_mhz=" << socket.current_speed << " l1_kb=" << (socket.l1_cache_size >> 10)
+            << " l2_kb=" << (socket.l2_cache_size >> 10) << " l3_kb=" << (socket.l3_cache_size >> 10) << '\n';
+    }
+}
@@ -0,0 +1,156 @@
+#include <smbios/csv_export.h>
+#include <smbios/columnar_export.h>
+#include <smbios/smbios_schema.h>
+
+#include <string>
+
+using namespace smbios;
+
+namespace {
+
+/// Per-symbol escaping: CSV - cell has to be quoted, TSV - symbol after backslash or 0
+struct DelimitedEscapeTable {
+    bool csv_quote[256];
+    char tsv_escape[256];
+
+    constexpr DelimitedEscapeTable() : csv_quote(), tsv_escape()
+    {
+        csv_quote[static_cast<size_t>(',')] = true;
+        csv_quote[static_cast<size_t>('"')] = true;
+        csv_quote[static_cast<size_t>('\n')] = true;
+        csv_quote[static_cast<size_t>('\r')] = true;
+
+        tsv_escape[static_cast<size_t>('\t')] = 't';
+        tsv_escape[static_cast<size_t>('\n')] = 'n';
+        tsv_escape[static_cast<size_t>('\r')] = 'r';
+        tsv_escape[static_cast<size_t>('\\')] = '\\';
+    }
+};
+
+constexpr DelimitedEscapeTable escape_table;
+
+void append_csv(RenderBuffer& out, boost::string_view text)
+{
+    const char* const end = text.data() + text.size();
+    const char* current = text.data();
+    while (current != end && !escape_table.csv_quote[static_cast<uint8_t>(*current)]) {
+        ++current;
+    }
+    if (current == end) {
+        out << text;
+        return;
+    }
+
+    // quoted cell, quotes are doubled
+    out << '"';
+    const char* run = text.data();
+    for (; current != end; ++current) {
+        if (*current == '"') {
+            out.append(run, current - run + 1);
+            run = current;
+        }
+    }
+    out.append(run, end - run);
+    out << '"';
+}
+
+void append_tsv(RenderBuffer& out, boost::string_view text)
+{
+    const char* run = text.data();
+    const char* const end = text.data() + text.size();
+    for (const char* current = run; current != end; ++current) {
+        const char escape = escape_table.tsv_escape[static_cast<uint8_t>(*current)];
+        if (0 == escape) {
+            continue;
+        }
+        out.append(run, current - run);
+        run = current + 1;
+        const char escaped[] = { '\\', escape };
+        out.append(escaped, sizeof(escaped));
+    }
+    out.append(run, end - run);
+}
+
+} // namespace
+
+CsvExporter::CsvExporter(uint8_t type, DelimitedFormat format, bool host_column) :
+    type_(type),
+    format_(format),
+    host_column_(host_column),
+    separator_(format == DelimitedFormat::Csv ? ',' : '\t')
+{
+}
+
+void CsvExporter::append_text(RenderBuffer& out, boost::string_view text) const
+{
+    if (format_ == DelimitedFormat::Csv) {
+        append_csv(out, text);
+    }
+    else {
+        append_tsv(out, text);
+    }
+}
+
+void CsvExporter::append_missing(RenderBuffer& out) const
+{
+    if (format_ == DelimitedFormat::Tsv) {
+        out.append("\\N", 2);
+    }
+}
+
+void CsvExporter::render_header(RenderBuffer& out) const
+{
+    if (host_column_) {
+        out << "host" << separator_;
+    }
+    out << "handle" << separator_ << "length";
+
+    if (const StructureSchema* schema = find_structure_schema(type_)) {
+        for (uint8_t field = 0; field < schema->fields_count; ++field) {
+            out << separator_ << column_name(schema->fields[field].name);
+        }
+    }
+    out << '\n';
+}
+
+size_t CsvExporter::render_rows(const SMBios& smbios, boost::string_view host, RenderBuffer& out) const
+{
+    const StructureSchema* schema = find_structure_schema(type_);
+    const SMBiosVersion version = smbios.get_smbios_version();
+
+    // bitfield names are joined before escaping, the whole cell may need quotes
+    std::string bit_names;
+
+    size_t rows = 0;
+    for (const DMIHeader& header : smbios.get_headers()) {
+        if (header.type != type_) {
+            continue;
+        }
+        ++rows;
+
+        if (host_column_) {
+            append_text(out, host);
+            out << separator_;
+        }
+        out << header.handle << separator_ << header.length;
+
+        if (!schema) {
+            out << '\n';
+            continue;
+        }
+
+        const FieldSchema* const fields_end = schema->fields + schema->fields_count;
+        for (const FieldSchema* field = schema->fields; field != fields_end; ++field) {
+            out << separator_;
+            if (!field_available(*field, header, version)) {
+                append_missing(out);
+                continue;
+            }
+
+            append_field_value(out, decode_field(*field, header), bit_names,
+                [this](RenderBuffer& text_out, boost::string_view text) { append_text(text_out, text); });
+        }
+        out << '\n';
+    }
+    return rows;
+}
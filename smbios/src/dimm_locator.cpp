@@ -0,0 +1,241 @@
+#include <smbios/dimm_locator.h>
+#include <smbios/memory_device_view.h>
+#include <smbios/memory_device_entry.h>
+
+#include <stdexcept>
+
+using namespace smbios;
+
+namespace {
+
+constexpr uint8_t max_coordinate = DimmCoordinates::unknown - 1;
+
+bool is_separator(char c)
+{
+    return c == ' ' || c == '_' || c == '-';
+}
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool is_letter(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+char to_upper(char c)
+{
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+}
+
+/// Decimal number of exactly 'digits' digits, false if above the coordinate range
+bool read_number(boost::string_view text, size_t position, size_t digits, uint8_t& value)
+{
+    unsigned number = 0;
+    for (size_t i = 0; i < digits; ++i) {
+        number = number * 10 + (text[position + i] - '0');
+    }
+    if (number > max_coordinate) {
+        return false;
+    }
+    value = static_cast<uint8_t>(number);
+    return true;
+}
+
+/// Length of the digit run at position, at most 'max_digits'
+size_t count_digits(boost::string_view text, size_t position, size_t max_digits)
+{
+    size_t digits = 0;
+    while (position + digits < text.size() && digits < max_digits && is_digit(text[position + digits])) {
+        ++digits;
+    }
+    return digits;
+}
+
+bool is_field(boost::string_view pattern, size_t position)
+{
+    return position + 2 < pattern.size() && pattern[position] == '{' && pattern[position + 2] == '}';
+}
+
+/// Pattern syntax check, so that matching does not need any
+void validate_pattern(boost::string_view pattern)
+{
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        if (pattern[i] == '{') {
+            if (!is_field(pattern, i) || (pattern[i + 1] != 's' && pattern[i + 1] != 'c' && pattern[i + 1] != 'd')) {
+                throw std::invalid_argument("Malformed DIMM locator pattern: " + pattern.to_string());
+            }
+            i += 2;
+        }
+        else if (pattern[i] == '}') {
+            throw std::invalid_argument("Malformed DIMM locator pattern: " + pattern.to_string());
+        }
+    }
+}
+
+bool match_from(boost::string_view pattern, size_t p, boost::string_view text, size_t t,
+    DimmCoordinates& coordinates);
+
+/// Numeric field at t: the longest digit run first, shorter ones if the rest of the pattern does not match
+/// ('CPU{s}{d}' splits '112' as 11 and 2)
+bool match_number(boost::string_view pattern, size_t p, boost::string_view text, size_t t,
+    DimmCoordinates& coordinates, uint8_t DimmCoordinates::*field)
+{
+    for (size_t digits = count_digits(text, t, 3); digits != 0; --digits) {
+        DimmCoordinates matched = coordinates;
+        if (read_number(text, t, digits, matched.*field) && match_from(pattern, p, text, t + digits, matched)) {
+            coordinates = matched;
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Match pattern[p..] against text[t..], coordinates are left untouched on failure
+bool match_from(boost::string_view pattern, size_t p, boost::string_view text, size_t t,
+    DimmCoordinates& coordinates)
+{
+    DimmCoordinates matched = coordinates;
+
+    while (p < pattern.size()) {
+        const char pattern_char = pattern[p];
+
+        if (pattern_char == ' ') {
+            while (t < text.size() && is_separator(text[t])) {
+                ++t;
+            }
+            ++p;
+            continue;
+        }
+
+        if (is_field(pattern, p)) {
+            const char field = pattern[p + 1];
+            p += 3;
+
+            if (field == 's' || field == 'd') {
+                if (!match_number(pattern, p, text, t, matched, field == 's' ? &DimmCoordinates::socket : &DimmCoordinates::slot)) {
+                    return false;
+                }
+                coordinates = matched;
+                return true;
+            }
+
+            // channel letter; a numeric channel next to another field is ambiguous ('DIMM 12')
+            if (t < text.size() && is_letter(text[t])) {
+                matched.channel = static_cast<uint8_t>(to_upper(text[t]) - 'A');
+                ++t;
+                continue;
+            }
+            if (is_field(pattern, p) || !match_number(pattern, p, text, t, matched, &DimmCoordinates::channel)) {
+                return false;
+            }
+            coordinates = matched;
+            return true;
+        }
+
+        if (t >= text.size() || to_upper(text[t]) != to_upper(pattern_char)) {
+            return false;
+        }
+        ++p;
+        ++t;
+    }
+
+    // trailing separators are ignored
+    while (t < text.size() && is_separator(text[t])) {
+        ++t;
+    }
+    if (t != text.size()) {
+        return false;
+    }
+
+    coordinates = matched;
+    return true;
+}
+
+} // namespace
+
+constexpr uint8_t DimmCoordinates::unknown;
+
+bool smbios::match_locator_pattern(boost::string_view pattern, boost::string_view text, DimmCoordinates& coordinates)
+{
+    return match_from(pattern, 0, text, 0, coordinates);
+}
+
+DimmLocatorParser::DimmLocatorParser() : patterns_(get_default_patterns())
+{
+}
+
+DimmLocatorParser::DimmLocatorParser(const std::vector<DimmLocatorPattern>& patterns)
+{
+    for (auto it = patterns.rbegin(); it != patterns.rend(); ++it) {
+        add_pattern(*it);
+    }
+}
+
+const std::vector<DimmLocatorPattern>& DimmLocatorParser::get_default_patterns()
+{
+    static const std::vector<DimmLocatorPattern> patterns = {
+        // CPU1_DIMM_A2, CPU0_DIMM_B1
+        { "CPU{s} DIMM {c}{d}", "" },
+        // CPU1 DIMM 12
+        { "CPU{s} DIMM {d}", "" },
+        // P1-DIMMA1 (Supermicro)
+        { "P{s} DIMM {c}{d}", "" },
+        // CPU0_CHANNEL1_DIMM0
+        { "CPU{s} CHANNEL {c} DIMM {d}", "" },
+        // P0 CHANNEL B DIMM 1
+        { "P{s} CHANNEL {c} DIMM {d}", "" },
+        // 'DIMM 1' in bank 'P0 CHANNEL B' (AMD reference firmware)
+        { "DIMM {d}", "P{s} CHANNEL {c}" },
+        // 'DIMM_A1' in bank 'NODE 1' (Intel reference firmware)
+        { "DIMM {c}{d}", "NODE {s}" },
+        // PROC 1 DIMM 3 (HPE)
+        { "PROC {s} DIMM {d}", "" },
+        // ChannelC-DIMM0
+        { "CHANNEL {c} DIMM {d}", "" },
+        // DIMM_A1, DIMMB2
+        { "DIMM {c}{d}", "" },
+        // A1, B2 (Dell)
+        { "{c}{d}", "" }
+    };
+    return patterns;
+}
+
+void DimmLocatorParser::add_pattern(const DimmLocatorPattern& pattern)
+{
+    if (pattern.device_locator.empty() && pattern.bank_locator.empty()) {
+        throw std::invalid_argument("DIMM locator pattern should not be empty");
+    }
+    validate_pattern(pattern.device_locator);
+    validate_pattern(pattern.bank_locator);
+    patterns_.insert(patterns_.begin(), pattern);
+}
+
+bool DimmLocatorParser::parse(boost::string_view device_locator, boost::string_view bank_locator,
+    DimmCoordinates& coordinates) const
+{
+    for (const DimmLocatorPattern& pattern : patterns_) {
+        DimmCoordinates matched;
+        if (!pattern.bank_locator.empty() && !match_locator_pattern(pattern.bank_locator, bank_locator, matched)) {
+            continue;
+        }
+        if (!pattern.device_locator.empty() && !match_locator_pattern(pattern.device_locator, device_locator, matched)) {
+            continue;
+        }
+        coordinates = matched;
+        return true;
+    }
+    return false;
+}
+
+bool DimmLocatorParser::parse(const MemoryDeviceView& device, DimmCoordinates& coordinates) const
+{
+    return parse(device.get_device_locator_string(), device.get_bank_locator_string(), coordinates);
+}
+
+bool DimmLocatorParser::parse(const MemoryDeviceEntry& device, DimmCoordinates& coordinates) const
+{
+    return parse(device.get_device_locator_view(), device.get_bank_locator_view(), coordinates);
+}
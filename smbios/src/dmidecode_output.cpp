@@ -0,0 +1,1550 @@
+#include <smbios/dmidecode_output.h>
+#include <smbios/smbios_schema.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <boost/algorithm/string/predicate.hpp>
+
+using namespace smbios;
+
+namespace {
+
+const char out_of_spec[] = "<OUT OF SPEC>";
+
+inline uint16_t word(const uint8_t* data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+inline uint32_t dword(const uint8_t* data)
+{
+    return word(data) | (uint32_t(word(data + 2)) << 16);
+}
+
+inline uint64_t qword(const uint8_t* data)
+{
+    return dword(data) | (uint64_t(dword(data + 4)) << 32);
+}
+
+/// dmidecode prints hex in upper case, RenderBuffer does it in lower case
+void append_upper_hex(RenderBuffer& out, uint64_t value, unsigned width)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    char text[16];
+    unsigned count = 0;
+    do {
+        text[15 - count++] = digits[value & 0x0F];
+        value >>= 4;
+    } while (value && count < 16);
+    while (count < width && count < 16) {
+        text[15 - count++] = '0';
+    }
+    out.append(text + 16 - count, count);
+}
+
+inline void append_handle(RenderBuffer& out, uint16_t handle)
+{
+    out << "0x";
+    append_upper_hex(out, handle, 4);
+}
+
+/// Name of the consecutive value range starting at 'first'
+template <size_t N>
+const char* range_name(const char* const (&names)[N], unsigned value, unsigned first = 1)
+{
+    return value >= first && value - first < N ? names[value - first] : out_of_spec;
+}
+
+/// The size in the largest unit which keeps it exact, as dmi_print_memory_size() does
+/// shift is 1 for codes in kB, 0 for codes in bytes
+void append_memory_size(RenderBuffer& out, uint64_t code, unsigned shift)
+{
+    static const char* const units[] = { "bytes", "kB", "MB", "GB", "TB", "PB", "EB", "ZB" };
+
+    unsigned split[7];
+    for (unsigned unit = 0; unit < 6; ++unit) {
+        split[unit] = static_cast<unsigned>((code >> (10 * unit)) & 0x3FF);
+    }
+    split[6] = static_cast<unsigned>(code >> 60);
+
+    unsigned unit = 6;
+    while (unit > 0 && !split[unit]) {
+        --unit;
+    }
+    uint64_t capacity = split[unit];
+    if (unit > 0 && split[unit - 1]) {
+        --unit;
+        capacity = split[unit] + (uint64_t(split[unit + 1]) << 10);
+    }
+    out << capacity << ' ' << units[unit + shift];
+}
+
+/// Millivolts as %g does: 1.2 V, 1.35 V
+void append_millivolts(RenderBuffer& out, uint16_t code)
+{
+    out << unsigned(code / 1000) << '.';
+    unsigned fraction = code % 1000;
+    if (fraction % 100 == 0) {
+        out << fraction / 100;
+    }
+    else {
+        unsigned divisor = 100;
+        while (fraction) {
+            out << fraction / divisor;
+            fraction %= divisor;
+            divisor /= 10;
+        }
+    }
+    out << " V";
+}
+
+/// Formatted area and strings of the structure being printed
+class StructurePrinter {
+public:
+
+    StructurePrinter(const DMIHeader& header, RenderBuffer& target) :
+        data(header.data),
+        length(header.length),
+        out(target)
+    {
+        for (const boost::string_view text : DmiStrings(header)) {
+            if (strings_count_ == 255) {
+                break;
+            }
+            strings_[strings_count_++] = text;
+        }
+    }
+
+    /// dmi_string(): control symbols are replaced with dots
+    void string(uint8_t string_index)
+    {
+        if (0 == string_index) {
+            out << "Not Specified";
+            return;
+        }
+        if (string_index > strings_count_) {
+            out << "<BAD INDEX>";
+            return;
+        }
+        const char* text = strings_[string_index - 1].data();
+        const size_t text_length = strings_[string_index - 1].size();
+        const bool printable = std::none_of(text, text + text_length, [](char c) {
+            return static_cast<uint8_t>(c) < 0x20 || c == 0x7F;
+        });
+        if (printable) {
+            out.append(text, text_length);
+            return;
+        }
+        for (size_t i = 0; i < text_length; ++i) {
+            out << (static_cast<uint8_t>(text[i]) < 0x20 || text[i] == 0x7F ? '.' : text[i]);
+        }
+    }
+
+    /// Raw string, empty if there is no such one
+    boost::string_view raw_string(uint8_t string_index) const
+    {
+        if (0 == string_index || string_index > strings_count_) {
+            return boost::string_view();
+        }
+        return strings_[string_index - 1];
+    }
+
+    size_t strings_count() const { return strings_count_; }
+
+    /// Start of "\tName: value" line
+    RenderBuffer& attr(const char* name)
+    {
+        out << '\t' << name << ": ";
+        return out;
+    }
+
+    void string_attr(const char* name, uint8_t offset)
+    {
+        attr(name);
+        string(data[offset]);
+        out << '\n';
+    }
+
+    void text_attr(const char* name, const char* value)
+    {
+        attr(name) << value << '\n';
+    }
+
+    void handle_attr(const char* name, uint8_t offset)
+    {
+        append_handle(attr(name), word(data + offset));
+        out << '\n';
+    }
+
+    void list(const char* name)
+    {
+        out << '\t' << name << ":\n";
+    }
+
+    void item(const char* value)
+    {
+        out << "\t\t" << value << '\n';
+    }
+
+public:
+
+    const uint8_t* data;
+    uint8_t length;
+    RenderBuffer& out;
+
+private:
+
+    boost::string_view strings_[255];
+    size_t strings_count_ = 0;
+};
+
+/// Names of the bits set in the code, joined with spaces, or "None"
+template <size_t N>
+void flat_bit_names(StructurePrinter& p, const char* name, uint32_t code, const char* const (&names)[N], unsigned first_bit)
+{
+    RenderBuffer& out = p.attr(name);
+    bool any = false;
+    for (unsigned bit = first_bit; bit < first_bit + N; ++bit) {
+        if (code & (uint32_t(1) << bit)) {
+            out << (any ? " " : "") << names[bit - first_bit];
+            any = true;
+        }
+    }
+    out << (any ? "" : "None") << '\n';
+}
+
+/// Names of the bits set in the code, one list item per bit, or "None"
+template <size_t N>
+void listed_bit_names(StructurePrinter& p, const char* name, uint32_t code, const char* const (&names)[N], unsigned first_bit)
+{
+    const uint32_t mask = ((uint32_t(1) << N) - 1) << first_bit;
+    if (!(code & mask)) {
+        p.text_attr(name, "None");
+        return;
+    }
+    p.list(name);
+    for (unsigned bit = first_bit; bit < first_bit + N; ++bit) {
+        if (code & (uint32_t(1) << bit)) {
+            p.item(names[bit - first_bit]);
+        }
+    }
+}
+
+/// Name of the enumerated field of the library schema, dmidecode spells them the same way
+const char* schema_name(uint8_t type, uint8_t offset, uint16_t value)
+{
+    const StructureSchema* schema = find_structure_schema(type);
+    const FieldSchema* field = schema ? find_field_schema(*schema, offset) : nullptr;
+    const char* name = field ? find_field_name(*field, value) : nullptr;
+    return name ? name : out_of_spec;
+}
+
+/// Short names of structure types, used by chassis contained elements
+const char* structure_type_name(uint8_t type)
+{
+    static const char* const names[] = {
+        "BIOS", "System", "Base Board", "Chassis", "Processor", "Memory Controller", "Memory Module",
+        "Cache", "Port Connector", "System Slots", "On Board Devices", "OEM Strings",
+        "System Configuration Options", "BIOS Language", "Group Associations", "System Event Log",
+        "Physical Memory Array", "Memory Device", "32-bit Memory Error", "Memory Array Mapped Address",
+        "Memory Device Mapped Address", "Built-in Pointing Device", "Portable Battery", "System Reset",
+        "Hardware Security", "System Power Controls", "Voltage Probe", "Cooling Device",
+        "Temperature Probe", "Electrical Current Probe", "Out-of-band Remote Access",
+        "Boot Integrity Services", "System Boot", "64-bit Memory Error", "Management Device",
+        "Management Device Component", "Management Device Threshold Data", "Memory Channel",
+        "IPMI Device", "Power Supply", "Additional Information", "Onboard Device",
+        "Management Controller Host Interface", "TPM Device", "Processor Additional Information",
+        "Firmware", "String Property"
+    };
+    return range_name(names, type, 0);
+}
+
+const char* baseboard_type_name(uint8_t type)
+{
+    static const char* const names[] = {
+        "Unknown", "Other", "Server Blade", "Connectivity Switch", "System Management Module",
+        "Processor Module", "I/O Module", "Memory Module", "Daughter Board", "Motherboard",
+        "Processor+Memory Module", "Processor+I/O Module", "Interconnect Board"
+    };
+    return range_name(names, type);
+}
+
+const char* chassis_type_name(uint8_t type)
+{
+    static const char* const names[] = {
+        "Other", "Unknown", "Desktop", "Low Profile Desktop", "Pizza Box", "Mini Tower", "Tower",
+        "Portable", "Laptop", "Notebook", "Hand Held", "Docking Station", "All In One", "Sub Notebook",
+        "Space-saving", "Lunch Box", "Main Server Chassis", "Expansion Chassis", "Sub Chassis",
+        "Bus Expansion Chassis", "Peripheral Chassis", "RAID Chassis", "Rack Mount Chassis",
+        "Sealed-case PC", "Multi-system", "CompactPCI", "AdvancedTCA", "Blade", "Blade Enclosing",
+        "Tablet", "Convertible", "Detachable", "IoT Gateway", "Embedded PC", "Mini PC", "Stick PC"
+    };
+    return range_name(names, type & 0x7F);
+}
+
+/// UUID with the byte order of the version, dmi_system_uuid()
+void append_system_uuid(RenderBuffer& out, const uint8_t* uuid, unsigned version)
+{
+    const bool all_ff = std::all_of(uuid, uuid + 16, [](uint8_t byte) { return byte == 0xFF; });
+    const bool all_00 = std::all_of(uuid, uuid + 16, [](uint8_t byte) { return byte == 0x00; });
+    if (all_ff) {
+        out << "Not Present";
+        return;
+    }
+    if (all_00) {
+        out << "Not Settable";
+        return;
+    }
+
+    // since 2.6 the first three fields are little-endian
+    static const uint8_t little_endian_order[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+    for (size_t i = 0; i < 16; ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            out << '-';
+        }
+        append_upper_hex(out, uuid[version >= 0x0206 ? little_endian_order[i] : i], 2);
+    }
+}
+
+void append_processor_frequency(RenderBuffer& out, const uint8_t* data)
+{
+    const uint16_t code = word(data);
+    if (code) {
+        out << unsigned(code) << " MHz";
+    }
+    else {
+        out << "Unknown";
+    }
+}
+
+/// Family 2 is used if the family byte refers to it
+const char* processor_family(const StructurePrinter& p)
+{
+    const uint16_t code = p.data[0x06] == 0xFE && p.length >= 0x2A ? word(p.data + 0x28) : p.data[0x06];
+    return schema_name(SMBios::ProcessorInformation, 0x28, code);
+}
+
+const char* memory_device_type_name(uint8_t type)
+{
+    static const char* const names[] = {
+        "Other", "Unknown", "DRAM", "EDRAM", "VRAM", "SRAM", "RAM", "ROM", "Flash", "EEPROM", "FEPROM",
+        "EPROM", "CDRAM", "3DRAM", "SDRAM", "SGRAM", "RDRAM", "DDR", "DDR2", "DDR2 FB-DIMM", "Reserved",
+        "Reserved", "Reserved", "DDR3", "FBD2", "DDR4", "LPDDR", "LPDDR2", "LPDDR3", "LPDDR4",
+        "Logical non-volatile device", "HBM", "HBM2", "DDR5", "LPDDR5", "HBM3"
+    };
+    return range_name(names, type);
+}
+
+void print_bios(StructurePrinter& p)
+{
+    static const char* const characteristics[] = {
+        "BIOS characteristics not supported", "ISA is supported", "MCA is supported", "EISA is supported",
+        "PCI is supported", "PC Card (PCMCIA) is supported", "PNP is supported", "APM is supported",
+        "BIOS is upgradeable", "BIOS shadowing is allowed", "VLB is supported", "ESCD support is available",
+        "Boot from CD is supported", "Selectable boot is supported", "BIOS ROM is socketed",
+        "Boot from PC Card (PCMCIA) is supported", "EDD is supported",
+        "Japanese floppy for NEC 9800 1.2 MB is supported (int 13h)",
+        "Japanese floppy for Toshiba 1.2 MB is supported (int 13h)",
+        "5.25\"/360 kB floppy services are supported (int 13h)",
+        "5.25\"/1.2 MB floppy services are supported (int 13h)",
+        "3.5\"/720 kB floppy services are supported (int 13h)",
+        "3.5\"/2.88 MB floppy services are supported (int 13h)",
+        "Print screen service is supported (int 5h)", "8042 keyboard services are supported (int 9h)",
+        "Serial services are supported (int 14h)", "Printer services are supported (int 17h)",
+        "CGA/mono video services are supported (int 10h)", "NEC PC-98"
+    };
+    static const char* const characteristics_x1[] = {
+        "ACPI is supported", "USB legacy is supported", "AGP is supported", "I2O boot is supported",
+        "LS-120 boot is supported", "ATAPI Zip drive boot is supported", "IEEE 1394 boot is supported",
+        "Smart battery is supported"
+    };
+    static const char* const characteristics_x2[] = {
+        "BIOS boot specification is supported", "Function key-initiated network boot is supported",
+        "Targeted content distribution is supported", "UEFI is supported", "System is a virtual machine",
+        "Manufacturing mode is supported", "Manufacturing mode is enabled"
+    };
+
+    if (p.length < 0x12) {
+        return;
+    }
+    RenderBuffer& out = p.out;
+    p.string_attr("Vendor", 0x04);
+    p.string_attr("Version", 0x05);
+    p.string_attr("Release Date", 0x08);
+
+    // UEFI firmware has no BIOS segment
+    const uint16_t segment = word(p.data + 0x06);
+    if (segment) {
+        p.attr("Address") << "0x";
+        append_upper_hex(out, segment, 4);
+        out << "0\n";
+        const uint32_t runtime_size = (0x10000u - segment) << 4;
+        if (runtime_size & 0x3FF) {
+            p.attr("Runtime Size") << runtime_size << " bytes\n";
+        }
+        else {
+            p.attr("Runtime Size") << (runtime_size >> 10) << " kB\n";
+        }
+    }
+
+    const uint8_t rom_size = p.data[0x09];
+    p.attr("ROM Size");
+    if (rom_size != 0xFF) {
+        append_memory_size(out, (uint64_t(rom_size) + 1) << 6, 1);
+    }
+    else {
+        static const char* const units[] = { "MB", "GB", out_of_spec, out_of_spec };
+        const uint16_t extended = p.length < 0x1A ? 16 : word(p.data + 0x18);
+        out << unsigned(extended & 0x3FFF) << ' ' << units[extended >> 14];
+    }
+    out << '\n';
+
+    p.list("Characteristics");
+    const uint32_t code = dword(p.data + 0x0A);
+    if (code & (1u << 3)) {
+        p.item(characteristics[0]);
+    }
+    else {
+        for (unsigned bit = 4; bit <= 31; ++bit) {
+            if (code & (1u << bit)) {
+                p.item(characteristics[bit - 3]);
+            }
+        }
+    }
+    if (p.length < 0x13) {
+        return;
+    }
+    for (unsigned bit = 0; bit < 8; ++bit) {
+        if (p.data[0x12] & (1u << bit)) {
+            p.item(characteristics_x1[bit]);
+        }
+    }
+    if (p.length < 0x14) {
+        return;
+    }
+    for (unsigned bit = 0; bit < 7; ++bit) {
+        if (p.data[0x13] & (1u << bit)) {
+            p.item(characteristics_x2[bit]);
+        }
+    }
+    if (p.length < 0x18) {
+        return;
+    }
+    if (p.data[0x14] != 0xFF && p.data[0x15] != 0xFF) {
+        p.attr("BIOS Revision") << unsigned(p.data[0x14]) << '.' << unsigned(p.data[0x15]) << '\n';
+    }
+    if (p.data[0x16] != 0xFF && p.data[0x17] != 0xFF) {
+        p.attr("Firmware Revision") << unsigned(p.data[0x16]) << '.' << unsigned(p.data[0x17]) << '\n';
+    }
+}
+
+void print_system(StructurePrinter& p, unsigned version)
+{
+    static const char* const wake_up_types[] = {
+        "Reserved", "Other", "Unknown", "APM Timer", "Modem Ring", "LAN Remote", "Power Switch",
+        "PCI PME#", "AC Power Restored"
+    };
+
+    if (p.length < 0x08) {
+        return;
+    }
+    p.string_attr("Manufacturer", 0x04);
+    p.string_attr("Product Name", 0x05);
+    p.string_attr("Version", 0x06);
+    p.string_attr("Serial Number", 0x07);
+    if (p.length < 0x19) {
+        return;
+    }
+    append_system_uuid(p.attr("UUID"), p.data + 0x08, version);
+    p.out << '\n';
+    p.text_attr("Wake-up Type", range_name(wake_up_types, p.data[0x18], 0));
+    if (p.length < 0x1B) {
+        return;
+    }
+    p.string_attr("SKU Number", 0x19);
+    p.string_attr("Family", 0x1A);
+}
+
+void print_baseboard(StructurePrinter& p)
+{
+    static const char* const features[] = {
+        "Board is a hosting board", "Board requires at least one daughter board", "Board is removable",
+        "Board is replaceable", "Board is hot swappable"
+    };
+
+    if (p.length < 0x08) {
+        return;
+    }
+    p.string_attr("Manufacturer", 0x04);
+    p.string_attr("Product Name", 0x05);
+    p.string_attr("Version", 0x06);
+    p.string_attr("Serial Number", 0x07);
+    if (p.length < 0x09) {
+        return;
+    }
+    p.string_attr("Asset Tag", 0x08);
+    if (p.length < 0x0A) {
+        return;
+    }
+    listed_bit_names(p, "Features", p.data[0x09], features, 0);
+    if (p.length < 0x0E) {
+        return;
+    }
+    p.string_attr("Location In Chassis", 0x0A);
+    p.handle_attr("Chassis Handle", 0x0B);
+    p.text_attr("Type", baseboard_type_name(p.data[0x0D]));
+    if (p.length < 0x0F || p.length < 0x0F + p.data[0x0E] * 2) {
+        return;
+    }
+    const uint8_t count = p.data[0x0E];
+    if (count) {
+        p.attr("Contained Object Handles") << unsigned(count) << '\n';
+        for (uint8_t object = 0; object < count; ++object) {
+            p.out << "\t\t";
+            append_handle(p.out, word(p.data + 0x0F + object * 2));
+            p.out << '\n';
+        }
+    }
+}
+
+void print_chassis(StructurePrinter& p)
+{
+    static const char* const states[] = { "Other", "Unknown", "Safe", "Warning", "Critical", "Non-recoverable" };
+    static const char* const security_states[] = {
+        "Other", "Unknown", "None", "External Interface Locked Out", "External Interface Enabled"
+    };
+
+    if (p.length < 0x09) {
+        return;
+    }
+    RenderBuffer& out = p.out;
+    p.string_attr("Manufacturer", 0x04);
+    p.text_attr("Type", chassis_type_name(p.data[0x05]));
+    p.text_attr("Lock", p.data[0x05] & 0x80 ? "Present" : "Not Present");
+    p.string_attr("Version", 0x06);
+    p.string_attr("Serial Number", 0x07);
+    p.string_attr("Asset Tag", 0x08);
+    if (p.length < 0x0D) {
+        return;
+    }
+    p.text_attr("Boot-up State", range_name(states, p.data[0x09]));
+    p.text_attr("Power Supply State", range_name(states, p.data[0x0A]));
+    p.text_attr("Thermal State", range_name(states, p.data[0x0B]));
+    p.text_attr("Security Status", range_name(security_states, p.data[0x0C]));
+    if (p.length < 0x11) {
+        return;
+    }
+    p.attr("OEM Information") << "0x";
+    append_upper_hex(out, dword(p.data + 0x0D), 8);
+    out << '\n';
+    if (p.length < 0x13) {
+        return;
+    }
+    if (p.data[0x11]) {
+        p.attr("Height") << unsigned(p.data[0x11]) << " U\n";
+    }
+    else {
+        p.text_attr("Height", "Unspecified");
+    }
+    if (p.data[0x12]) {
+        p.attr("Number Of Power Cords") << unsigned(p.data[0x12]) << '\n';
+    }
+    else {
+        p.text_attr("Number Of Power Cords", "Unspecified");
+    }
+    if (p.length < 0x15) {
+        return;
+    }
+    const unsigned count = p.data[0x13];
+    const unsigned record_length = p.data[0x14];
+    if (p.length < 0x15 + count * record_length) {
+        return;
+    }
+    p.attr("Contained Elements") << count << '\n';
+    for (unsigned element = 0; element < count && record_length >= 0x03; ++element) {
+        const uint8_t* record = p.data + 0x15 + element * record_length;
+        const char* type = record[0] & 0x80 ? structure_type_name(record[0] & 0x7F) : baseboard_type_name(record[0] & 0x7F);
+        out << "\t\t" << type << " (" << unsigned(record[1]);
+        if (record[1] != record[2]) {
+            out << '-' << unsigned(record[2]);
+        }
+        out << ")\n";
+    }
+    if (p.length < 0x16 + count * record_length) {
+        return;
+    }
+    p.string_attr("SKU Number", static_cast<uint8_t>(0x15 + count * record_length));
+}
+
+/// ID, signature and CPUID flags, the last two for x86 families only
+void print_processor_id(StructurePrinter& p)
+{
+    static const char* const flags[32] = {
+        "FPU (Floating-point unit on-chip)", "VME (Virtual mode extension)", "DE (Debugging extension)",
+        "PSE (Page size extension)", "TSC (Time stamp counter)", "MSR (Model specific registers)",
+        "PAE (Physical address extension)", "MCE (Machine check exception)",
+        "CX8 (CMPXCHG8 instruction supported)", "APIC (On-chip APIC hardware supported)", nullptr,
+        "SEP (Fast system call)", "MTRR (Memory type range registers)", "PGE (Page global enable)",
+        "MCA (Machine check architecture)", "CMOV (Conditional move instruction supported)",
+        "PAT (Page attribute table)", "PSE-36 (36-bit page size extension)",
+        "PSN (Processor serial number present and enabled)", "CLFSH (CLFLUSH instruction supported)", nullptr,
+        "DS (Debug store)", "ACPI (ACPI supported)", "MMX (MMX technology supported)",
+        "FXSR (FXSAVE and FXSTOR instructions supported)", "SSE (Streaming SIMD extensions)",
+        "SSE2 (Streaming SIMD extensions 2)", "SS (Self-snoop)", "HTT (Multi-threading)",
+        "TM (Thermal monitor supported)", nullptr, "PBE (Pending break enabled)"
+    };
+
+    RenderBuffer& out = p.out;
+    const uint8_t* id = p.data + 0x08;
+    p.attr("ID");
+    for (size_t i = 0; i < 8; ++i) {
+        if (i) {
+            out << ' ';
+        }
+        append_upper_hex(out, id[i], 2);
+    }
+    out << '\n';
+
+    const uint16_t family = p.data[0x06] == 0xFE && p.length >= 0x2A ? word(p.data + 0x28) : p.data[0x06];
+    auto in = [family](uint16_t first, uint16_t last) { return family >= first && family <= last; };
+    int vendor = 0;
+    if (in(0x0B, 0x15) || in(0x28, 0x2F) || in(0xA1, 0xB3) || family == 0xB5 || in(0xB9, 0xC7)
+        || in(0xCD, 0xCF) || in(0xD2, 0xDB) || in(0xDD, 0xE0)) {
+        vendor = 1;
+    }
+    else if (in(0x18, 0x1D) || family == 0x1F || in(0x38, 0x3F) || in(0x46, 0x4F) || in(0x66, 0x6B)
+        || in(0x83, 0x8F) || in(0xB6, 0xB7) || in(0xE4, 0xEF)) {
+        vendor = 2;
+    }
+    else if (family == 0x01 || family == 0x02) {
+        // some firmware does not know the family, the version string tells
+        const boost::string_view version = p.raw_string(p.data[0x10]);
+        if (version.starts_with("Pentium III MMX") || version.starts_with("Intel(R) Core(TM)2")
+            || version.starts_with("Intel(R) Pentium(R)") || version == "Genuine Intel(R) CPU U1400") {
+            vendor = 1;
+        }
+        else if (version.starts_with("AMD Athlon(TM)") || version.starts_with("AMD Opteron(tm)")
+            || version.starts_with("Dual-Core AMD Opteron(tm)")) {
+            vendor = 2;
+        }
+    }
+    if (!vendor) {
+        return;
+    }
+
+    const uint32_t eax = dword(id);
+    if (vendor == 1) {
+        p.attr("Signature") << "Type " << ((eax >> 12) & 0x3) << ", Family " << (((eax >> 20) & 0xFF) + ((eax >> 8) & 0x0F))
+            << ", Model " << (((eax >> 12) & 0xF0) + ((eax >> 4) & 0x0F)) << ", Stepping " << (eax & 0xF) << '\n';
+    }
+    else {
+        const bool extended = ((eax >> 8) & 0xF) == 0xF;
+        p.attr("Signature") << "Family " << (((eax >> 8) & 0xF) + (extended ? (eax >> 20) & 0xFF : 0))
+            << ", Model " << (((eax >> 4) & 0xF) | (extended ? (eax >> 12) & 0xF0 : 0)) << ", Stepping " << (eax & 0xF) << '\n';
+    }
+
+    const uint32_t edx = dword(id + 4);
+    if ((edx & 0xBFEFFBFF) == 0) {
+        p.text_attr("Flags", "None");
+        return;
+    }
+    p.list("Flags");
+    for (unsigned bit = 0; bit < 32; ++bit) {
+        if (flags[bit] && (edx & (uint32_t(1) << bit))) {
+            p.item(flags[bit]);
+        }
+    }
+}
+
+void print_processor(StructurePrinter& p, unsigned version)
+{
+    static const char* const statuses[] = { "Unknown", "Enabled", "Disabled By User", "Disabled By BIOS", "Idle" };
+    static const char* const characteristics[] = {
+        "64-bit capable", "Multi-Core", "Hardware Thread", "Execute Protection", "Enhanced Virtualization",
+        "Power/Performance Control"
+    };
+
+    if (p.length < 0x1A) {
+        return;
+    }
+    RenderBuffer& out = p.out;
+    p.string_attr("Socket Designation", 0x04);
+    p.text_attr("Type", schema_name(SMBios::ProcessorInformation, 0x05, p.data[0x05]));
+    p.text_attr("Family", processor_family(p));
+    p.string_attr("Manufacturer", 0x07);
+    print_processor_id(p);
+    p.string_attr("Version", 0x10);
+
+    const uint8_t voltage = p.data[0x11];
+    p.attr("Voltage");
+    if (voltage & 0x80) {
+        out << unsigned((voltage & 0x7F) / 10) << '.' << unsigned((voltage & 0x7F) % 10) << " V";
+    }
+    else if ((voltage & 0x07) == 0) {
+        out << "Unknown";
+    }
+    else {
+        static const char* const legacy_voltages[] = { "5.0 V", "3.3 V", "2.9 V" };
+        bool any = false;
+        for (unsigned bit = 0; bit < 3; ++bit) {
+            if (voltage & (1u << bit)) {
+                out << (any ? " " : "") << legacy_voltages[bit];
+                any = true;
+            }
+        }
+    }
+    out << '\n';
+
+    append_processor_frequency(p.attr("External Clock"), p.data + 0x12);
+    out << '\n';
+    append_processor_frequency(p.attr("Max Speed"), p.data + 0x14);
+    out << '\n';
+    append_processor_frequency(p.attr("Current Speed"), p.data + 0x16);
+    out << '\n';
+
+    const uint8_t status = p.data[0x18];
+    if (status & 0x40) {
+        const uint8_t cpu_status = status & 0x07;
+        p.attr("Status") << "Populated, " << (cpu_status == 7 ? "Other" : range_name(statuses, cpu_status, 0)) << '\n';
+    }
+    else {
+        p.text_attr("Status", "Unpopulated");
+    }
+    p.text_attr("Upgrade", schema_name(SMBios::ProcessorInformation, 0x19, p.data[0x19]));
+    if (p.length < 0x20) {
+        return;
+    }
+
+    static const char* const cache_attrs[] = { "L1 Cache Handle", "L2 Cache Handle", "L3 Cache Handle" };
+    for (unsigned level = 0; level < 3; ++level) {
+        const uint16_t handle = word(p.data + 0x1A + level * 2);
+        p.attr(cache_attrs[level]);
+        if (handle != 0xFFFF) {
+            append_handle(out, handle);
+        }
+        else if (version >= 0x0203) {
+            out << "Not Provided";
+        }
+        else {
+            out << "No L" << (level + 1) << " Cache";
+        }
+        out << '\n';
+    }
+    if (p.length < 0x23) {
+        return;
+    }
+    p.string_attr("Serial Number", 0x20);
+    p.string_attr("Asset Tag", 0x21);
+    p.string_attr("Part Number", 0x22);
+    if (p.length < 0x28) {
+        return;
+    }
+    if (p.data[0x23]) {
+        p.attr("Core Count") << unsigned(p.length >= 0x2C && p.data[0x23] == 0xFF ? word(p.data + 0x2A) : p.data[0x23]) << '\n';
+    }
+    if (p.data[0x24]) {
+        p.attr("Core Enabled") << unsigned(p.length >= 0x2E && p.data[0x24] == 0xFF ? word(p.data + 0x2C) : p.data[0x24]) << '\n';
+    }
+    if (p.data[0x25]) {
+        p.attr("Thread Count") << unsigned(p.length >= 0x30 && p.data[0x25] == 0xFF ? word(p.data + 0x2E) : p.data[0x25]) << '\n';
+    }
+    listed_bit_names(p, "Characteristics", word(p.data + 0x26), characteristics, 2);
+}
+
+/// 16-bit cache size is widened to the 32-bit layout, granularity bit moves to the top
+void append_cache_size(RenderBuffer& out, uint32_t code)
+{
+    const uint64_t size = code & 0x80000000 ? uint64_t(code & 0x7FFFFFFF) << 6 : code;
+    append_memory_size(out, size, 1);
+}
+
+void print_cache(StructurePrinter& p)
+{
+    static const char* const modes[] = { "Write Through", "Write Back", "Varies With Memory Address", "Unknown" };
+    static const char* const locations[] = { "Internal", "Reserved", "External", "Unknown" };
+    static const char* const sram_types[] = {
+        "Other", "Unknown", "Non-burst", "Burst", "Pipeline Burst", "Synchronous", "Asynchronous"
+    };
+    static const char* const error_corrections[] = { "Other", "Unknown", "None", "Parity", "Single-bit ECC", "Multi-bit ECC" };
+    static const char* const system_types[] = { "Other", "Unknown", "Instruction", "Data", "Unified" };
+    static const char* const associativities[] = {
+        "Other", "Unknown", "Direct Mapped", "2-way Set-associative", "4-way Set-associative",
+        "Fully Associative", "8-way Set-associative", "16-way Set-associative", "12-way Set-associative",
+        "24-way Set-associative", "32-way Set-associative", "48-way Set-associative",
+        "64-way Set-associative", "20-way Set-associative"
+    };
+
+    if (p.length < 0x0F) {
+        return;
+    }
+    RenderBuffer& out = p.out;
+    p.string_attr("Socket Designation", 0x04);
+    const uint16_t configuration = word(p.data + 0x05);
+    p.attr("Configuration") << (configuration & 0x0080 ? "Enabled" : "Disabled") << ", "
+        << (configuration & 0x0008 ? "Socketed" : "Not Socketed") << ", Level " << unsigned((configuration & 0x0007) + 1) << '\n';
+    p.text_attr("Operational Mode", modes[(configuration >> 8) & 0x0003]);
+    p.text_attr("Location", locations[(configuration >> 5) & 0x0003]);
+
+    auto widen = [](uint16_t code) { return (uint32_t(code & 0x8000) << 16) | (code & 0x7FFF); };
+    append_cache_size(p.attr("Installed Size"), p.length >= 0x1B ? dword(p.data + 0x17) : widen(word(p.data + 0x09)));
+    out << '\n';
+    append_cache_size(p.attr("Maximum Size"), p.length >= 0x17 ? dword(p.data + 0x13) : widen(word(p.data + 0x07)));
+    out << '\n';
+    listed_bit_names(p, "Supported SRAM Types", word(p.data + 0x0B), sram_types, 0);
+    flat_bit_names(p, "Installed SRAM Type", word(p.data + 0x0D) & 0x7F, sram_types, 0);
+    if (p.length < 0x13) {
+        return;
+    }
+    if (p.data[0x0F]) {
+        p.attr("Speed") << unsigned(p.data[0x0F]) << " ns\n";
+    }
+    else {
+        p.text_attr("Speed", "Unknown");
+    }
+    p.text_attr("Error Correction Type", range_name(error_corrections, p.data[0x10]));
+    p.text_attr("System Type", range_name(system_types, p.data[0x11]));
+    p.text_attr("Associativity", range_name(associativities, p.data[0x12]));
+}
+
+/// OEM Strings and System Configuration Options: numbered strings
+void print_string_list(StructurePrinter& p, const char* prefix)
+{
+    if (p.length < 0x05) {
+        return;
+    }
+    for (unsigned index = 1; index <= p.data[0x04]; ++index) {
+        p.out << '\t' << prefix << ' ' << index << ": ";
+        p.string(static_cast<uint8_t>(index));
+        p.out << '\n';
+    }
+}
+
+void append_error_handle(RenderBuffer& out, uint16_t handle)
+{
+    if (handle == 0xFFFE) {
+        out << "Not Provided";
+    }
+    else if (handle == 0xFFFF) {
+        out << "No Error";
+    }
+    else {
+        append_handle(out, handle);
+    }
+}
+
+void print_memory_array(StructurePrinter& p)
+{
+    static const char* const locations[] = {
+        "Other", "Unknown", "System Board Or Motherboard", "ISA Add-on Card", "EISA Add-on Card",
+        "PCI Add-on Card", "MCA Add-on Card", "PCMCIA Add-on Card", "Proprietary Add-on Card", "NuBus"
+    };
+    static const char* const pc98_locations[] = {
+        "PC-98/C20 Add-on Card", "PC-98/C24 Add-on Card", "PC-98/E Add-on Card",
+        "PC-98/Local Bus Add-on Card", "CXL Flexbus 1.0"
+    };
+    static const char* const uses[] = {
+        "Other", "Unknown", "System Memory", "Video Memory", "Flash Memory", "Non-volatile RAM", "Cache Memory"
+    };
+    static const char* const error_corrections[] = {
+        "Other", "Unknown", "None", "Parity", "Single-bit ECC", "Multi-bit ECC", "CRC"
+    };
+
+    if (p.length < 0x0F) {
+        return;
+    }
+    RenderBuffer& out = p.out;
+    const uint8_t location = p.data[0x04];
+    p.text_attr("Location", location >= 0xA0 ? range_name(pc98_locations, location, 0xA0) : range_name(locations, location));
+    p.text_attr("Use", range_name(uses, p.data[0x05]));
+    p.text_attr("Error Correction Type", range_name(error_corrections, p.data[0x06]));
+
+    const uint32_t capacity = dword(p.data + 0x07);
+    p.attr("Maximum Capacity");
+    if (capacity != 0x80000000) {
+        append_memory_size(out, capacity, 1);
+    }
+    else if (p.length < 0x17) {
+        out << "Unknown";
+    }
+    else {
+        append_memory_size(out, qword(p.data + 0x0F), 0);
+    }
+    out << '\n';
+    append_error_handle(p.attr("Error Information Handle"), word(p.data + 0x0B));
+    out << '\n';
+    p.attr("Number Of Devices") << unsigned(word(p.data + 0x0D)) << '\n';
+}
+
+void append_device_width(RenderBuffer& out, uint16_t width)
+{
+    // empty slots report zero width
+    if (width == 0xFFFF || width == 0) {
+        out << "Unknown";
+    }
+    else {
+        out << unsigned(width) << " bits";
+    }
+}
+
+void append_device_speed(RenderBuffer& out, uint16_t speed, uint32_t extended_speed)
+{
+    const uint32_t value = speed == 0xFFFF ? extended_speed : speed;
+    if (value) {
+        out << value << " MT/s";
+    }
+    else {
+        out << "Unknown";
+    }
+}
+
+/// Non-volatile, volatile, cache and logical sizes in bytes
+void append_optional_size(RenderBuffer& out, uint64_t size)
+{
+    if (size == ~uint64_t(0)) {
+        out << "Unknown";
+    }
+    else if (size == 0) {
+        out << "None";
+    }
+    else {
+        append_memory_size(out, size, 0);
+    }
+}
+
+void print_memory_device(StructurePrinter& p)
+{
+    static const char* const form_factors[] = {
+        "Other", "Unknown", "SIMM", "SIP", "Chip", "DIP", "ZIP", "Proprietary Card", "DIMM", "TSOP",
+        "Row Of Chips", "RIMM", "SODIMM", "SRIMM", "FB-DIMM", "Die"
+    };
+    static const char* const type_details[] = {
+        "Other", "Unknown", "Fast-paged", "Static Column", "Pseudo-static", "RAMBus", "Synchronous", "CMOS",
+        "EDO", "Window DRAM", "Cache DRAM", "Non-Volatile", "Registered (Buffered)",
+        "Unbuffered (Unregistered)", "LRDIMM"
+    };
+    static const char* const technologies[] = {
+        "Other", "Unknown", "DRAM", "NVDIMM-N", "NVDIMM-F", "NVDIMM-P", "Intel Optane persistent memory"
+    };
+    static const char* const operating_modes[] = {
+        "Other", "Unknown", "Volatile memory", "Byte-accessible persistent memory",
+        "Block-accessible persistent memory"
+    };
+
+    if (p.length < 0x15) {
+        return;
+    }
+    RenderBuffer& out = p.out;
+    p.handle_attr("Array Handle", 0x04);
+    append_error_handle(p.attr("Error Information Handle"), word(p.data + 0x06));
+    out << '\n';
+    append_device_width(p.attr("Total Width"), word(p.data + 0x08));
+    out << '\n';
+    append_device_width(p.attr("Data Width"), word(p.data + 0x0A));
+    out << '\n';
+
+    const uint16_t size = word(p.data + 0x0C);
+    p.attr("Size");
+    if (p.length >= 0x20 && size == 0x7FFF) {
+        const uint32_t extended = dword(p.data + 0x1C) & 0x7FFFFFFF;
+        if (extended & 0x3FF) {
+            out << extended << " MB";
+        }
+        else if (extended & 0xFFC00) {
+            out << (extended >> 10) << " GB";
+        }
+        else {
+            out << (extended >> 20) << " TB";
+        }
+    }
+    else if (size == 0) {
+        out << "No Module Installed";
+    }
+    else if (size == 0xFFFF) {
+        out << "Unknown";
+    }
+    else {
+        // granularity bit: kB when set, MB otherwise
+        append_memory_size(out, size & 0x8000 ? uint64_t(size & 0x7FFF) : uint64_t(size & 0x7FFF) << 10, 1);
+    }
+    out << '\n';
+
+    p.text_attr("Form Factor", range_name(form_factors, p.data[0x0E]));
+    const uint8_t device_set = p.data[0x0F];
+    if (device_set == 0) {
+        p.text_attr("Set", "None");
+    }
+    else if (device_set == 0xFF) {
+        p.text_attr("Set", "Unknown");
+    }
+    else {
+        p.attr("Set") << unsigned(device_set) << '\n';
+    }
+    p.string_attr("Locator", 0x10);
+    p.string_attr("Bank Locator", 0x11);
+    p.text_attr("Type", memory_device_type_name(p.data[0x12]));
+    flat_bit_names(p, "Type Detail", word(p.data + 0x13), type_details, 1);
+    if (p.length < 0x17) {
+        return;
+    }
+
+    // the rest is irrelevant for an empty slot
+    if (size == 0) {
+        return;
+    }
+    append_device_speed(p.attr("Speed"), word(p.data + 0x15), p.length >= 0x5C ? dword(p.data + 0x54) : 0);
+    out << '\n';
+    if (p.length < 0x1B) {
+        return;
+    }
+    p.string_attr("Manufacturer", 0x17);
+    p.string_attr("Serial Number", 0x18);
+    p.string_attr("Asset Tag", 0x19);
+    p.string_attr("Part Number", 0x1A);
+    if (p.length < 0x1C) {
+        return;
+    }
+    if (p.data[0x1B] & 0x0F) {
+        p.attr("Rank") << unsigned(p.data[0x1B] & 0x0F) << '\n';
+    }
+    else {
+        p.text_attr("Rank", "Unknown");
+    }
+    if (p.length < 0x22) {
+        return;
+    }
+    append_device_speed(p.attr("Configured Memory Speed"), word(p.data + 0x20), p.length >= 0x5C ? dword(p.data + 0x58) : 0);
+    out << '\n';
+    if (p.length < 0x28) {
+        return;
+    }
+
+    static const char* const voltage_attrs[] = { "Minimum Voltage", "Maximum Voltage", "Configured Voltage" };
+    for (unsigned voltage = 0; voltage < 3; ++voltage) {
+        const uint16_t millivolts = word(p.data + 0x22 + voltage * 2);
+        if (millivolts) {
+            append_millivolts(p.attr(voltage_attrs[voltage]), millivolts);
+            out << '\n';
+        }
+        else {
+            p.text_attr(voltage_attrs[voltage], "Unknown");
+        }
+    }
+    if (p.length < 0x34) {
+        return;
+    }
+
+    p.text_attr("Memory Technology", range_name(technologies, p.data[0x28]));
+    flat_bit_names(p, "Memory Operating Mode Capability", word(p.data + 0x29), operating_modes, 1);
+    p.string_attr("Firmware Version", 0x2B);
+
+    static const char* const id_attrs[] = {
+        "Module Manufacturer ID", "Module Product ID",
+        "Memory Subsystem Controller Manufacturer ID", "Memory Subsystem Controller Product ID"
+    };
+    for (unsigned id = 0; id < 4; ++id) {
+        const uint16_t code = word(p.data + 0x2C + id * 2);
+        p.attr(id_attrs[id]);
+        if (code == 0) {
+            out << "Unknown";
+        }
+        else if (id % 2 == 0) {
+            // JEDEC JEP-106: continuation count and the code
+            out << "Bank " << unsigned((code & 0x7F) + 1) << ", Hex 0x";
+            append_upper_hex(out, code >> 8, 2);
+        }
+        else {
+            out << "0x";
+            append_upper_hex(out, code, 4);
+        }
+        out << '\n';
+    }
+    if (p.length < 0x54) {
+        return;
+    }
+
+    static const char* const size_attrs[] = { "Non-Volatile Size", "Volatile Size", "Cache Size", "Logical Size" };
+    for (unsigned size_index = 0; size_index < 4; ++size_index) {
+        append_optional_size(p.attr(size_attrs[size_index]), qword(p.data + 0x34 + size_index * 8));
+        out << '\n';
+    }
+}
+
+/// Starting and ending address with the range size of types 19 and 20
+void print_mapped_range(StructurePrinter& p, uint8_t extended_offset)
+{
+    RenderBuffer& out = p.out;
+    const uint32_t starting = dword(p.data + 0x04);
+    const uint32_t ending = dword(p.data + 0x08);
+
+    if (p.length >= extended_offset + 16 && starting == 0xFFFFFFFF) {
+        const uint64_t extended_starting = qword(p.data + extended_offset);
+        const uint64_t extended_ending = qword(p.data + extended_offset + 8);
+        p.attr("Starting Address") << "0x";
+        append_upper_hex(out, extended_starting, 16);
+        out << '\n';
+        p.attr("Ending Address") << "0x";
+        append_upper_hex(out, extended_ending, 16);
+        out << '\n';
+        p.attr("Range Size");
+        if (extended_starting == extended_ending) {
+            out << "Invalid";
+        }
+        else {
+            append_memory_size(out, extended_ending - extended_starting + 1, 0);
+        }
+        out << '\n';
+        return;
+    }
+
+    // addresses are in kB
+    p.attr("Starting Address") << "0x";
+    append_upper_hex(out, starting >> 2, 8);
+    append_upper_hex(out, (starting & 0x3) << 10, 3);
+    out << '\n';
+    p.attr("Ending Address") << "0x";
+    append_upper_hex(out, ending >> 2, 8);
+    append_upper_hex(out, ((ending & 0x3) << 10) + 0x3FF, 3);
+    out << '\n';
+    const uint32_t range = ending - starting + 1;
+    p.attr("Range Size");
+    if (range) {
+        append_memory_size(out, range, 1);
+    }
+    else {
+        out << "Invalid";
+    }
+    out << '\n';
+}
+
+void print_array_mapped_address(StructurePrinter& p)
+{
+    if (p.length < 0x0F) {
+        return;
+    }
+    print_mapped_range(p, 0x0F);
+    p.handle_attr("Physical Array Handle", 0x0C);
+    p.attr("Partition Width") << unsigned(p.data[0x0E]) << '\n';
+}
+
+void print_device_mapped_address(StructurePrinter& p)
+{
+    if (p.length < 0x13) {
+        return;
+    }
+    print_mapped_range(p, 0x13);
+    p.handle_attr("Physical Device Handle", 0x0C);
+    p.handle_attr("Memory Array Mapped Address Handle", 0x0E);
+
+    const uint8_t row = p.data[0x10];
+    if (row == 0) {
+        p.text_attr("Partition Row Position", out_of_spec);
+    }
+    else if (row == 0xFF) {
+        p.text_attr("Partition Row Position", "Unknown");
+    }
+    else {
+        p.attr("Partition Row Position") << unsigned(row) << '\n';
+    }
+
+    // zero means the device is not interleaved
+    static const char* const interleave_attrs[] = { "Interleave Position", "Interleaved Data Depth" };
+    for (unsigned attr = 0; attr < 2; ++attr) {
+        const uint8_t value = p.data[0x11 + attr];
+        if (value == 0xFF) {
+            p.text_attr(interleave_attrs[attr], "Unknown");
+        }
+        else if (value) {
+            p.attr(interleave_attrs[attr]) << unsigned(value) << '\n';
+        }
+    }
+}
+
+void print_boot(StructurePrinter& p)
+{
+    static const char* const statuses[] = {
+        "No errors detected", "No bootable media", "Operating system failed to load",
+        "Firmware-detected hardware failure", "Operating system-detected hardware failure",
+        "User-requested boot", "System security violation", "Previously-requested image",
+        "System watchdog timer expired"
+    };
+
+    if (p.length < 0x0B) {
+        return;
+    }
+    const uint8_t status = p.data[0x0A];
+    if (status >= 192) {
+        p.text_attr("Status", "Product-specific");
+    }
+    else if (status >= 128) {
+        p.text_attr("Status", "OEM-specific");
+    }
+    else {
+        p.text_attr("Status", range_name(statuses, status, 0));
+    }
+}
+
+/// dmidecode -u layout: formatted area and strings in hex rows of 16 bytes
+void print_dump(StructurePrinter& p)
+{
+    RenderBuffer& out = p.out;
+    auto hex_rows = [&out](const uint8_t* bytes, size_t size) {
+        for (size_t row = 0; row < size; row += 16) {
+            out << "\t\t";
+            for (size_t i = row; i < size && i < row + 16; ++i) {
+                if (i != row) {
+                    out << ' ';
+                }
+                append_upper_hex(out, bytes[i], 2);
+            }
+            out << '\n';
+        }
+    };
+
+    p.list("Header and Data");
+    hex_rows(p.data, p.length);
+    if (!p.strings_count()) {
+        return;
+    }
+    p.list("Strings");
+    for (size_t string_index = 1; string_index <= p.strings_count(); ++string_index) {
+        const boost::string_view text = p.raw_string(static_cast<uint8_t>(string_index));
+        // terminating zero is a part of the dump
+        hex_rows(reinterpret_cast<const uint8_t*>(text.data()), text.size() + 1);
+        out << "\t\t\"";
+        p.string(static_cast<uint8_t>(string_index));
+        out << "\"\n";
+    }
+}
+
+unsigned version_code(const SMBiosVersion& version)
+{
+    return (unsigned(version.major_version) << 8) | version.minor_version;
+}
+
+/// dmidecode -t keyword: types of the group, the list ends with 0xFF
+struct TypeKeyword {
+    const char* keyword;
+    uint8_t types[6];
+};
+
+const TypeKeyword type_keywords[] = {
+    { "bios", { 0, 13, 0xFF } },
+    { "system", { 1, 12, 15, 23, 32, 0xFF } },
+    { "baseboard", { 2, 10, 41, 0xFF } },
+    { "chassis", { 3, 0xFF } },
+    { "processor", { 4, 0xFF } },
+    { "memory", { 5, 6, 16, 17, 0xFF } },
+    { "cache", { 7, 0xFF } },
+    { "connector", { 8, 0xFF } },
+    { "slot", { 9, 0xFF } }
+};
+
+/// dmidecode -s keyword: structure type and offset of the value
+struct StringKeyword {
+    const char* keyword;
+    uint8_t type;
+    uint8_t offset;
+};
+
+const StringKeyword string_keywords[] = {
+    { "bios-vendor", 0, 0x04 },
+    { "bios-version", 0, 0x05 },
+    { "bios-release-date", 0, 0x08 },
+    { "bios-revision", 0, 0x15 },
+    { "firmware-revision", 0, 0x17 },
+    { "system-manufacturer", 1, 0x04 },
+    { "system-product-name", 1, 0x05 },
+    { "system-version", 1, 0x06 },
+    { "system-serial-number", 1, 0x07 },
+    { "system-uuid", 1, 0x08 },
+    { "system-sku-number", 1, 0x19 },
+    { "system-family", 1, 0x1A },
+    { "baseboard-manufacturer", 2, 0x04 },
+    { "baseboard-product-name", 2, 0x05 },
+    { "baseboard-version", 2, 0x06 },
+    { "baseboard-serial-number", 2, 0x07 },
+    { "baseboard-asset-tag", 2, 0x08 },
+    { "chassis-manufacturer", 3, 0x04 },
+    { "chassis-type", 3, 0x05 },
+    { "chassis-version", 3, 0x06 },
+    { "chassis-serial-number", 3, 0x07 },
+    { "chassis-asset-tag", 3, 0x08 },
+    { "processor-family", 4, 0x06 },
+    { "processor-manufacturer", 4, 0x07 },
+    { "processor-version", 4, 0x10 },
+    { "processor-frequency", 4, 0x16 }
+};
+
+const StringKeyword* find_string_keyword(boost::string_view keyword)
+{
+    for (const StringKeyword& known : string_keywords) {
+        if (boost::iequals(keyword, boost::string_view(known.keyword))) {
+            return &known;
+        }
+    }
+    return nullptr;
+}
+
+boost::string_view trim(boost::string_view text)
+{
+    while (!text.empty() && text.front() == ' ') {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && text.back() == ' ') {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+/// Decimal or 0x-prefixed hex type number, -1 if it is not a number
+int parse_type_number(boost::string_view text)
+{
+    unsigned base = 10;
+    if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        base = 16;
+        text.remove_prefix(2);
+    }
+    if (text.empty()) {
+        return -1;
+    }
+    unsigned value = 0;
+    for (char c : text) {
+        unsigned digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        }
+        else if (base == 16 && c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        }
+        else if (base == 16 && c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        }
+        else {
+            return -1;
+        }
+        value = value * base + digit;
+        if (value > 0xFFFF) {
+            return -1;
+        }
+    }
+    return static_cast<int>(value);
+}
+
+/// End-of-table marker is not kept among the headers, it follows the last structure
+const uint8_t* find_end_of_table(const SMBios& smbios)
+{
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    const uint8_t* const table_end = smbios.get_table_base() + smbios.get_table_size();
+    const uint8_t* position = smbios.get_table_base();
+    if (!headers.empty()) {
+        position = headers.back().data + headers.back().length;
+        while (position + 1 < table_end && (position[0] != 0 || position[1] != 0)) {
+            ++position;
+        }
+        position += 2;
+    }
+    if (position + 4 <= table_end && position[0] == SMBios::EndOfTable && position[1] >= 4) {
+        return position;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+DmidecodeTypes smbios::parse_dmidecode_types(boost::string_view types)
+{
+    DmidecodeTypes selected;
+    while (!types.empty()) {
+        const size_t comma = types.find(',');
+        const boost::string_view item = trim(types.substr(0, comma));
+        types.remove_prefix(comma == boost::string_view::npos ? types.size() : comma + 1);
+        if (item.empty()) {
+            continue;
+        }
+
+        const auto keyword = std::find_if(std::begin(type_keywords), std::end(type_keywords), [item](const TypeKeyword& known) {
+            return boost::iequals(item, boost::string_view(known.keyword));
+        });
+        if (keyword != std::end(type_keywords)) {
+            for (const uint8_t* type = keyword->types; *type != 0xFF; ++type) {
+                selected.set(*type);
+            }
+            continue;
+        }
+
+        const int type = parse_type_number(item);
+        if (type < 0 || type > 0xFF) {
+            throw std::invalid_argument("Invalid type keyword: " + item.to_string());
+        }
+        selected.set(static_cast<size_t>(type));
+    }
+    if (selected.none()) {
+        throw std::invalid_argument("Type selection is empty");
+    }
+    return selected;
+}
+
+bool smbios::is_dmidecode_keyword(boost::string_view keyword)
+{
+    return find_string_keyword(keyword) != nullptr;
+}
+
+void smbios::render_dmidecode_structure(const DMIHeader& header, const SMBiosVersion& version, RenderBuffer& out)
+{
+    out << "Handle 0x";
+    append_upper_hex(out, header.handle, 4);
+    out << ", DMI type " << unsigned(header.type) << ", " << unsigned(header.length) << " bytes\n";
+
+    StructurePrinter p(header, out);
+    switch (header.type) {
+    case SMBios::BIOSInformation:
+        out << "BIOS Information\n";
+        print_bios(p);
+        break;
+    case SMBios::SystemInformation:
+        out << "System Information\n";
+        print_system(p, version_code(version));
+        break;
+    case SMBios::BaseboardInformation:
+        out << "Base Board Information\n";
+        print_baseboard(p);
+        break;
+    case SMBios::SystemEnclosure:
+        out << "Chassis Information\n";
+        print_chassis(p);
+        break;
+    case SMBios::ProcessorInformation:
+        out << "Processor Information\n";
+        print_processor(p, version_code(version));
+        break;
+    case SMBios::CacheInformation:
+        out << "Cache Information\n";
+        print_cache(p);
+        break;
+    case SMBios::OemStrings:
+        out << "OEM Strings\n";
+        print_string_list(p, "String");
+        break;
+    case SMBios::SystemConfigurationOptions:
+        out << "System Configuration Options\n";
+        print_string_list(p, "Option");
+        break;
+    case SMBios::PhysicalMemoryArray:
+        out << "Physical Memory Array\n";
+        print_memory_array(p);
+        break;
+    case SMBios::MemoryDevice:
+        out << "Memory Device\n";
+        print_memory_device(p);
+        break;
+    case SMBios::MemoryArrayMappedAddress:
+        out << "Memory Array Mapped Address\n";
+        print_array_mapped_address(p);
+        break;
+    case SMBios::MemoryDeviceMappedAddress:
+        out << "Memory Device Mapped Address\n";
+        print_device_mapped_address(p);
+        break;
+    case SMBios::SystemBootInformation:
+        out << "System Boot Information\n";
+        print_boot(p);
+        break;
+    case 126:
+        out << "Inactive\n";
+        break;
+    case SMBios::EndOfTable:
+        out << "End Of Table\n";
+        break;
+    default:
+        if (header.type >= 128) {
+            out << "OEM-specific Type\n";
+        }
+        else if (const StructureSchema* schema = find_structure_schema(header.type)) {
+            out << schema->name << '\n';
+        }
+        else {
+            out << "Unknown Type\n";
+        }
+        print_dump(p);
+        break;
+    }
+    out << '\n';
+}
+
+void smbios::render_dmidecode(const SMBios& smbios, const DmidecodeTypes& types, RenderBuffer& out)
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    const uint8_t* const end_of_table = find_end_of_table(smbios);
+
+    out << "# smbios_util dmidecode-compatible output\n";
+    out << "SMBIOS " << unsigned(version.major_version) << '.' << unsigned(version.minor_version);
+    // 64-bit entry point has the document revision, it is not kept in the table
+    if (version.major_version >= 3) {
+        out << ".0";
+    }
+    out << " present.\n";
+    if (version.major_version < 3 && types.none()) {
+        out << headers.size() + (end_of_table ? 1 : 0) << " structures occupying " << smbios.get_table_size() << " bytes.\n";
+    }
+    out << '\n';
+
+    for (const DMIHeader& header : headers) {
+        if (types.none() || types.test(header.type)) {
+            render_dmidecode_structure(header, version, out);
+        }
+    }
+
+    if (end_of_table && (types.none() || types.test(SMBios::EndOfTable))) {
+        const DMIHeader header = { end_of_table[0], end_of_table[1], word(end_of_table + 2), end_of_table };
+        render_dmidecode_structure(header, version, out);
+    }
+}
+
+void smbios::render_dmidecode_string(const SMBios& smbios, boost::string_view keyword, RenderBuffer& out)
+{
+    const StringKeyword* known = find_string_keyword(keyword);
+    if (!known) {
+        throw std::invalid_argument("Invalid string keyword: " + keyword.to_string());
+    }
+
+    const unsigned version = version_code(smbios.get_smbios_version());
+    for (const DMIHeader& header : smbios.get_headers()) {
+        if (header.type != known->type || known->offset >= header.length) {
+            continue;
+        }
+        StructurePrinter p(header, out);
+        const uint8_t* data = header.data;
+        switch ((unsigned(known->type) << 8) | known->offset) {
+        case 0x0015: // bios-revision
+        case 0x0017: // firmware-revision
+            if (data[known->offset - 1] != 0xFF && data[known->offset] != 0xFF) {
+                out << unsigned(data[known->offset - 1]) << '.' << unsigned(data[known->offset]) << '\n';
+            }
+            break;
+        case 0x0108: // system-uuid
+            if (header.length >= 0x18) {
+                append_system_uuid(out, data + 0x08, version);
+                out << '\n';
+            }
+            break;
+        case 0x0305: // chassis-type
+            out << chassis_type_name(data[0x05]) << '\n';
+            break;
+        case 0x0406: // processor-family
+            out << processor_family(p) << '\n';
+            break;
+        case 0x0416: // processor-frequency
+            if (header.length >= 0x18) {
+                append_processor_frequency(out, data + 0x16);
+                out << '\n';
+            }
+            break;
+        default:
+            p.string(data[known->offset]);
+            out << '\n';
+            break;
+        }
+    }
+}
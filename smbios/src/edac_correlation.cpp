@@ -0,0 +1,234 @@
+#include <smbios/edac_correlation.h>
+#include <smbios/memory_device_view.h>
+
+#include <algorithm>
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <boost/utility/string_view.hpp>
+
+using namespace smbios;
+namespace fs = boost::filesystem;
+
+namespace {
+
+/// First line of the sysfs attribute, empty if not readable
+std::string read_attribute(const fs::path& path)
+{
+    std::ifstream attribute(path.string());
+    std::string value;
+    std::getline(attribute, value);
+    return value;
+}
+
+bool read_counter(const std::string& path, uint64_t& value)
+{
+    std::ifstream attribute(path);
+    return static_cast<bool>(attribute >> value);
+}
+
+/// Parse number suffix of 'mc0', 'dimm12' names
+bool parse_index(const std::string& name, const char* prefix, uint32_t& index)
+{
+    const size_t prefix_length = std::char_traits<char>::length(prefix);
+    if (name.size() <= prefix_length || name.compare(0, prefix_length, prefix) != 0) {
+        return false;
+    }
+
+    index = 0;
+    for (size_t i = prefix_length; i < name.size(); ++i) {
+        if (name[i] < '0' || name[i] > '9') {
+            return false;
+        }
+        index = index * 10 + (name[i] - '0');
+    }
+    return true;
+}
+
+/// Label ends with the locator which starts a new word ('CPU0_DIMM_A1' and 'DIMM_A1')
+bool label_ends_with_locator(boost::string_view label, boost::string_view locator)
+{
+    if (locator.empty() || label.size() < locator.size() || !label.ends_with(locator)) {
+        return false;
+    }
+    if (label.size() == locator.size()) {
+        return true;
+    }
+    const char separator = label[label.size() - locator.size() - 1];
+    return separator == ' ' || separator == '_' || separator == '-' || separator == '#' || separator == ':';
+}
+
+/// Populated Memory Device
+struct MemoryDeviceCandidate {
+    size_t header_index;
+    MemoryDeviceView view;
+    bool taken;
+};
+
+} // namespace
+
+constexpr size_t EdacCorrelation::npos;
+
+std::vector<EdacDimm> smbios::read_edac_dimms(const std::string& edac_root)
+{
+    std::vector<EdacDimm> dimms;
+
+    boost::system::error_code error;
+    if (!fs::is_directory(edac_root, error)) {
+        return dimms;
+    }
+
+    for (fs::directory_iterator controller(edac_root, error), end; !error && controller != end; ++controller) {
+        EdacDimm dimm{};
+        if (!parse_index(controller->path().filename().string(), "mc", dimm.controller)) {
+            continue;
+        }
+
+        // unreadable controller is skipped, the rest of them are still listed
+        boost::system::error_code controller_error;
+        for (fs::directory_iterator entry(controller->path(), controller_error); !controller_error && entry != end; ++entry) {
+            if (!parse_index(entry->path().filename().string(), "dimm", dimm.index)) {
+                continue;
+            }
+            dimm.label = read_attribute(entry->path() / "dimm_label");
+            dimm.location = read_attribute(entry->path() / "dimm_location");
+            dimm.size_mb = 0;
+            std::ifstream((entry->path() / "size").string()) >> dimm.size_mb;
+            dimm.path = entry->path().string();
+            dimms.push_back(dimm);
+        }
+    }
+
+    std::sort(dimms.begin(), dimms.end(), [](const EdacDimm& lhs, const EdacDimm& rhs) {
+        return lhs.controller != rhs.controller ? lhs.controller < rhs.controller : lhs.index < rhs.index;
+    });
+    return dimms;
+}
+
+bool smbios::read_edac_counters(const std::string& dimm_path, EdacCounters& counters)
+{
+    return read_counter(dimm_path + "/dimm_ce_count", counters.corrected) &&
+           read_counter(dimm_path + "/dimm_ue_count", counters.uncorrected);
+}
+
+EdacCorrelation::EdacCorrelation(const SMBios& smbios, std::vector<EdacDimm> dimms)
+    : dimms_(std::move(dimms)), header_indices_(dimms_.size(), npos), matches_(dimms_.size(), EdacMatch::Unmatched)
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+
+    std::vector<MemoryDeviceCandidate> candidates;
+    for (size_t i = 0; i < headers.size(); ++i) {
+        if (headers[i].type == SMBios::MemoryDevice) {
+            const MemoryDeviceView view(headers[i], version);
+            if (view.get_device_size_bytes() != 0) {
+                candidates.push_back({ i, view, false });
+            }
+        }
+    }
+
+    const auto assign = [this](size_t position, MemoryDeviceCandidate& candidate, EdacMatch match) {
+        header_indices_[position] = candidate.header_index;
+        matches_[position] = match;
+        candidate.taken = true;
+    };
+
+    // ghes_edac label is "<bank locator> <device locator>"
+    for (size_t i = 0; i < dimms_.size(); ++i) {
+        for (MemoryDeviceCandidate& candidate : candidates) {
+            const boost::string_view bank = candidate.view.get_bank_locator_string();
+            const boost::string_view device = candidate.view.get_device_locator_string();
+            const boost::string_view label = dimms_[i].label;
+            if (!candidate.taken && label.size() == bank.size() + 1 + device.size() &&
+                label.starts_with(bank) && label[bank.size()] == ' ' && label.ends_with(device)) {
+                assign(i, candidate, EdacMatch::BankAndDeviceLocator);
+                break;
+            }
+        }
+    }
+
+    // label ends with device locator, accepted only if there is a single such device
+    for (size_t i = 0; i < dimms_.size(); ++i) {
+        if (header_indices_[i] != npos) {
+            continue;
+        }
+        MemoryDeviceCandidate* found = nullptr;
+        size_t found_count = 0;
+        for (MemoryDeviceCandidate& candidate : candidates) {
+            if (!candidate.taken && label_ends_with_locator(dimms_[i].label, candidate.view.get_device_locator_string())) {
+                found = &candidate;
+                ++found_count;
+            }
+        }
+        if (found_count == 1) {
+            assign(i, *found, EdacMatch::DeviceLocator);
+        }
+    }
+
+    // EDAC enumerates DIMMs in table order; pair the rest if counts and sizes agree
+    std::vector<size_t> unmatched_dimms;
+    std::vector<MemoryDeviceCandidate*> unmatched_devices;
+    for (size_t i = 0; i < dimms_.size(); ++i) {
+        if (header_indices_[i] == npos) {
+            unmatched_dimms.push_back(i);
+        }
+    }
+    for (MemoryDeviceCandidate& candidate : candidates) {
+        if (!candidate.taken) {
+            unmatched_devices.push_back(&candidate);
+        }
+    }
+    if (!unmatched_dimms.empty() && unmatched_dimms.size() == unmatched_devices.size()) {
+        bool sizes_agree = true;
+        for (size_t i = 0; i < unmatched_dimms.size() && sizes_agree; ++i) {
+            const uint64_t size_mb = dimms_[unmatched_dimms[i]].size_mb;
+            sizes_agree = size_mb == 0 || size_mb == (unmatched_devices[i]->view.get_device_size_bytes() >> 20);
+        }
+        for (size_t i = 0; i < unmatched_dimms.size() && sizes_agree; ++i) {
+            assign(unmatched_dimms[i], *unmatched_devices[i], EdacMatch::TableOrder);
+        }
+    }
+
+    ce_count_paths_.reserve(dimms_.size());
+    ue_count_paths_.reserve(dimms_.size());
+    for (const EdacDimm& dimm : dimms_) {
+        ce_count_paths_.push_back(dimm.path + "/dimm_ce_count");
+        ue_count_paths_.push_back(dimm.path + "/dimm_ue_count");
+    }
+}
+
+const std::vector<EdacDimm>& EdacCorrelation::get_dimms() const
+{
+    return dimms_;
+}
+
+size_t EdacCorrelation::get_header_index(size_t dimm_position) const
+{
+    if (dimm_position >= header_indices_.size()) {
+        throw std::out_of_range("EDAC DIMM position is out of range");
+    }
+    return header_indices_[dimm_position];
+}
+
+EdacMatch EdacCorrelation::get_match(size_t dimm_position) const
+{
+    if (dimm_position >= matches_.size()) {
+        throw std::out_of_range("EDAC DIMM position is out of range");
+    }
+    return matches_[dimm_position];
+}
+
+size_t EdacCorrelation::get_matched_count() const
+{
+    return static_cast<size_t>(std::count_if(header_indices_.begin(), header_indices_.end(),
+        [](size_t index) { return index != npos; }));
+}
+
+void EdacCorrelation::read_counters(std::vector<EdacCounters>& counters) const
+{
+    counters.resize(dimms_.size());
+    for (size_t i = 0; i < dimms_.size(); ++i) {
+        counters[i] = EdacCounters{ 0, 0 };
+        read_counter(ce_count_paths_[i], counters[i].corrected);
+        read_counter(ue_count_paths_[i], counters[i].uncorrected);
+    }
+}
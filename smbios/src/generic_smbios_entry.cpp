@@ -0,0 +1,69 @@
+#include <smbios/generic_smbios_entry.h>
+
+#include <sstream>
+#include <stdexcept>
+
+using namespace smbios;
+
+GenericSMBiosEntry::GenericSMBiosEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header), header_(header), version_(version), schema_(find_structure_schema(header.type))
+{
+    if (nullptr == schema_) {
+        throw std::runtime_error("No schema for SMBIOS structure type " + std::to_string(header.type));
+    }
+}
+
+std::string GenericSMBiosEntry::get_type() const
+{
+    return schema_->name;
+}
+
+void GenericSMBiosEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+
+    for_each_field([&out](const DecodedField& field) {
+        const FieldSchema& schema = *field.schema;
+        out << schema.name << ": ";
+
+        switch (schema.kind) {
+        case FieldKind::String:
+        case FieldKind::Enum:
+            if (!field.text.empty()) {
+                out << field.text;
+            }
+            else {
+                out << field.value;
+            }
+            break;
+        case FieldKind::Handle:
+            out << hex(field.value);
+            break;
+        case FieldKind::Bytes:
+            for (size_t i = 0; i < schema.width; ++i) {
+                out << hex_digits(field.bytes[i], 2);
+            }
+            break;
+        case FieldKind::Bitfield:
+            out << '\n';
+            for (size_t bit = 0; bit < schema.width * 8u; ++bit) {
+                if (field.value & (uint64_t(1) << bit)) {
+                    const char* name = find_field_name(schema, static_cast<uint16_t>(bit));
+                    if (name) {
+                        out << '\t' << name << '\n';
+                    }
+                }
+            }
+            return;
+        default:
+            out << field.value;
+            break;
+        }
+        out << '\n';
+    });
+}
+
+const StructureSchema& GenericSMBiosEntry::get_schema() const
+{
+    return *schema_;
+}
@@ -0,0 +1,106 @@
+#include <smbios/handle_graph.h>
+#include <smbios/smbios_schema.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace smbios;
+
+constexpr size_t HandleGraph::npos;
+
+HandleGraph::HandleGraph(const std::vector<DMIHeader>& headers, const SMBiosVersion& version)
+{
+    // single pass over structures: remember own handles and referenced ones
+    std::vector<std::pair<uint32_t, uint16_t>> referenced_handles;
+    handles_.reserve(headers.size());
+    for (size_t i = 0; i < headers.size(); ++i) {
+        const DMIHeader& header = headers[i];
+        handles_.emplace_back(header.handle, static_cast<uint32_t>(i));
+
+        const StructureSchema* schema = find_structure_schema(header.type);
+        if (!schema) {
+            continue;
+        }
+        const FieldSchema* const fields_end = schema->fields + schema->fields_count;
+        for (const FieldSchema* field = schema->fields; field != fields_end; ++field) {
+            if (field->kind == FieldKind::Handle && field_available(*field, header, version)) {
+                const uint16_t handle = static_cast<uint16_t>(decode_field(*field, header).value);
+                if (handle < 0xFFFE) {
+                    referenced_handles.emplace_back(static_cast<uint32_t>(i), handle);
+                }
+            }
+        }
+    }
+    std::sort(handles_.begin(), handles_.end());
+
+    // handles are resolved after the pass, references may point forward
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    edges.reserve(referenced_handles.size());
+    for (const auto& reference : referenced_handles) {
+        const size_t target = find_index(reference.second);
+        if (target != npos && target != reference.first) {
+            edges.emplace_back(reference.first, static_cast<uint32_t>(target));
+        }
+    }
+    references_.assign(headers.size(), edges);
+
+    for (auto& edge : edges) {
+        std::swap(edge.first, edge.second);
+    }
+    referrers_.assign(headers.size(), edges);
+}
+
+size_t HandleGraph::find_index(uint16_t handle) const
+{
+    auto it = std::lower_bound(handles_.begin(), handles_.end(), std::make_pair(handle, uint32_t(0)));
+    if (it != handles_.end() && it->first == handle) {
+        return it->second;
+    }
+    return npos;
+}
+
+HandleGraphRange HandleGraph::get_references(size_t header_index) const
+{
+    return references_.range(header_index);
+}
+
+HandleGraphRange HandleGraph::get_referrers(size_t header_index) const
+{
+    return referrers_.range(header_index);
+}
+
+size_t HandleGraph::get_vertices_count() const
+{
+    return handles_.size();
+}
+
+size_t HandleGraph::get_edges_count() const
+{
+    return references_.edges.size();
+}
+
+void HandleGraph::Adjacency::assign(size_t vertices_count, const std::vector<std::pair<uint32_t, uint32_t>>& pairs)
+{
+    // counting sort keeps the table order of adjacent vertices
+    offsets.assign(vertices_count + 1, 0);
+    for (const auto& pair : pairs) {
+        ++offsets[pair.first + 1];
+    }
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+
+    edges.resize(pairs.size());
+    std::vector<uint32_t> positions(offsets.begin(), offsets.end() - 1);
+    for (const auto& pair : pairs) {
+        edges[positions[pair.first]++] = pair.second;
+    }
+}
+
+HandleGraphRange HandleGraph::Adjacency::range(size_t vertex) const
+{
+    if (vertex + 1 >= offsets.size()) {
+        throw std::out_of_range("SMBIOS header index is out of range");
+    }
+    return HandleGraphRange(edges.data() + offsets[vertex], edges.data() + offsets[vertex + 1]);
+}
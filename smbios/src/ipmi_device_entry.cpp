@@ -0,0 +1,120 @@
+#include <smbios/ipmi_device_entry.h>
+#include <smbios/smbios.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t IpmiDeviceEntry::structure_type;
+
+constexpr SMBiosRevision IpmiDeviceLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<IpmiDeviceLayout::InterruptNumber>(
+    IpmiDeviceLayout::revisions), "2.3 layout");
+
+IpmiDeviceEntry::IpmiDeviceEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::IpmiDevice) {
+        std::stringstream err;
+        err << "Wrong entry type, expected IPMI Device Information, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, IpmiDeviceLayout::revisions);
+}
+
+std::string IpmiDeviceEntry::get_type() const
+{
+    return "IPMI Device Information";
+}
+
+void IpmiDeviceEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Interface Type: " << get_interface_type_string() << '\n';
+    out << "Specification Version: " << static_cast<unsigned>(get_specification_major())
+        << '.' << static_cast<unsigned>(get_specification_minor()) << '\n';
+    out << "I2C Target Address: " << hex(get_i2c_target_address()) << '\n';
+    if (get_interface_type() == InterfaceSSIF) {
+        out << "SMBus Target Address: " << hex(static_cast<uint16_t>(get_base_address())) << '\n';
+    }
+    else {
+        out << "Base Address: " << hex(get_base_address())
+            << (is_io_space() ? " (I/O)" : " (Memory-mapped)") << '\n';
+        out << "Register Spacing: " << static_cast<unsigned>(get_register_spacing()) << " bytes\n";
+    }
+    out << "Interrupt Number: " << static_cast<unsigned>(get_interrupt_number()) << '\n';
+}
+
+uint8_t IpmiDeviceEntry::get_interface_type() const
+{
+    return fields_.get<IpmiDeviceLayout::InterfaceType>(InterfaceUnknown);
+}
+
+uint8_t IpmiDeviceEntry::get_specification_major() const
+{
+    return fields_.get<IpmiDeviceLayout::SpecificationRevision>(0) >> 4;
+}
+
+uint8_t IpmiDeviceEntry::get_specification_minor() const
+{
+    return fields_.get<IpmiDeviceLayout::SpecificationRevision>(0) & 0x0F;
+}
+
+uint8_t IpmiDeviceEntry::get_i2c_target_address() const
+{
+    return fields_.get<IpmiDeviceLayout::I2CTargetAddress>(0);
+}
+
+uint8_t IpmiDeviceEntry::get_nv_storage_device_address() const
+{
+    return fields_.get<IpmiDeviceLayout::NVStorageDeviceAddress>(0xFF);
+}
+
+uint64_t IpmiDeviceEntry::get_base_address() const
+{
+    const uint64_t base_address = fields_.get<IpmiDeviceLayout::BaseAddress>(0);
+    if (get_interface_type() == InterfaceSSIF) {
+        // 7-bit SMBus address stored shifted left
+        return (base_address >> 1) & 0x7F;
+    }
+
+    // bit 0 is the address space, the real least significant bit is in the modifier
+    const uint8_t modifier = fields_.get<IpmiDeviceLayout::BaseAddressModifier>(0);
+    return (base_address & ~uint64_t(1)) | ((modifier & AddressLsb) ? 1 : 0);
+}
+
+bool IpmiDeviceEntry::is_io_space() const
+{
+    return 0 != (fields_.get<IpmiDeviceLayout::BaseAddress>(0) & 1);
+}
+
+uint8_t IpmiDeviceEntry::get_register_spacing() const
+{
+    // successive bytes if the modifier is not present
+    static const uint8_t spacing[] = { 1, 4, 16, 0 };
+    return spacing[(fields_.get<IpmiDeviceLayout::BaseAddressModifier>(0) & RegisterSpacingMask) >> 6];
+}
+
+uint8_t IpmiDeviceEntry::get_interrupt_number() const
+{
+    return fields_.get<IpmiDeviceLayout::InterruptNumber>(0);
+}
+
+std::string IpmiDeviceEntry::get_interface_type_string() const
+{
+    switch (get_interface_type()) {
+    case InterfaceKCS:
+        return "KCS";
+    case InterfaceSMIC:
+        return "SMIC";
+    case InterfaceBT:
+        return "BT";
+    case InterfaceSSIF:
+        return "SSIF";
+    default:
+        return "Unknown";
+    }
+}
@@ -0,0 +1,226 @@
+#include <smbios/json_writer.h>
+
+using namespace smbios;
+
+namespace {
+
+/// Escape table: 0 - copy as is, 'u' - \u00XX form, '8' - UTF-8 lead byte candidate,
+/// other - symbol after backslash
+struct EscapeTable {
+    char symbols[256];
+
+    constexpr EscapeTable() : symbols()
+    {
+        for (size_t i = 0; i < 0x20; ++i) {
+            symbols[i] = 'u';
+        }
+        symbols[static_cast<size_t>('\b')] = 'b';
+        symbols[static_cast<size_t>('\f')] = 'f';
+        symbols[static_cast<size_t>('\n')] = 'n';
+        symbols[static_cast<size_t>('\r')] = 'r';
+        symbols[static_cast<size_t>('\t')] = 't';
+        symbols[static_cast<size_t>('"')] = '"';
+        symbols[static_cast<size_t>('\\')] = '\\';
+        for (size_t i = 0x80; i < 0x100; ++i) {
+            symbols[i] = '8';
+        }
+    }
+};
+
+constexpr EscapeTable escape_table;
+
+bool is_continuation(const char* current, const char* end)
+{
+    return current < end && (static_cast<uint8_t>(*current) & 0xC0) == 0x80;
+}
+
+/// Length of the well-formed UTF-8 sequence at current, 0 if malformed
+/// (overlong forms, surrogates and code points above 10FFFFh are rejected, RFC 3629)
+size_t utf8_sequence_length(const char* current, const char* end)
+{
+    const uint8_t lead = static_cast<uint8_t>(*current);
+    const uint8_t second = current + 1 < end ? static_cast<uint8_t>(current[1]) : 0;
+
+    size_t length = 0;
+    bool second_valid = (second & 0xC0) == 0x80;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        if (lead == 0xE0) {
+            second_valid = second >= 0xA0 && second <= 0xBF;
+        }
+        else if (lead == 0xED) {
+            second_valid = second >= 0x80 && second <= 0x9F;
+        }
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        if (lead == 0xF0) {
+            second_valid = second >= 0x90 && second <= 0xBF;
+        }
+        else if (lead == 0xF4) {
+            second_valid = second >= 0x80 && second <= 0x8F;
+        }
+    }
+
+    if (0 == length || !second_valid) {
+        return 0;
+    }
+    for (size_t i = 2; i < length; ++i) {
+        if (!is_continuation(current + i, end)) {
+            return 0;
+        }
+    }
+    return length;
+}
+
+} // namespace
+
+constexpr size_t JsonWriter::max_depth;
+
+void smbios::append_json_string(RenderBuffer& out, boost::string_view text)
+{
+    out << '"';
+
+    // copy unescaped runs at once
+    const char* run = text.data();
+    const char* const end = text.data() + text.size();
+    for (const char* current = run; current != end; ++current) {
+        const char escape = escape_table.symbols[static_cast<uint8_t>(*current)];
+        if (0 == escape) {
+            continue;
+        }
+        if ('8' == escape) {
+            const size_t length = utf8_sequence_length(current, end);
+            if (0 != length) {
+                current += length - 1;
+                continue;
+            }
+        }
+        out.append(run, current - run);
+        run = current + 1;
+
+        // malformed UTF-8 byte is taken as Latin-1
+        if ('u' == escape || '8' == escape) {
+            out.append("\\u00", 4);
+            out << hex_digits(static_cast<uint8_t>(*current), 2);
+        }
+        else {
+            const char escaped[] = { '\\', escape };
+            out.append(escaped, sizeof(escaped));
+        }
+    }
+    out.append(run, end - run);
+
+    out << '"';
+}
+
+JsonWriter::JsonWriter(RenderBuffer& out) : out_(out)
+{
+}
+
+void JsonWriter::separate()
+{
+    if (after_key_) {
+        after_key_ = false;
+        return;
+    }
+    const uint64_t level_bit = uint64_t(1) << (depth_ % max_depth);
+    if (has_elements_ & level_bit) {
+        out_ << ',';
+    }
+    has_elements_ |= level_bit;
+}
+
+void JsonWriter::open(char bracket)
+{
+    separate();
+    out_ << bracket;
+    ++depth_;
+    has_elements_ &= ~(uint64_t(1) << (depth_ % max_depth));
+}
+
+void JsonWriter::close(char bracket)
+{
+    out_ << bracket;
+    --depth_;
+}
+
+JsonWriter& JsonWriter::begin_object()
+{
+    open('{');
+    return *this;
+}
+
+JsonWriter& JsonWriter::end_object()
+{
+    close('}');
+    return *this;
+}
+
+JsonWriter& JsonWriter::begin_array()
+{
+    open('[');
+    return *this;
+}
+
+JsonWriter& JsonWriter::end_array()
+{
+    close(']');
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(boost::string_view name)
+{
+    separate();
+    append_json_string(out_, name);
+    out_ << ':';
+    after_key_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::string(boost::string_view text)
+{
+    separate();
+    append_json_string(out_, text);
+    return *this;
+}
+
+JsonWriter& JsonWriter::number(uint64_t value)
+{
+    separate();
+    out_.append_decimal(value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::boolean(bool value)
+{
+    separate();
+    if (value) {
+        out_.append("true", 4);
+    }
+    else {
+        out_.append("false", 5);
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::null()
+{
+    separate();
+    out_.append("null", 4);
+    return *this;
+}
+
+JsonWriter& JsonWriter::hex_bytes(const uint8_t* bytes, size_t size)
+{
+    separate();
+    out_ << '"';
+    for (size_t i = 0; i < size; ++i) {
+        out_ << hex_digits(bytes[i], 2);
+    }
+    out_ << '"';
+    return *this;
+}
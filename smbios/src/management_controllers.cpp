@@ -0,0 +1,42 @@
+#include <smbios/management_controllers.h>
+#include <smbios/ipmi_device_entry.h>
+
+using namespace smbios;
+
+ManagementControllers smbios::find_management_controllers(const std::vector<DMIHeader>& headers,
+    const SMBiosVersion& version)
+{
+    ManagementControllers controllers;
+
+    for (const DMIHeader& header : headers) {
+        if (header.type == SMBios::IpmiDevice) {
+            const IpmiDeviceEntry entry(header, version);
+            IpmiInterface ipmi;
+            ipmi.handle = header.handle;
+            ipmi.interface_type = entry.get_interface_type();
+            ipmi.specification_major = entry.get_specification_major();
+            ipmi.specification_minor = entry.get_specification_minor();
+            ipmi.i2c_target_address = entry.get_i2c_target_address();
+            ipmi.base_address = entry.get_base_address();
+            ipmi.io_space = entry.is_io_space();
+            ipmi.register_spacing = entry.get_register_spacing();
+            ipmi.interrupt_number = entry.get_interrupt_number();
+            controllers.ipmi_interfaces.push_back(ipmi);
+        }
+        else if (header.type == SMBios::ManagementHostInterface) {
+            const ManagementHostInterfaceEntry entry(header, version);
+            HostInterface host_interface;
+            host_interface.handle = header.handle;
+            host_interface.interface_type = entry.get_interface_type();
+            host_interface.network_device_type = entry.get_network_device_type();
+            for (const HostInterfaceProtocolRecord& record : entry.get_protocol_records()) {
+                RedfishOverIpRecord redfish;
+                if (decode_redfish_over_ip(record, redfish)) {
+                    host_interface.redfish_services.push_back(std::move(redfish));
+                }
+            }
+            controllers.host_interfaces.push_back(std::move(host_interface));
+        }
+    }
+    return controllers;
+}
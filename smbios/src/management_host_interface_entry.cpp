@@ -0,0 +1,192 @@
+#include <smbios/management_host_interface_entry.h>
+#include <smbios/smbios.h>
+#include <smbios/system_identity.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t ManagementHostInterfaceEntry::structure_type;
+
+constexpr SMBiosRevision ManagementHostInterfaceLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<ManagementHostInterfaceLayout::InterfaceDataLength>(
+    ManagementHostInterfaceLayout::revisions), "2.7 layout");
+
+namespace {
+
+// Redfish over IP record offsets, DSP0270
+constexpr size_t redfish_host_ip_assignment_offset = 16;
+constexpr size_t redfish_service_ip_discovery_offset = 50;
+constexpr size_t redfish_service_ip_port_offset = 84;
+constexpr size_t redfish_service_vlan_offset = 86;
+constexpr size_t redfish_hostname_length_offset = 90;
+constexpr size_t redfish_minimal_length = 91;
+
+// Host IP Address Format and Redfish Service IP Address Format values
+constexpr uint8_t ip_format_ipv4 = 0x01;
+constexpr uint8_t ip_format_ipv6 = 0x02;
+
+// Protocol records appeared in 3.0, Redfish UUID has the same layout as System UUID
+const SMBiosVersion protocol_records_version = { 3, 0 };
+
+} // namespace
+
+bool smbios::decode_redfish_over_ip(const HostInterfaceProtocolRecord& record, RedfishOverIpRecord& redfish)
+{
+    if (record.protocol_type != ManagementHostInterfaceEntry::ProtocolRedfishOverIp ||
+        record.length < redfish_minimal_length || nullptr == record.data) {
+        return false;
+    }
+
+    const uint8_t* data = record.data;
+    std::copy_n(data, sizeof(redfish.service_uuid), redfish.service_uuid);
+    normalize_uuid(redfish.service_uuid, protocol_records_version);
+
+    const uint8_t* host = data + redfish_host_ip_assignment_offset;
+    redfish.host_ip_assignment_type = host[0];
+    redfish.host_ip_address_format = host[1];
+    std::copy_n(host + 2, 16, redfish.host_ip_address);
+    std::copy_n(host + 18, 16, redfish.host_ip_mask);
+
+    const uint8_t* service = data + redfish_service_ip_discovery_offset;
+    redfish.service_ip_discovery_type = service[0];
+    redfish.service_ip_address_format = service[1];
+    std::copy_n(service + 2, 16, redfish.service_ip_address);
+    std::copy_n(service + 18, 16, redfish.service_ip_mask);
+
+    std::memcpy(&redfish.service_ip_port, data + redfish_service_ip_port_offset, sizeof(redfish.service_ip_port));
+    std::memcpy(&redfish.service_vlan_id, data + redfish_service_vlan_offset, sizeof(redfish.service_vlan_id));
+
+    const size_t hostname_length = std::min<size_t>(data[redfish_hostname_length_offset],
+        record.length - redfish_minimal_length);
+    const char* hostname = reinterpret_cast<const char*>(data + redfish_minimal_length);
+    // hostname may be zero-terminated within its length
+    redfish.service_hostname.assign(hostname, std::find(hostname, hostname + hostname_length, '\0'));
+    return true;
+}
+
+std::string smbios::format_ip_address(uint8_t address_format, const uint8_t (&address)[16])
+{
+    RenderBuffer text;
+    append_ip_address(text, address_format, address);
+    return text.str();
+}
+
+void smbios::append_ip_address(RenderBuffer& text, uint8_t address_format, const uint8_t (&address)[16])
+{
+    if (address_format == ip_format_ipv4) {
+        text << static_cast<unsigned>(address[0]) << '.' << static_cast<unsigned>(address[1]) << '.'
+             << static_cast<unsigned>(address[2]) << '.' << static_cast<unsigned>(address[3]);
+    }
+    else if (address_format == ip_format_ipv6) {
+        // full form without zero compression
+        for (size_t i = 0; i < 16; i += 2) {
+            if (i) {
+                text << ':';
+            }
+            text << hex_digits((static_cast<unsigned>(address[i]) << 8) | address[i + 1], 1);
+        }
+    }
+}
+
+ManagementHostInterfaceEntry::ManagementHostInterfaceEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header), length_(header.length)
+{
+    if (header.type != SMBios::ManagementHostInterface) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Management Controller Host Interface, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, ManagementHostInterfaceLayout::revisions);
+    protocol_records_ = !(version < protocol_records_version);
+}
+
+std::string ManagementHostInterfaceEntry::get_type() const
+{
+    return "Management Controller Host Interface";
+}
+
+void ManagementHostInterfaceEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Interface Type: " << hex(get_interface_type()) << '\n';
+    if (get_interface_type() == InterfaceNetwork) {
+        out << "Device Type: " << hex(get_network_device_type()) << '\n';
+    }
+
+    for (const HostInterfaceProtocolRecord& record : get_protocol_records()) {
+        out << "Protocol Type: " << hex(record.protocol_type) << '\n';
+        RedfishOverIpRecord redfish;
+        if (decode_redfish_over_ip(record, redfish)) {
+            out << "\tService UUID: ";
+            append_uuid(out, redfish.service_uuid);
+            out << "\n\tHost IP Address: ";
+            append_ip_address(out, redfish.host_ip_address_format, redfish.host_ip_address);
+            out << "\n\tRedfish Service IP Address: ";
+            append_ip_address(out, redfish.service_ip_address_format, redfish.service_ip_address);
+            out << '\n';
+            out << "\tRedfish Service IP Port: " << redfish.service_ip_port << '\n';
+            out << "\tRedfish Service VLAN: " << redfish.service_vlan_id << '\n';
+            out << "\tRedfish Service Hostname: " << redfish.service_hostname << '\n';
+        }
+    }
+}
+
+uint8_t ManagementHostInterfaceEntry::get_interface_type() const
+{
+    return fields_.get<ManagementHostInterfaceLayout::InterfaceType>(0);
+}
+
+uint8_t ManagementHostInterfaceEntry::get_interface_data_length() const
+{
+    return fields_.get<ManagementHostInterfaceLayout::InterfaceDataLength>(0);
+}
+
+const uint8_t* ManagementHostInterfaceEntry::get_interface_data() const
+{
+    const size_t data_end = ManagementHostInterfaceLayout::InterfaceDataLength::length + get_interface_data_length();
+    if (!fields_.has<ManagementHostInterfaceLayout::InterfaceDataLength>() || data_end > length_) {
+        return nullptr;
+    }
+    return fields_.data() + ManagementHostInterfaceLayout::InterfaceDataLength::length;
+}
+
+uint8_t ManagementHostInterfaceEntry::get_network_device_type() const
+{
+    const uint8_t* data = get_interface_data();
+    if (get_interface_type() != InterfaceNetwork || nullptr == data || 0 == get_interface_data_length()) {
+        return 0;
+    }
+    return data[0];
+}
+
+std::vector<HostInterfaceProtocolRecord> ManagementHostInterfaceEntry::get_protocol_records() const
+{
+    std::vector<HostInterfaceProtocolRecord> records;
+    const uint8_t* interface_data = get_interface_data();
+    if (!protocol_records_ || nullptr == interface_data) {
+        return records;
+    }
+
+    const uint8_t* structure_end = fields_.data() + length_;
+    const uint8_t* current = interface_data + get_interface_data_length();
+    if (current >= structure_end) {
+        return records;
+    }
+
+    const uint8_t records_count = *current++;
+    for (uint8_t i = 0; i < records_count && current + 2 <= structure_end; ++i) {
+        const HostInterfaceProtocolRecord record = { current[0], current[1], current + 2 };
+        if (record.data + record.length > structure_end) {
+            break;
+        }
+        records.push_back(record);
+        current = record.data + record.length;
+    }
+    return records;
+}
@@ -0,0 +1,58 @@
+#include <smbios/memory_address_index.h>
+#include <smbios/smbios.h>
+#include <smbios/handle_graph.h>
+
+using namespace smbios;
+
+MemoryAddressIndex::MemoryAddressIndex(const SMBios& smbios)
+{
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+
+    // device ranges refer to devices by handle, resolved by the handle graph
+    const HandleGraph& graph = smbios.handle_graph();
+    for (size_t i = 0; i < headers.size(); ++i) {
+        switch (headers[i].type) {
+        case SMBios::MemoryDeviceMappedAddress:
+        {
+            const auto device_range = static_cast<const MemoryDeviceMappedAddressEntry*>(smbios.entry(i));
+            const size_t device_index = graph.find_index(device_range->get_device_handle());
+            if (device_index != HandleGraph::npos && headers[device_index].type == SMBios::MemoryDevice) {
+                devices_.add(device_range->get_address_range(),
+                    static_cast<const MemoryDeviceEntry*>(smbios.entry(device_index)));
+            }
+            break;
+        }
+        case SMBios::MemoryArrayMappedAddress:
+        {
+            const auto array_range = static_cast<const MemoryArrayMappedAddressEntry*>(smbios.entry(i));
+            arrays_.add(array_range->get_address_range(), array_range);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    devices_.build();
+    arrays_.build();
+}
+
+const MemoryDeviceEntry* MemoryAddressIndex::find_device(uint64_t address) const
+{
+    return devices_.find(address, nullptr);
+}
+
+const MemoryArrayMappedAddressEntry* MemoryAddressIndex::find_array_range(uint64_t address) const
+{
+    return arrays_.find(address, nullptr);
+}
+
+size_t MemoryAddressIndex::get_device_ranges_count() const
+{
+    return devices_.size();
+}
+
+size_t MemoryAddressIndex::get_array_ranges_count() const
+{
+    return arrays_.size();
+}
@@ -0,0 +1,94 @@
+#include <smbios/memory_array_mapped_address_entry.h>
+#include <smbios/smbios.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t MemoryArrayMappedAddressEntry::structure_type;
+
+constexpr SMBiosRevision MemoryArrayMappedAddressLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<MemoryArrayMappedAddressLayout::PartitionWidth>(
+    MemoryArrayMappedAddressLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<MemoryArrayMappedAddressLayout::ExtendedEndingAddress>(
+    MemoryArrayMappedAddressLayout::revisions), "2.7 layout");
+
+MappedAddressRange smbios::resolve_mapped_range(uint32_t starting_kb, uint32_t ending_kb,
+    bool extended_present, uint64_t extended_starting, uint64_t extended_ending)
+{
+    if (starting_kb == 0xFFFFFFFF) {
+        if (!extended_present) {
+            return MappedAddressRange{ UINT64_MAX, 0 };
+        }
+        return MappedAddressRange{ extended_starting, extended_ending };
+    }
+    // ending address is the address of the last kilobyte, include all its bytes
+    return MappedAddressRange{ uint64_t(starting_kb) << 10, (uint64_t(ending_kb) << 10) | 0x3FF };
+}
+
+MemoryArrayMappedAddressEntry::MemoryArrayMappedAddressEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::MemoryArrayMappedAddress) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Memory Array Mapped Address, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, MemoryArrayMappedAddressLayout::revisions);
+}
+
+std::string MemoryArrayMappedAddressEntry::get_type() const
+{
+    return "Memory Array Mapped Address";
+}
+
+void MemoryArrayMappedAddressEntry::render_to(RenderBuffer& out) const
+{
+    const MappedAddressRange range = get_address_range();
+
+    out << "Header type: " << get_type() << '\n';
+    out << "Starting Address: " << hex(range.begin) << '\n';
+    out << "Ending Address: " << hex(range.end) << '\n';
+    out << "Array Handle: " << hex(get_array_handle()) << '\n';
+    out << "Partition Width: " << static_cast<unsigned>(get_partition_width()) << '\n';
+}
+
+uint32_t MemoryArrayMappedAddressEntry::get_starting_address_kb() const
+{
+    return fields_.get<MemoryArrayMappedAddressLayout::StartingAddress>(0);
+}
+
+uint32_t MemoryArrayMappedAddressEntry::get_ending_address_kb() const
+{
+    return fields_.get<MemoryArrayMappedAddressLayout::EndingAddress>(0);
+}
+
+uint16_t MemoryArrayMappedAddressEntry::get_array_handle() const
+{
+    return fields_.get<MemoryArrayMappedAddressLayout::ArrayHandle>(0xFFFF);
+}
+
+uint8_t MemoryArrayMappedAddressEntry::get_partition_width() const
+{
+    return fields_.get<MemoryArrayMappedAddressLayout::PartitionWidth>(0);
+}
+
+uint64_t MemoryArrayMappedAddressEntry::get_extended_starting_address() const
+{
+    return fields_.get<MemoryArrayMappedAddressLayout::ExtendedStartingAddress>(0);
+}
+
+uint64_t MemoryArrayMappedAddressEntry::get_extended_ending_address() const
+{
+    return fields_.get<MemoryArrayMappedAddressLayout::ExtendedEndingAddress>(0);
+}
+
+MappedAddressRange MemoryArrayMappedAddressEntry::get_address_range() const
+{
+    return resolve_mapped_range(get_starting_address_kb(), get_ending_address_kb(),
+        fields_.has<MemoryArrayMappedAddressLayout::ExtendedEndingAddress>(),
+        get_extended_starting_address(), get_extended_ending_address());
+}
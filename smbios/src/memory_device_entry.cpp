@@ -7,185 +7,170 @@
 using std::string;
 using namespace smbios;
 
-MemoryDeviceEntry::MemoryDeviceEntry(const DMIHeader& header, const SMBiosVersion& version) 
-    : AbstractSMBiosEntry(header){
+constexpr uint8_t MemoryDeviceEntry::structure_type;
 
-    if (header.type != SMBios::MemoryDevice) {
-        std::stringstream err;
-        err << "Wrong entry type, expected Memory device, called Type = " << header.type;
-        throw std::runtime_error(err.str().c_str());
-    }
+constexpr SMBiosRevision MemoryDeviceLayout::revisions[];
 
-    init_string_values();
+// the last field of every revision should fit into it
+static_assert(field_in_revision<MemoryDeviceLayout::TypeDetail>(MemoryDeviceLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<MemoryDeviceLayout::PartNumber>(MemoryDeviceLayout::revisions), "2.3 layout");
+static_assert(field_in_revision<MemoryDeviceLayout::DeviceRank>(MemoryDeviceLayout::revisions), "2.6 layout");
+static_assert(field_in_revision<MemoryDeviceLayout::MemoryClockSpeed>(MemoryDeviceLayout::revisions), "2.7 layout");
+static_assert(field_in_revision<MemoryDeviceLayout::ConfiguredVoltage>(MemoryDeviceLayout::revisions), "2.8 layout");
 
-    // check empty entry
-    if ((header.length < 0x15) || (version < SMBiosVersion{ 2, 1 }))
-        return;
-
-    // 2.1+
-    if ((header.length >= 0x15) && (version > SMBiosVersion{ 2, 0 })) {
-        memory_device_v21_ = reinterpret_cast<const MemoryDeviceV21*>(header.data);
+uint64_t smbios::memory_device_size_bytes(uint16_t device_size, uint32_t extended_size)
+{
+    constexpr uint16_t use_extended_size = 0x7FFF;
+    if (MemoryDeviceEntry::DeviceSizeNoModuleInstalled == device_size ||
+        MemoryDeviceEntry::DeviceSizeUnknown == device_size) {
+        return 0;
     }
-
-    // 2.3+
-    if ((header.length >= 0x17) && (version > SMBiosVersion{ 2, 2 })) {
-        memory_device_v23_ = reinterpret_cast<const MemoryDeviceV23*>(header.data);
+    if (use_extended_size == device_size) {
+        // Bit 31 is reserved
+        return uint64_t(extended_size & 0x7FFFFFFF) << 20;
     }
-
-    // 2.6+
-    if ((header.length >= 0x1B) && (version > SMBiosVersion{ 2, 5 })) {
-        memory_device_v26_ = reinterpret_cast<const MemoryDeviceV26*>(header.data);
+    if (device_size & 0x8000) {
+        return uint64_t(device_size & 0x7FFF) << 10;
     }
+    return uint64_t(device_size) << 20;
+}
 
-    // 2.7+
-    if((header.length >= 0x1C) && (version > SMBiosVersion{ 2, 6 })){
-        memory_device_v27_ = reinterpret_cast<const MemoryDeviceV27*>(header.data);
-    }
+MemoryDeviceEntry::MemoryDeviceEntry(const DMIHeader& header, const SMBiosVersion& version) 
+    : AbstractSMBiosEntry(header){
 
-    // 2.8+
-    if ((header.length >= 0x22) && (version > SMBiosVersion{ 2, 7 })) {
-        memory_device_v28_ = reinterpret_cast<const MemoryDeviceV28*>(header.data);
+    if (header.type != SMBios::MemoryDevice) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Memory device, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
     }
-}
 
-void MemoryDeviceEntry::init_string_values()
-{
-    error_handle_map_[ErrorHandleNotProvided] = "Not Provided";
-    error_handle_map_[ErrorHandleNoError] = "No Error";
-
-    data_width_map_[DataWidthUnknown1] = "Unknown";
-    data_width_map_[DataWidthUnknown2] = "Unknown";
-
-    device_size_map_[DeviceSizeNoModuleInstalled] = "No Module Installed";
-    device_size_map_[DeviceSizeUnknown] = "Unknown";
-
-    form_factor_map_[FormFactorOutOfSpec] = "OutOfSpec";
-    form_factor_map_[FormFactorOther] = "Other";
-    form_factor_map_[FormFactorUnknown] = "Unknown";
-    form_factor_map_[SIMM] = "SIMM";
-    form_factor_map_[SIP] = "SIP";
-    form_factor_map_[Chip] = "Chip";
-    form_factor_map_[DIP] = "DIP";
-    form_factor_map_[ZIP] = "ZIP";
-    form_factor_map_[ProprietaryCard] = "Proprietary Card";
-    form_factor_map_[DIMM] = "DIMM";
-    form_factor_map_[TSOP] = "TSOP";
-    form_factor_map_[Rowofchips] = "Rowofchips";
-    form_factor_map_[RIMM] = "RIMM";
-    form_factor_map_[SODIMM] = "SODIMM";
-    form_factor_map_[SRIMM] = "SRIMM";
-    form_factor_map_[FBDIMM] = "FBDIMM";
-
-    device_set_map_[DeviceSetNone] = "None";
-    device_set_map_[DeviceSetUnknown] = "Unknown";
-
-    device_type_map_[DeviceTypeOutOfSpec] = "OutOfSpec";
-    device_type_map_[DeviceTypeOther] = "Other";
-    device_type_map_[DeviceTypeUnknown] = "Unknown";
-    device_type_map_[DRAM] = "DRAM";
-    device_type_map_[EDRAM] = "EDRAM";
-    device_type_map_[VRAM] = "VRAM";
-    device_type_map_[SRAM] = "SRAM";
-    device_type_map_[RAM] = "RAM";
-    device_type_map_[ROM] = "ROM";
-    device_type_map_[FLAS] = "FLAS";
-    device_type_map_[EEPROM] = "EEPROM";
-    device_type_map_[FEPROM] = "FEPROM";
-    device_type_map_[EPROM] = "EPROM";
-    device_type_map_[CDRAM] = "CDRAM";
-    device_type_map_[D3DRAM] = "D3DRAM";
-    device_type_map_[SDRAM] = "SDRAM";
-    device_type_map_[SGRAM] = "SGRAM";
-    device_type_map_[RDRAM] = "RDRAM";
-    device_type_map_[DDR] = "DDR";
-    device_type_map_[DDR2] = "DDR2";
-    device_type_map_[DDR2FB] = "DDR2FB";
-    device_type_map_[Reserved1] = "Reserved";
-    device_type_map_[Reserved2] = "Reserved";
-    device_type_map_[Reserved3] = "Reserved";
-    device_type_map_[DDR3] = "DDR3";
-    device_type_map_[FBD2] = "FBD2";
-    device_type_map_[DDR4] = "DDR4";
-    device_type_map_[LPDDR] = "LPDDR";
-    device_type_map_[LPDDR2] = "LPDDR2";
-    device_type_map_[LPDDR3] = "LPDDR3";
-    device_type_map_[LPDDR4] = "LPDDR4";
-
-    device_properties_map_[DevicePropertiesOutOfSpec] = "OutOfSpec";
-    device_properties_map_[DevicePropertiesReserved] = "Reserved";
-    device_properties_map_[DevicePropertiesOther] = "Other";
-    device_properties_map_[DevicePropertiesUnknown] = "Unknown";
-    device_properties_map_[FastPaged] = "Fast-Paged";
-    device_properties_map_[StaticColumn] = "Static Column";
-    device_properties_map_[PseudoStatic] = "Pseudo-Static";
-    device_properties_map_[RAMBUS] = "RAMBUS";
-    device_properties_map_[Synchronous] = "Synchronous";
-    device_properties_map_[CMOS] = "CMOS";
-    device_properties_map_[EDO] = "EDO";
-    device_properties_map_[WindowDRAM] = "WindowDRAM";
-    device_properties_map_[CacheDRAM] = "CacheDRAM";
-    device_properties_map_[NonVolatile] = "Non-Volatile";
-    device_properties_map_[Registered] = "Registered";
-    device_properties_map_[Unregistered] = "Non-Registered";
-    device_properties_map_[LRDIMM] = "LRDIMM";
-
-    device_speed_map_[DeviceSpeedUnknown] = "Unknown";
-    device_speed_map_[DeviceSpeedReserved] = "Reserved";
+    fields_ = SMBiosFieldReader(header, version, MemoryDeviceLayout::revisions);
+}
+
+const MemoryDeviceEntry::StringValues& MemoryDeviceEntry::string_values()
+{
+    static const StringValues values = []() {
+        StringValues filled;
+        init_string_values(filled);
+        return filled;
+    }();
+    return values;
+}
+
+void MemoryDeviceEntry::init_string_values(StringValues& values)
+{
+    values.error_handle_map[ErrorHandleNotProvided] = "Not Provided";
+    values.error_handle_map[ErrorHandleNoError] = "No Error";
+
+    values.data_width_map[DataWidthUnknown1] = "Unknown";
+    values.data_width_map[DataWidthUnknown2] = "Unknown";
+
+    values.device_size_map[DeviceSizeNoModuleInstalled] = "No Module Installed";
+    values.device_size_map[DeviceSizeUnknown] = "Unknown";
+
+    values.form_factor_map[FormFactorOutOfSpec] = "OutOfSpec";
+    values.form_factor_map[FormFactorOther] = "Other";
+    values.form_factor_map[FormFactorUnknown] = "Unknown";
+    values.form_factor_map[SIMM] = "SIMM";
+    values.form_factor_map[SIP] = "SIP";
+    values.form_factor_map[Chip] = "Chip";
+    values.form_factor_map[DIP] = "DIP";
+    values.form_factor_map[ZIP] = "ZIP";
+    values.form_factor_map[ProprietaryCard] = "Proprietary Card";
+    values.form_factor_map[DIMM] = "DIMM";
+    values.form_factor_map[TSOP] = "TSOP";
+    values.form_factor_map[Rowofchips] = "Rowofchips";
+    values.form_factor_map[RIMM] = "RIMM";
+    values.form_factor_map[SODIMM] = "SODIMM";
+    values.form_factor_map[SRIMM] = "SRIMM";
+    values.form_factor_map[FBDIMM] = "FBDIMM";
+
+    values.device_set_map[DeviceSetNone] = "None";
+    values.device_set_map[DeviceSetUnknown] = "Unknown";
+
+    values.device_type_map[DeviceTypeOutOfSpec] = "OutOfSpec";
+    values.device_type_map[DeviceTypeOther] = "Other";
+    values.device_type_map[DeviceTypeUnknown] = "Unknown";
+    values.device_type_map[DRAM] = "DRAM";
+    values.device_type_map[EDRAM] = "EDRAM";
+    values.device_type_map[VRAM] = "VRAM";
+    values.device_type_map[SRAM] = "SRAM";
+    values.device_type_map[RAM] = "RAM";
+    values.device_type_map[ROM] = "ROM";
+    values.device_type_map[FLAS] = "FLAS";
+    values.device_type_map[EEPROM] = "EEPROM";
+    values.device_type_map[FEPROM] = "FEPROM";
+    values.device_type_map[EPROM] = "EPROM";
+    values.device_type_map[CDRAM] = "CDRAM";
+    values.device_type_map[D3DRAM] = "D3DRAM";
+    values.device_type_map[SDRAM] = "SDRAM";
+    values.device_type_map[SGRAM] = "SGRAM";
+    values.device_type_map[RDRAM] = "RDRAM";
+    values.device_type_map[DDR] = "DDR";
+    values.device_type_map[DDR2] = "DDR2";
+    values.device_type_map[DDR2FB] = "DDR2FB";
+    values.device_type_map[Reserved1] = "Reserved";
+    values.device_type_map[Reserved2] = "Reserved";
+    values.device_type_map[Reserved3] = "Reserved";
+    values.device_type_map[DDR3] = "DDR3";
+    values.device_type_map[FBD2] = "FBD2";
+    values.device_type_map[DDR4] = "DDR4";
+    values.device_type_map[LPDDR] = "LPDDR";
+    values.device_type_map[LPDDR2] = "LPDDR2";
+    values.device_type_map[LPDDR3] = "LPDDR3";
+    values.device_type_map[LPDDR4] = "LPDDR4";
+
+    values.device_properties_map[DevicePropertiesOutOfSpec] = "OutOfSpec";
+    values.device_properties_map[DevicePropertiesReserved] = "Reserved";
+    values.device_properties_map[DevicePropertiesOther] = "Other";
+    values.device_properties_map[DevicePropertiesUnknown] = "Unknown";
+    values.device_properties_map[FastPaged] = "Fast-Paged";
+    values.device_properties_map[StaticColumn] = "Static Column";
+    values.device_properties_map[PseudoStatic] = "Pseudo-Static";
+    values.device_properties_map[RAMBUS] = "RAMBUS";
+    values.device_properties_map[Synchronous] = "Synchronous";
+    values.device_properties_map[CMOS] = "CMOS";
+    values.device_properties_map[EDO] = "EDO";
+    values.device_properties_map[WindowDRAM] = "WindowDRAM";
+    values.device_properties_map[CacheDRAM] = "CacheDRAM";
+    values.device_properties_map[NonVolatile] = "Non-Volatile";
+    values.device_properties_map[Registered] = "Registered";
+    values.device_properties_map[Unregistered] = "Non-Registered";
+    values.device_properties_map[LRDIMM] = "LRDIMM";
+
+    values.device_speed_map[DeviceSpeedUnknown] = "Unknown";
+    values.device_speed_map[DeviceSpeedReserved] = "Reserved";
 }
 
 uint16_t MemoryDeviceEntry::get_array_handle() const
 {
-    if (nullptr == memory_device_v21_) {
-        return 0;
-    }
-
-    return memory_device_v21_->array_handle;
+    return fields_.get<MemoryDeviceLayout::ArrayHandle>(0);
 }
 
 uint16_t MemoryDeviceEntry::get_error_handle() const
 {
-    if (nullptr == memory_device_v21_) {
-        return ErrorHandleValue::ErrorHandleNotProvided;
-    }
-    
-    return memory_device_v21_->array_error_handle;
+    return fields_.get<MemoryDeviceLayout::ErrorHandle>(ErrorHandleValue::ErrorHandleNotProvided);
 }
 
 uint16_t MemoryDeviceEntry::get_total_width() const
 {
-    if (nullptr == memory_device_v21_) {
-        return DataWidthValue::DataWidthUnknown1;
-    }
-
-    return memory_device_v21_->total_width;
+    return fields_.get<MemoryDeviceLayout::TotalWidth>(DataWidthValue::DataWidthUnknown1);
 }
 
 uint16_t MemoryDeviceEntry::get_data_width() const
 {
-    if (nullptr == memory_device_v21_) {
-        return DataWidthValue::DataWidthUnknown1;
-    }
-
-    return memory_device_v21_->data_width;
+    return fields_.get<MemoryDeviceLayout::DataWidth>(DataWidthValue::DataWidthUnknown1);
 }
 
 uint16_t MemoryDeviceEntry::get_device_size() const
 {
-    if (nullptr == memory_device_v21_) {
-        return DeviceSizeValue::DeviceSizeUnknown;
-    }
-
-    return memory_device_v21_->device_size;
+    return fields_.get<MemoryDeviceLayout::DeviceSize>(DeviceSizeValue::DeviceSizeUnknown);
 }
 
 uint8_t MemoryDeviceEntry::get_form_factor() const
 {
-    if (nullptr == memory_device_v21_) {
-        return FormFactorValue::FormFactorOutOfSpec;
-    }
-    
-    auto it = form_factor_map_.find(memory_device_v21_->device_form_factor);
-    if (it != form_factor_map_.end()) {
+    auto it = string_values().form_factor_map.find(fields_.get<MemoryDeviceLayout::FormFactor>(FormFactorValue::FormFactorOutOfSpec));
+    if (it != string_values().form_factor_map.end()) {
         return (*it).first;
     }
     
@@ -196,39 +181,23 @@ uint8_t MemoryDeviceEntry::get_form_factor() const
 
 uint8_t MemoryDeviceEntry::get_device_set() const
 {
-    if (nullptr == memory_device_v21_) {
-        return DeviceSetValue::DeviceSetUnknown;
-    }
-
-    return memory_device_v21_->device_set;
+    return fields_.get<MemoryDeviceLayout::DeviceSet>(DeviceSetValue::DeviceSetUnknown);
 }
 
 uint8_t MemoryDeviceEntry::get_device_locator_index() const
 {
-    if (nullptr == memory_device_v21_) {
-        return 0x0;
-    }
-
-    return memory_device_v21_->device_locator;
+    return fields_.get<MemoryDeviceLayout::DeviceLocator>(0x0);
 }
 
 uint8_t MemoryDeviceEntry::get_bank_locator_index() const
 {
-    if (nullptr == memory_device_v21_) {
-        return 0x0;
-    }
-
-    return memory_device_v21_->bank_locator;
+    return fields_.get<MemoryDeviceLayout::BankLocator>(0x0);
 }
 
 uint8_t MemoryDeviceEntry::get_device_type() const
 {
-    if (nullptr == memory_device_v21_) {
-        return DeviceTypeValue::DeviceTypeOutOfSpec;
-    }
-
-    auto it = device_type_map_.find(memory_device_v21_->device_type);
-    if (it != device_type_map_.end()) {
+    auto it = string_values().device_type_map.find(fields_.get<MemoryDeviceLayout::DeviceType>(DeviceTypeValue::DeviceTypeOutOfSpec));
+    if (it != string_values().device_type_map.end()) {
         return (*it).first;
     }
 
@@ -239,12 +208,8 @@ uint8_t MemoryDeviceEntry::get_device_type() const
 
 uint16_t MemoryDeviceEntry::get_device_detail() const
 {
-    if (nullptr == memory_device_v21_) {
-        return DeviceProperties::DevicePropertiesOutOfSpec;
-    }
-
-    auto it = device_properties_map_.find(memory_device_v21_->type_detail);
-    if (it != device_properties_map_.end()) {
+    auto it = string_values().device_properties_map.find(fields_.get<MemoryDeviceLayout::TypeDetail>(DeviceProperties::DevicePropertiesOutOfSpec));
+    if (it != string_values().device_properties_map.end()) {
         return (*it).first;
     }
 
@@ -253,80 +218,70 @@ uint16_t MemoryDeviceEntry::get_device_detail() const
 
 uint16_t MemoryDeviceEntry::get_device_speed() const
 {
-    if (nullptr == memory_device_v23_) {
-        return DeviceSpeed::DeviceSpeedUnknown;
-    }
-    return memory_device_v23_->device_speed;
+    return fields_.get<MemoryDeviceLayout::DeviceSpeed>(DeviceSpeed::DeviceSpeedUnknown);
 }
 
 uint8_t MemoryDeviceEntry::get_manufacturer_index() const
 {
-    if (nullptr == memory_device_v23_) {
-        return 0;
-    }
-    return memory_device_v23_->manufacturer;
+    return fields_.get<MemoryDeviceLayout::Manufacturer>(0);
 }
 
 uint8_t MemoryDeviceEntry::get_serial_number_index() const
 {
-    if (nullptr == memory_device_v23_) {
-        return 0;
-    }
-    return memory_device_v23_->serial_number;
+    return fields_.get<MemoryDeviceLayout::SerialNumber>(0);
 }
 
 uint8_t MemoryDeviceEntry::get_asset_tag_index() const
 {
-    if (nullptr == memory_device_v23_) {
-        return 0;
-    }
-    return memory_device_v23_->asset_tag;
+    return fields_.get<MemoryDeviceLayout::AssetTag>(0);
 }
 
 uint8_t MemoryDeviceEntry::get_part_number_index() const
 {
-    if (nullptr == memory_device_v23_) {
-        return 0;
-    }
-    return memory_device_v23_->part_number;
+    return fields_.get<MemoryDeviceLayout::PartNumber>(0);
 }
 
 uint8_t MemoryDeviceEntry::get_device_rank() const
 {
-    if (nullptr == memory_device_v26_) {
-        return 0;
-    }
-    return memory_device_v26_->device_rank;
+    return fields_.get<MemoryDeviceLayout::DeviceRank>(0);
+}
 
+uint32_t MemoryDeviceEntry::get_extended_size() const
+{
+    // Bit 31 is reserved
+    return fields_.get<MemoryDeviceLayout::ExtendedSize>(0) & 0x7FFFFFFF;
 }
 
-std::string MemoryDeviceEntry::get_type() const
+uint64_t MemoryDeviceEntry::get_device_size_bytes() const
 {
-    return "Memory Device";
+    return memory_device_size_bytes(get_device_size(), get_extended_size());
 }
 
-std::string MemoryDeviceEntry::render_to_description() const
+std::string MemoryDeviceEntry::get_type() const
 {
-    std::stringstream decsription;
-    decsription << "Header type: " << get_type() << '\n';
-    decsription << "Array Handle: " << get_array_handle_string() << '\n';
-    decsription << "Error Handle: " << get_error_handle_string() << '\n';
-    decsription << "Total width: " << get_total_width_string() << '\n';
-    decsription << "Data width: " << get_data_width_string() << '\n';
-    decsription << "Device size: " << get_device_size_string() << '\n';
-    decsription << "Form factor: " << get_form_factor_string() << '\n';
-    decsription << "Device set: " << get_device_set_string() << '\n'; // dmi-string
-    decsription << "Device locator: " << get_device_locator_string() << '\n'; // dmi-string
-    decsription << "Bank locator: " << get_bank_locator_string() << '\n';
-    decsription << "Device type: " << get_device_type_string() << '\n';
-    decsription << "Device details: " << '\n' << get_device_detail_string();
-    decsription << "Device speed: " << get_device_speed_string() << '\n';
-    decsription << "Manufacturer: " << get_manufacturer_string() << '\n';
-    decsription << "Serial Number: " << get_serial_number_string() << '\n';
-    decsription << "Asset Tag: " << get_asset_tag_string() << '\n';
-    decsription << "Part Number: " << get_part_number_string() << '\n';
+    return "Memory Device";
+}
 
-    return std::move(decsription.str());
+void MemoryDeviceEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Array Handle: " << hex(get_array_handle()) << '\n';
+    out << "Error Handle: " << get_error_handle_string() << '\n';
+    out << "Total width: " << get_total_width_string() << '\n';
+    out << "Data width: " << get_data_width_string() << '\n';
+    out << "Device size: " << get_device_size_string() << '\n';
+    out << "Form factor: " << get_form_factor_string() << '\n';
+    out << "Device set: " << get_device_set_string() << '\n'; // dmi-string
+    out << "Device locator: " << dmi_string_view(get_device_locator_index()) << '\n'; // dmi-string
+    out << "Bank locator: " << dmi_string_view(get_bank_locator_index()) << '\n';
+    out << "Device type: " << get_device_type_string() << '\n';
+    out << "Device details: " << '\n';
+    append_properties(out, get_device_detail(), string_values().device_properties_map);
+    out << "Device speed: " << get_device_speed_string() << '\n';
+    out << "Manufacturer: " << dmi_string_view(get_manufacturer_index()) << '\n';
+    out << "Serial Number: " << dmi_string_view(get_serial_number_index()) << '\n';
+    out << "Asset Tag: " << dmi_string_view(get_asset_tag_index()) << '\n';
+    out << "Part Number: " << dmi_string_view(get_part_number_index()) << '\n';
 }
 
 std::string MemoryDeviceEntry::get_array_handle_string() const
@@ -336,12 +291,12 @@ std::string MemoryDeviceEntry::get_array_handle_string() const
 
 std::string MemoryDeviceEntry::get_error_handle_string() const
 {
-    assert(!error_handle_map_.empty());
+    assert(!string_values().error_handle_map.empty());
     uint16_t error_handle = get_error_handle();
 
     // special values
-    auto it = error_handle_map_.find(error_handle);
-    if (it != error_handle_map_.end()) {
+    auto it = string_values().error_handle_map.find(error_handle);
+    if (it != string_values().error_handle_map.end()) {
         return (*it).second;
     }
 
@@ -353,12 +308,12 @@ std::string MemoryDeviceEntry::get_error_handle_string() const
 
 std::string MemoryDeviceEntry::get_total_width_string() const
 {
-    assert(!data_width_map_.empty());
+    assert(!string_values().data_width_map.empty());
     uint16_t total_width = get_total_width();
 
     // special values
-    auto it = data_width_map_.find(total_width);
-    if (it != data_width_map_.end()) {
+    auto it = string_values().data_width_map.find(total_width);
+    if (it != string_values().data_width_map.end()) {
         return (*it).second;
     }
 
@@ -370,12 +325,12 @@ std::string MemoryDeviceEntry::get_total_width_string() const
 
 std::string MemoryDeviceEntry::get_data_width_string() const
 {
-    assert(!data_width_map_.empty());
+    assert(!string_values().data_width_map.empty());
     uint16_t data_width = get_data_width();
 
     // special values
-    auto it = data_width_map_.find(data_width);
-    if (it != data_width_map_.end()) {
+    auto it = string_values().data_width_map.find(data_width);
+    if (it != string_values().data_width_map.end()) {
         return (*it).second;
     }
 
@@ -387,18 +342,22 @@ std::string MemoryDeviceEntry::get_data_width_string() const
 
 std::string MemoryDeviceEntry::get_device_size_string() const
 {
-    assert(!device_size_map_.empty());
+    assert(!string_values().device_size_map.empty());
     uint16_t device_size = get_device_size();
 
     // special values
-    auto it = device_size_map_.find(device_size);
-    if (it != device_size_map_.end()) {
+    auto it = string_values().device_size_map.find(device_size);
+    if (it != string_values().device_size_map.end()) {
         return (*it).second;
     }
 
     // formatted output
     string device_size_string;
-    if (device_size & 0x8000) {
+    if (0x7FFF == device_size) {
+        device_size_string += std::to_string(get_extended_size());
+        device_size_string += " MB";
+    }
+    else if (device_size & 0x8000) {
         device_size_string += std::to_string(device_size & 0x7FFF);
         device_size_string += " kB";
     }
@@ -411,15 +370,15 @@ std::string MemoryDeviceEntry::get_device_size_string() const
 
 std::string MemoryDeviceEntry::get_form_factor_string() const
 {
-    assert(!form_factor_map_.empty());
-    return (*form_factor_map_.find(get_form_factor())).second;
+    assert(!string_values().form_factor_map.empty());
+    return (*string_values().form_factor_map.find(get_form_factor())).second;
 }
 
 std::string MemoryDeviceEntry::get_device_set_string() const
 {
-    assert(!device_set_map_.empty());
-    auto it = device_set_map_.find(get_device_set());
-    if (it != device_set_map_.end()) {
+    assert(!string_values().device_set_map.empty());
+    auto it = string_values().device_set_map.find(get_device_set());
+    if (it != string_values().device_set_map.end()) {
         return (*it).second;
     }
     return std::to_string(static_cast<unsigned>(get_device_set()));
@@ -435,24 +394,34 @@ std::string MemoryDeviceEntry::get_bank_locator_string() const
     return AbstractSMBiosEntry::dmi_string(get_bank_locator_index());
 }
 
+boost::string_view MemoryDeviceEntry::get_device_locator_view() const
+{
+    return AbstractSMBiosEntry::dmi_string_view(get_device_locator_index());
+}
+
+boost::string_view MemoryDeviceEntry::get_bank_locator_view() const
+{
+    return AbstractSMBiosEntry::dmi_string_view(get_bank_locator_index());
+}
+
 std::string MemoryDeviceEntry::get_device_type_string() const
 {
-    assert(!device_type_map_.empty());
-    return (*device_type_map_.find(get_device_type())).second;
+    assert(!string_values().device_type_map.empty());
+    return (*string_values().device_type_map.find(get_device_type())).second;
 }
 
 std::string MemoryDeviceEntry::get_device_detail_string() const
 {
-    assert(!device_properties_map_.empty());
+    assert(!string_values().device_properties_map.empty());
     const uint16_t properties = get_device_detail();
-    return AbstractSMBiosEntry::bitset_to_properties<uint16_t>(properties, device_properties_map_);
+    return AbstractSMBiosEntry::bitset_to_properties<uint16_t>(properties, string_values().device_properties_map);
 }
 
 std::string MemoryDeviceEntry::get_device_speed_string() const
 {
-    assert(!device_speed_map_.empty());
-    auto it = device_speed_map_.find(get_device_speed());
-    if (it != device_speed_map_.end()) {
+    assert(!string_values().device_speed_map.empty());
+    auto it = string_values().device_speed_map.find(get_device_speed());
+    if (it != string_values().device_speed_map.end()) {
         return (*it).second;
     }
     string speed = std::to_string(get_device_speed());
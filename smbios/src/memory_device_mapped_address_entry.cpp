@@ -0,0 +1,100 @@
+#include <smbios/memory_device_mapped_address_entry.h>
+#include <smbios/smbios.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t MemoryDeviceMappedAddressEntry::structure_type;
+
+constexpr SMBiosRevision MemoryDeviceMappedAddressLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<MemoryDeviceMappedAddressLayout::InterleavedDataDepth>(
+    MemoryDeviceMappedAddressLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<MemoryDeviceMappedAddressLayout::ExtendedEndingAddress>(
+    MemoryDeviceMappedAddressLayout::revisions), "2.7 layout");
+
+MemoryDeviceMappedAddressEntry::MemoryDeviceMappedAddressEntry(const DMIHeader& header,
+    const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::MemoryDeviceMappedAddress) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Memory Device Mapped Address, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, MemoryDeviceMappedAddressLayout::revisions);
+}
+
+std::string MemoryDeviceMappedAddressEntry::get_type() const
+{
+    return "Memory Device Mapped Address";
+}
+
+void MemoryDeviceMappedAddressEntry::render_to(RenderBuffer& out) const
+{
+    const MappedAddressRange range = get_address_range();
+
+    out << "Header type: " << get_type() << '\n';
+    out << "Starting Address: " << hex(range.begin) << '\n';
+    out << "Ending Address: " << hex(range.end) << '\n';
+    out << "Physical Device Handle: " << hex(get_device_handle()) << '\n';
+    out << "Memory Array Mapped Address Handle: " << hex(get_array_mapped_address_handle()) << '\n';
+    out << "Partition Row Position: " << static_cast<unsigned>(get_partition_row_position()) << '\n';
+    out << "Interleave Position: " << static_cast<unsigned>(get_interleave_position()) << '\n';
+    out << "Interleaved Data Depth: " << static_cast<unsigned>(get_interleaved_data_depth()) << '\n';
+}
+
+uint32_t MemoryDeviceMappedAddressEntry::get_starting_address_kb() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::StartingAddress>(0);
+}
+
+uint32_t MemoryDeviceMappedAddressEntry::get_ending_address_kb() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::EndingAddress>(0);
+}
+
+uint16_t MemoryDeviceMappedAddressEntry::get_device_handle() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::DeviceHandle>(0xFFFF);
+}
+
+uint16_t MemoryDeviceMappedAddressEntry::get_array_mapped_address_handle() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::ArrayMappedAddressHandle>(0xFFFF);
+}
+
+uint8_t MemoryDeviceMappedAddressEntry::get_partition_row_position() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::PartitionRowPosition>(PositionValue::PositionUnknown);
+}
+
+uint8_t MemoryDeviceMappedAddressEntry::get_interleave_position() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::InterleavePosition>(PositionValue::PositionUnknown);
+}
+
+uint8_t MemoryDeviceMappedAddressEntry::get_interleaved_data_depth() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::InterleavedDataDepth>(PositionValue::PositionUnknown);
+}
+
+uint64_t MemoryDeviceMappedAddressEntry::get_extended_starting_address() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::ExtendedStartingAddress>(0);
+}
+
+uint64_t MemoryDeviceMappedAddressEntry::get_extended_ending_address() const
+{
+    return fields_.get<MemoryDeviceMappedAddressLayout::ExtendedEndingAddress>(0);
+}
+
+MappedAddressRange MemoryDeviceMappedAddressEntry::get_address_range() const
+{
+    return resolve_mapped_range(get_starting_address_kb(), get_ending_address_kb(),
+        fields_.has<MemoryDeviceMappedAddressLayout::ExtendedEndingAddress>(),
+        get_extended_starting_address(), get_extended_ending_address());
+}
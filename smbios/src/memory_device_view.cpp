@@ -0,0 +1,165 @@
+#include <smbios/memory_device_view.h>
+
+using namespace smbios;
+
+static_assert(sizeof(MemoryDeviceView) <= 16, "View should be small enough to be passed in registers");
+static_assert(std::is_trivially_copyable<MemoryDeviceView>::value, "View should be trivially copyable");
+
+constexpr uint8_t MemoryDeviceView::structure_type;
+
+MemoryDeviceView::MemoryDeviceView(const DMIHeader& header, const SMBiosVersion& version)
+    : SMBiosStructureView(header, version, MemoryDeviceLayout::revisions)
+{
+}
+
+std::string MemoryDeviceView::get_type() const
+{
+    return "Memory Device";
+}
+
+uint16_t MemoryDeviceView::get_array_handle() const
+{
+    return get<MemoryDeviceLayout::ArrayHandle>(0);
+}
+
+uint16_t MemoryDeviceView::get_error_handle() const
+{
+    return get<MemoryDeviceLayout::ErrorHandle>(MemoryDeviceEntry::ErrorHandleNotProvided);
+}
+
+uint16_t MemoryDeviceView::get_total_width() const
+{
+    return get<MemoryDeviceLayout::TotalWidth>(MemoryDeviceEntry::DataWidthUnknown1);
+}
+
+uint16_t MemoryDeviceView::get_data_width() const
+{
+    return get<MemoryDeviceLayout::DataWidth>(MemoryDeviceEntry::DataWidthUnknown1);
+}
+
+uint16_t MemoryDeviceView::get_device_size() const
+{
+    return get<MemoryDeviceLayout::DeviceSize>(MemoryDeviceEntry::DeviceSizeUnknown);
+}
+
+uint8_t MemoryDeviceView::get_form_factor() const
+{
+    return get<MemoryDeviceLayout::FormFactor>(MemoryDeviceEntry::FormFactorOutOfSpec);
+}
+
+uint8_t MemoryDeviceView::get_device_set() const
+{
+    return get<MemoryDeviceLayout::DeviceSet>(MemoryDeviceEntry::DeviceSetUnknown);
+}
+
+uint8_t MemoryDeviceView::get_device_locator_index() const
+{
+    return get<MemoryDeviceLayout::DeviceLocator>(0);
+}
+
+uint8_t MemoryDeviceView::get_bank_locator_index() const
+{
+    return get<MemoryDeviceLayout::BankLocator>(0);
+}
+
+uint8_t MemoryDeviceView::get_device_type() const
+{
+    return get<MemoryDeviceLayout::DeviceType>(MemoryDeviceEntry::DeviceTypeOutOfSpec);
+}
+
+uint16_t MemoryDeviceView::get_device_detail() const
+{
+    return get<MemoryDeviceLayout::TypeDetail>(MemoryDeviceEntry::DevicePropertiesOutOfSpec);
+}
+
+uint16_t MemoryDeviceView::get_device_speed() const
+{
+    return get<MemoryDeviceLayout::DeviceSpeed>(MemoryDeviceEntry::DeviceSpeedUnknown);
+}
+
+uint8_t MemoryDeviceView::get_manufacturer_index() const
+{
+    return get<MemoryDeviceLayout::Manufacturer>(0);
+}
+
+uint8_t MemoryDeviceView::get_serial_number_index() const
+{
+    return get<MemoryDeviceLayout::SerialNumber>(0);
+}
+
+uint8_t MemoryDeviceView::get_asset_tag_index() const
+{
+    return get<MemoryDeviceLayout::AssetTag>(0);
+}
+
+uint8_t MemoryDeviceView::get_part_number_index() const
+{
+    return get<MemoryDeviceLayout::PartNumber>(0);
+}
+
+uint8_t MemoryDeviceView::get_device_rank() const
+{
+    // Bits 7-4: reserved
+    return get<MemoryDeviceLayout::DeviceRank>(0) & 0x0F;
+}
+
+uint32_t MemoryDeviceView::get_extended_size() const
+{
+    // Bit 31 is reserved
+    return get<MemoryDeviceLayout::ExtendedSize>(0) & 0x7FFFFFFF;
+}
+
+uint64_t MemoryDeviceView::get_device_size_bytes() const
+{
+    return memory_device_size_bytes(get_device_size(), get_extended_size());
+}
+
+uint16_t MemoryDeviceView::get_memory_clock_speed() const
+{
+    return get<MemoryDeviceLayout::MemoryClockSpeed>(0);
+}
+
+uint16_t MemoryDeviceView::get_minimum_voltage() const
+{
+    return get<MemoryDeviceLayout::MinimumVoltage>(0);
+}
+
+uint16_t MemoryDeviceView::get_maximum_voltage() const
+{
+    return get<MemoryDeviceLayout::MaximumVoltage>(0);
+}
+
+uint16_t MemoryDeviceView::get_configured_voltage() const
+{
+    return get<MemoryDeviceLayout::ConfiguredVoltage>(0);
+}
+
+boost::string_view MemoryDeviceView::get_device_locator_string() const
+{
+    return dmi_string(get_device_locator_index());
+}
+
+boost::string_view MemoryDeviceView::get_bank_locator_string() const
+{
+    return dmi_string(get_bank_locator_index());
+}
+
+boost::string_view MemoryDeviceView::get_manufacturer_string() const
+{
+    return dmi_string(get_manufacturer_index());
+}
+
+boost::string_view MemoryDeviceView::get_serial_number_string() const
+{
+    return dmi_string(get_serial_number_index());
+}
+
+boost::string_view MemoryDeviceView::get_asset_tag_string() const
+{
+    return dmi_string(get_asset_tag_index());
+}
+
+boost::string_view MemoryDeviceView::get_part_number_string() const
+{
+    return dmi_string(get_part_number_index());
+}
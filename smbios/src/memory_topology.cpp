@@ -0,0 +1,113 @@
+#include <smbios/memory_topology.h>
+#include <smbios/smbios.h>
+#include <smbios/memory_device_view.h>
+#include <smbios/physical_memory_array_view.h>
+
+#include <algorithm>
+
+using namespace smbios;
+
+namespace {
+
+/// Mixes are tiny (a few distinct values), linear search is the fastest
+void add_to_mix(std::vector<MemoryMixItem>& mix, uint16_t value)
+{
+    for (MemoryMixItem& item : mix) {
+        if (item.value == value) {
+            ++item.count;
+            return;
+        }
+    }
+    mix.push_back(MemoryMixItem{ value, 1 });
+}
+
+void sort_mix(std::vector<MemoryMixItem>& mix)
+{
+    std::sort(mix.begin(), mix.end(),
+        [](const MemoryMixItem& lhs, const MemoryMixItem& rhs) { return lhs.value < rhs.value; });
+}
+
+} // namespace
+
+MemoryTopology smbios::summarize_memory_topology(const SMBios& smbios)
+{
+    MemoryTopology topology;
+    summarize_memory_topology(smbios, topology);
+    return topology;
+}
+
+void smbios::summarize_memory_topology(const SMBios& smbios, MemoryTopology& topology)
+{
+    topology.installed_size = 0;
+    topology.populated_slots = 0;
+    topology.empty_slots = 0;
+    topology.unknown_size_devices = 0;
+    topology.arrays.clear();
+    topology.speed_mix.clear();
+    topology.type_mix.clear();
+    topology.rank_mix.clear();
+
+    const SMBiosVersion version = smbios.get_smbios_version();
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+
+    // the table does not have to list arrays before their devices, so all arrays are collected first
+    for (const DMIHeader& header : headers) {
+        if (header.type == SMBios::PhysicalMemoryArray) {
+            const PhysicalMemoryArrayView array(header, version);
+            topology.arrays.push_back(MemoryArraySummary{ header.handle, array.get_use(),
+                array.get_error_correction(), array.get_number_of_devices(), 0, 0,
+                array.get_maximum_capacity_bytes(), 0 });
+        }
+    }
+
+    for (const DMIHeader& header : headers) {
+        if (header.type != SMBios::MemoryDevice) {
+            continue;
+        }
+
+        const MemoryDeviceView device(header, version);
+
+        // arrays are few, linear search
+        MemoryArraySummary* array = nullptr;
+        const uint16_t array_handle = device.get_array_handle();
+        for (MemoryArraySummary& candidate : topology.arrays) {
+            if (candidate.handle == array_handle) {
+                array = &candidate;
+                break;
+            }
+        }
+
+        const uint16_t device_size = device.get_device_size();
+        const bool populated = device_size != MemoryDeviceEntry::DeviceSizeNoModuleInstalled;
+        const uint64_t size = device.get_device_size_bytes();
+        if (array && populated) {
+            ++array->populated_slots;
+            array->installed_size += size;
+        }
+        else if (array) {
+            ++array->empty_slots;
+        }
+
+        // device without known array is counted as system memory
+        if (array && array->use != PhysicalMemoryArrayView::SystemMemory) {
+            continue;
+        }
+        if (!populated) {
+            ++topology.empty_slots;
+            continue;
+        }
+
+        ++topology.populated_slots;
+        topology.installed_size += size;
+        if (device_size == MemoryDeviceEntry::DeviceSizeUnknown) {
+            ++topology.unknown_size_devices;
+        }
+        add_to_mix(topology.speed_mix, device.get_device_speed());
+        add_to_mix(topology.type_mix, device.get_device_type());
+        add_to_mix(topology.rank_mix, device.get_device_rank());
+    }
+
+    sort_mix(topology.speed_mix);
+    sort_mix(topology.type_mix);
+    sort_mix(topology.rank_mix);
+}
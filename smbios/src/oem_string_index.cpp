@@ -0,0 +1,37 @@
+#include <smbios/oem_string_index.h>
+#include <smbios/smbios_schema.h>
+
+using namespace smbios;
+
+OemStringIndex::OemStringIndex(const std::vector<DMIHeader>& headers)
+{
+    for (const DMIHeader& header : headers) {
+        if (header.type != SMBios::OemStrings && header.type != SMBios::SystemConfigurationOptions) {
+            continue;
+        }
+
+        for (const boost::string_view text : DmiStrings(header)) {
+            const size_t separator = text.find('=');
+            if (separator == boost::string_view::npos) {
+                values_.emplace(text, boost::string_view());
+            }
+            else {
+                values_.emplace(text.substr(0, separator), text.substr(separator + 1));
+            }
+        }
+    }
+}
+
+boost::optional<boost::string_view> OemStringIndex::find(boost::string_view key) const
+{
+    const auto it = values_.find(key);
+    if (it == values_.end()) {
+        return boost::none;
+    }
+    return it->second;
+}
+
+size_t OemStringIndex::size() const
+{
+    return values_.size();
+}
@@ -0,0 +1,10 @@
+#include <smbios/oem_strings_entry.h>
+
+using namespace smbios;
+
+constexpr uint8_t OemStringsEntry::structure_type;
+
+OemStringsEntry::OemStringsEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : StringListEntry(header, version, structure_type, "OEM Strings")
+{
+}
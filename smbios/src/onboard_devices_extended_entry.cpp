@@ -0,0 +1,73 @@
+#include <smbios/onboard_devices_extended_entry.h>
+#include <smbios/smbios.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t OnboardDevicesExtendedEntry::structure_type;
+
+constexpr SMBiosRevision OnboardDevicesExtendedLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<OnboardDevicesExtendedLayout::DeviceFunctionNumber>(
+    OnboardDevicesExtendedLayout::revisions), "2.6 layout");
+
+OnboardDevicesExtendedEntry::OnboardDevicesExtendedEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::OnboardDevicesExtended) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Onboard Devices Extended Information, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, OnboardDevicesExtendedLayout::revisions);
+}
+
+std::string OnboardDevicesExtendedEntry::get_type() const
+{
+    return "Onboard Devices Extended Information";
+}
+
+void OnboardDevicesExtendedEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Reference Designation: " << dmi_string_view(fields_.get<OnboardDevicesExtendedLayout::ReferenceDesignation>(0)) << '\n';
+    out << "Type: " << static_cast<unsigned>(get_device_type()) << '\n';
+    out << "Status: " << (is_enabled() ? "Enabled" : "Disabled") << '\n';
+    out << "Type Instance: " << static_cast<unsigned>(get_device_type_instance()) << '\n';
+    const PciAddress address = get_pci_address();
+    if (address.is_valid()) {
+        out << "Bus Address: " << format_pci_address(address) << '\n';
+    }
+}
+
+uint8_t OnboardDevicesExtendedEntry::get_device_type() const
+{
+    return fields_.get<OnboardDevicesExtendedLayout::DeviceType>(0x02) & DeviceTypeMask;
+}
+
+bool OnboardDevicesExtendedEntry::is_enabled() const
+{
+    return 0 != (fields_.get<OnboardDevicesExtendedLayout::DeviceType>(0) & DeviceEnabled);
+}
+
+uint8_t OnboardDevicesExtendedEntry::get_device_type_instance() const
+{
+    return fields_.get<OnboardDevicesExtendedLayout::DeviceTypeInstance>(0);
+}
+
+PciAddress OnboardDevicesExtendedEntry::get_pci_address() const
+{
+    PciAddress address;
+    address.segment = fields_.get<OnboardDevicesExtendedLayout::SegmentGroupNumber>(0xFFFF);
+    address.bus = fields_.get<OnboardDevicesExtendedLayout::BusNumber>(0xFF);
+    address.device_function = fields_.get<OnboardDevicesExtendedLayout::DeviceFunctionNumber>(0xFF);
+    return address;
+}
+
+std::string OnboardDevicesExtendedEntry::get_reference_designation_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<OnboardDevicesExtendedLayout::ReferenceDesignation>(0));
+}
@@ -0,0 +1,127 @@
+#include <smbios/parallel_render.h>
+#include <smbios/abstract_smbios_entry.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace smbios;
+
+namespace {
+
+/// Where the chunk has been rendered: worker buffer and the range in it
+struct ChunkLocation {
+    size_t worker;
+    size_t begin;
+    size_t end;
+};
+
+void render_serially(size_t count, RenderBuffer& out, const StructureRenderer& render)
+{
+    // structures rendered before the failure are dropped as in the parallel case
+    const size_t rendered_before = out.size();
+    try {
+        for (size_t header_index = 0; header_index < count; ++header_index) {
+            render(header_index, out);
+        }
+    }
+    catch (...) {
+        out.truncate(rendered_before);
+        throw;
+    }
+}
+
+} // namespace
+
+void smbios::render_ordered(size_t count, size_t threads, RenderBuffer& out, const StructureRenderer& render,
+    size_t chunk_size)
+{
+    if (0 == threads) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    chunk_size = std::max<size_t>(chunk_size, 1);
+    const size_t chunks = (count + chunk_size - 1) / chunk_size;
+    threads = std::min(threads, chunks);
+    if (threads <= 1) {
+        render_serially(count, out, render);
+        return;
+    }
+
+    std::vector<RenderBuffer> buffers(threads);
+    std::vector<ChunkLocation> locations(chunks);
+    std::atomic<size_t> next_chunk(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto work = [&](size_t worker) {
+        RenderBuffer& buffer = buffers[worker];
+        try {
+            for (size_t chunk = next_chunk++; chunk < chunks && !failed; chunk = next_chunk++) {
+                const size_t begin = buffer.size();
+                const size_t last = std::min(count, (chunk + 1) * chunk_size);
+                for (size_t header_index = chunk * chunk_size; header_index < last; ++header_index) {
+                    render(header_index, buffer);
+                }
+                locations[chunk] = ChunkLocation{ worker, begin, buffer.size() };
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    // the calling thread is one of the workers
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    auto join_workers = [&workers]() {
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    };
+    try {
+        for (size_t worker = 1; worker < threads; ++worker) {
+            workers.emplace_back(work, worker);
+        }
+    }
+    catch (...) {
+        // started workers should be joined before their state goes out of scope
+        failed = true;
+        join_workers();
+        throw;
+    }
+    work(0);
+    join_workers();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    size_t total = 0;
+    for (const RenderBuffer& buffer : buffers) {
+        total += buffer.size();
+    }
+    out.reserve(total);
+    for (const ChunkLocation& location : locations) {
+        out.append(buffers[location.worker].data() + location.begin, location.end - location.begin);
+    }
+}
+
+void smbios::render_structures(const SMBios& smbios, RenderBuffer& out, size_t threads)
+{
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    render_ordered(headers.size(), threads, out, [&smbios, &headers](size_t header_index, RenderBuffer& buffer) {
+        buffer << "Header ID = " << headers[header_index].get_type() << '\n';
+        const AbstractSMBiosEntry* entry = smbios.entry(header_index);
+        if (entry) {
+            entry->render_to(buffer);
+            buffer << '\n';
+        }
+    });
+}
@@ -0,0 +1,87 @@
+#include <smbios/pci_address.h>
+
+using namespace smbios;
+
+namespace {
+
+/// Read exactly 'digits' hex digits from the beginning of the text
+bool read_hex(boost::string_view& text, size_t digits, uint32_t& value)
+{
+    if (text.size() < digits) {
+        return false;
+    }
+
+    value = 0;
+    for (size_t i = 0; i < digits; ++i) {
+        const char c = text[i];
+        uint32_t digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        }
+        else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        }
+        else {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+    text.remove_prefix(digits);
+    return true;
+}
+
+bool skip_separator(boost::string_view& text, char separator)
+{
+    if (text.empty() || text.front() != separator) {
+        return false;
+    }
+    text.remove_prefix(1);
+    return true;
+}
+
+} // namespace
+
+bool smbios::parse_pci_address(boost::string_view text, PciAddress& address)
+{
+    uint32_t segment = 0;
+    uint32_t bus = 0;
+    uint32_t device = 0;
+    uint32_t function = 0;
+
+    // segment is optional
+    if (text.size() > 7 && !(read_hex(text, 4, segment) && skip_separator(text, ':'))) {
+        return false;
+    }
+    if (!(read_hex(text, 2, bus) && skip_separator(text, ':') &&
+          read_hex(text, 2, device) && skip_separator(text, '.') &&
+          read_hex(text, 1, function) && text.empty())) {
+        return false;
+    }
+    if (device > 0x1F || function > 0x07) {
+        return false;
+    }
+
+    address.segment = static_cast<uint16_t>(segment);
+    address.bus = static_cast<uint8_t>(bus);
+    address.device_function = static_cast<uint8_t>((device << 3) | function);
+    return true;
+}
+
+std::string smbios::format_pci_address(const PciAddress& address)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    std::string text = "0000:00:00.0";
+    for (size_t i = 0; i < 4; ++i) {
+        text[i] = hex_digits[(address.segment >> (12 - 4 * i)) & 0x0F];
+    }
+    text[5] = hex_digits[address.bus >> 4];
+    text[6] = hex_digits[address.bus & 0x0F];
+    text[8] = hex_digits[address.get_device() >> 4];
+    text[9] = hex_digits[address.get_device() & 0x0F];
+    text[11] = hex_digits[address.get_function()];
+    return text;
+}
@@ -0,0 +1,79 @@
+#include <smbios/pci_device_map.h>
+#include <smbios/smbios_field.h>
+#include <smbios/smbios_schema.h>
+#include <smbios/system_slots_entry.h>
+#include <smbios/onboard_devices_extended_entry.h>
+
+#include <algorithm>
+
+using namespace smbios;
+
+namespace {
+
+/// Read address and label fields of types 9 and 41 without entry construction
+template <typename Layout, typename LabelField>
+void add_record(const DMIHeader& header, const SMBiosVersion& version, std::vector<PciDeviceRecord>& records)
+{
+    const SMBiosFieldReader fields(header, version, Layout::revisions);
+    if (!fields.template has<typename Layout::DeviceFunctionNumber>()) {
+        return;
+    }
+
+    PciDeviceRecord record;
+    record.address.segment = fields.template get<typename Layout::SegmentGroupNumber>(0xFFFF);
+    record.address.bus = fields.template get<typename Layout::BusNumber>(0xFF);
+    record.address.device_function = fields.template get<typename Layout::DeviceFunctionNumber>(0xFF);
+    if (!record.address.is_valid()) {
+        return;
+    }
+
+    record.structure_type = header.type;
+    record.handle = header.handle;
+    const uint8_t label_index = fields.template get<LabelField>(0);
+    record.label = label_index ? find_dmi_string(header.data, header.length, label_index) : boost::string_view();
+    records.push_back(record);
+}
+
+} // namespace
+
+PciDeviceMap::PciDeviceMap(const std::vector<DMIHeader>& headers, const SMBiosVersion& version)
+{
+    for (const DMIHeader& header : headers) {
+        if (header.type == SMBios::SystemSlots) {
+            add_record<SystemSlotsLayout, SystemSlotsLayout::SlotDesignation>(header, version, records_);
+        }
+        else if (header.type == SMBios::OnboardDevicesExtended) {
+            add_record<OnboardDevicesExtendedLayout, OnboardDevicesExtendedLayout::ReferenceDesignation>(
+                header, version, records_);
+        }
+    }
+
+    std::stable_sort(records_.begin(), records_.end(),
+        [](const PciDeviceRecord& lhs, const PciDeviceRecord& rhs) { return lhs.address < rhs.address; });
+}
+
+const PciDeviceRecord* PciDeviceMap::find(const PciAddress& address) const
+{
+    if (const PciDeviceRecord* record = find_exact(address.key())) {
+        return record;
+    }
+    if (address.get_function() != 0) {
+        return find_exact(address.key() & ~uint32_t(0x07));
+    }
+    return nullptr;
+}
+
+const std::vector<PciDeviceRecord>& PciDeviceMap::get_records() const
+{
+    return records_;
+}
+
+const PciDeviceRecord* PciDeviceMap::find_exact(uint32_t key) const
+{
+    const auto it = std::lower_bound(records_.begin(), records_.end(), key,
+        [](const PciDeviceRecord& record, uint32_t value) { return record.address.key() < value; });
+    if (it == records_.end() || it->address.key() != key) {
+        return nullptr;
+    }
+    return &*it;
+}
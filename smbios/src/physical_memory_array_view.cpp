@@ -0,0 +1,70 @@
+#include <smbios/physical_memory_array_view.h>
+
+using namespace smbios;
+
+static_assert(sizeof(PhysicalMemoryArrayView) <= 16, "View should be small enough to be passed in registers");
+static_assert(std::is_trivially_copyable<PhysicalMemoryArrayView>::value, "View should be trivially copyable");
+
+constexpr uint8_t PhysicalMemoryArrayView::structure_type;
+
+constexpr SMBiosRevision PhysicalMemoryArrayLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<PhysicalMemoryArrayLayout::NumberOfDevices>(
+    PhysicalMemoryArrayLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<PhysicalMemoryArrayLayout::ExtendedMaximumCapacity>(
+    PhysicalMemoryArrayLayout::revisions), "2.7 layout");
+
+PhysicalMemoryArrayView::PhysicalMemoryArrayView(const DMIHeader& header, const SMBiosVersion& version)
+    : SMBiosStructureView(header, version, PhysicalMemoryArrayLayout::revisions)
+{
+}
+
+std::string PhysicalMemoryArrayView::get_type() const
+{
+    return "Physical Memory Array";
+}
+
+uint8_t PhysicalMemoryArrayView::get_location() const
+{
+    return get<PhysicalMemoryArrayLayout::Location>(0x02);
+}
+
+uint8_t PhysicalMemoryArrayView::get_use() const
+{
+    return get<PhysicalMemoryArrayLayout::Use>(UseUnknown);
+}
+
+uint8_t PhysicalMemoryArrayView::get_error_correction() const
+{
+    return get<PhysicalMemoryArrayLayout::ErrorCorrection>(0x02);
+}
+
+uint32_t PhysicalMemoryArrayView::get_maximum_capacity() const
+{
+    return get<PhysicalMemoryArrayLayout::MaximumCapacity>(0x80000000);
+}
+
+uint16_t PhysicalMemoryArrayView::get_error_handle() const
+{
+    return get<PhysicalMemoryArrayLayout::ErrorHandle>(0xFFFE);
+}
+
+uint16_t PhysicalMemoryArrayView::get_number_of_devices() const
+{
+    return get<PhysicalMemoryArrayLayout::NumberOfDevices>(0);
+}
+
+uint64_t PhysicalMemoryArrayView::get_extended_maximum_capacity() const
+{
+    return get<PhysicalMemoryArrayLayout::ExtendedMaximumCapacity>(0);
+}
+
+uint64_t PhysicalMemoryArrayView::get_maximum_capacity_bytes() const
+{
+    const uint32_t capacity = get_maximum_capacity();
+    if (capacity == 0x80000000) {
+        return get_extended_maximum_capacity();
+    }
+    return uint64_t(capacity) << 10;
+}
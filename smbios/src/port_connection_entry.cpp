@@ -7,6 +7,8 @@
 using std::string;
 using namespace smbios;
 
+constexpr uint8_t PortConnectionEntry::structure_type;
+
 PortConnectionEntry::PortConnectionEntry(const DMIHeader& header, const SMBiosVersion& version) 
     : AbstractSMBiosEntry(header) {
 
@@ -16,8 +18,6 @@ PortConnectionEntry::PortConnectionEntry(const DMIHeader& header, const SMBiosVe
         throw std::runtime_error(err.str().c_str());
     }
 
-    init_string_values();
-
     // check empty entry
     if (header.length < 0x09)
         return;
@@ -25,88 +25,98 @@ PortConnectionEntry::PortConnectionEntry(const DMIHeader& header, const SMBiosVe
     port_connection_ = reinterpret_cast<const PortConnection*>(header.data);
 }
 
-void PortConnectionEntry::init_string_values()
+const PortConnectionEntry::StringValues& PortConnectionEntry::string_values()
+{
+    static const StringValues values = []() {
+        StringValues filled;
+        init_string_values(filled);
+        return filled;
+    }();
+    return values;
+}
+
+void PortConnectionEntry::init_string_values(StringValues& values)
 {
-    connection_type_map_[NoneConnector] = "None";
-    connection_type_map_[Centronics] = "Centronics";
-    connection_type_map_[MiniCentronics] = "Mini Centronics";
-    connection_type_map_[Proprietary] = "Proprietary";
-    connection_type_map_[DB25PinMale] = "DB-25 Pin Male";
-    connection_type_map_[DB25PinFemale] = "DB-25 Pin Female";
-    connection_type_map_[DB15PinMale] = "DB-15 Pin Male";
-    connection_type_map_[DB15PinFemale] = "DB-15 Pin Female";
-    connection_type_map_[DB9PinMale] = "DB-9 Pin Male";
-    connection_type_map_[DB9PinFemale] = "DB-9 Pin Female";
-    connection_type_map_[RJ11] = "RJ-11";
-    connection_type_map_[RJ45] = "RJ-45";
-    connection_type_map_[MiniSCSI50pin] = "50-pin MiniSCSI";
-    connection_type_map_[MiniDIN] = "Mini-DIN";
-    connection_type_map_[MicroDIN] = "Micro-DIN";
-    connection_type_map_[PS2] = "PS/2";
-    connection_type_map_[Infrared] = "Infrared";
-    connection_type_map_[HPHIL] = "HP-HIL";
-    connection_type_map_[AccessBusUSB] = "Access Bus (USB)";
-    connection_type_map_[SSA_SCSIConnector] = "SSA SCSI";
-    connection_type_map_[CircularDIN8Male] = "Circular DIN-8 Male";
-    connection_type_map_[CircularDIN8Female] = "Circular DIN-8 Female";
-    connection_type_map_[OnBoardIDE] = "On Board IDE";
-    connection_type_map_[OnBoardFloppy] = "On Board Floppy";
-    connection_type_map_[DualInline9pin] = "9-pin Dual Inline(pin 10 cut)";
-    connection_type_map_[DualInline25pin] = "25-pin Dual Inline(pin 26 cut)";
-    connection_type_map_[DualInline50pin] = "50-pin Dual Inline";
-    connection_type_map_[DualInline68pin] = "68-pin Dual Inline";
-    connection_type_map_[OnBoardSound] = "On Board Sound Input from CD-ROM";
-    connection_type_map_[MiniCentronicsType14] = "Mini-Centronics Type-14";
-    connection_type_map_[MiniCentronicsType26] = "Mini-Centronics Type-26";
-    connection_type_map_[MiniJack] = "Mini-jack(headphones)";
-    connection_type_map_[BNC] = "BNC";
-    connection_type_map_[IEEE1394] = "1394";
-    connection_type_map_[SAS_SATA] = "SAS/SATA Plug Receptacle";
-    connection_type_map_[PC98Connector] = "PC-98";
-    connection_type_map_[PC98HiresoConnector] = "PC-98Hireso";
-    connection_type_map_[PCH98Connector] = "PC-H98";
-    connection_type_map_[PC98Note] = "PC-98Note";
-    connection_type_map_[PC98Full] = "PC-98Full";
-    connection_type_map_[OtherConnector] = "Other - See Reference Designator Strings";
-
-    port_type_map_[NonePort] = "None";
-    port_type_map_[ParallelXT_AT] = "Parallel Port XT/AT Compatible";
-    port_type_map_[ParallelPS_2] = "Parallel Port PS/2";
-    port_type_map_[ParallelECP] = "Parallel Port ECP";
-    port_type_map_[ParallelEPP] = "Parallel Port EPP";
-    port_type_map_[ParallelECP_EPP] = "Parallel Port ECP/EPP";
-    port_type_map_[SerialXT_AT] = "Serial Port XT/AT Compatible";
-    port_type_map_[Serial16450] = "Serial Port 16450 Compatible";
-    port_type_map_[Serial16550] = "Serial Port 16550 Compatible";
-    port_type_map_[Serial16550A] = "Serial Port 16550A Compatible";
-    port_type_map_[SCSI] = "SCSI Port";
-    port_type_map_[MIDI] = "MIDI Port";
-    port_type_map_[JoyStick] = "Joy Stick Port";
-    port_type_map_[Keyboard] = "Keyboard Port";
-    port_type_map_[Mouse] = "Mouse Port";
-
-    port_type_map_[SSA_SCSIPort] = "SSA SCSI";
-    port_type_map_[USB] = "USB";
-    port_type_map_[FireWire] = "FireWire(IEEE P1394)";
-    port_type_map_[PCMCIA] = "PCMCIA Type I";
-    port_type_map_[PCMCIAType2] = "PCMCIA Type II";
-    port_type_map_[PCMCIAType3] = "PCMCIA Type III";
-    port_type_map_[Cardbus] = "Cardbus";
-    port_type_map_[AccessBusPort] = "Access Bus Port";
-    port_type_map_[SCSI2] = "SCSI II";
-    port_type_map_[SCSIWide] = "SCSI Wide";
-    port_type_map_[PC98Port] = "PC-98";
-    port_type_map_[PC98HiresoPort] = "PC-98-Hireso";
-    port_type_map_[PCH98Port] = "PC-H98";
-    port_type_map_[Video] = "Video Port";
-    port_type_map_[Audio] = "Audio Port";
-    port_type_map_[Modem] = "Modem Port";
-    port_type_map_[Network] = "Network Port";
-    port_type_map_[SATA] = "SATA";
-    port_type_map_[SAS] = "SAS";
-    port_type_map_[Compatible8251] = "8251 Compatible";
-    port_type_map_[CompatibleFIFO8251] = "8251 FIFO Compatible";
-    port_type_map_[OtherPort] = "Other";
+    values.connection_type_map[NoneConnector] = "None";
+    values.connection_type_map[Centronics] = "Centronics";
+    values.connection_type_map[MiniCentronics] = "Mini Centronics";
+    values.connection_type_map[Proprietary] = "Proprietary";
+    values.connection_type_map[DB25PinMale] = "DB-25 Pin Male";
+    values.connection_type_map[DB25PinFemale] = "DB-25 Pin Female";
+    values.connection_type_map[DB15PinMale] = "DB-15 Pin Male";
+    values.connection_type_map[DB15PinFemale] = "DB-15 Pin Female";
+    values.connection_type_map[DB9PinMale] = "DB-9 Pin Male";
+    values.connection_type_map[DB9PinFemale] = "DB-9 Pin Female";
+    values.connection_type_map[RJ11] = "RJ-11";
+    values.connection_type_map[RJ45] = "RJ-45";
+    values.connection_type_map[MiniSCSI50pin] = "50-pin MiniSCSI";
+    values.connection_type_map[MiniDIN] = "Mini-DIN";
+    values.connection_type_map[MicroDIN] = "Micro-DIN";
+    values.connection_type_map[PS2] = "PS/2";
+    values.connection_type_map[Infrared] = "Infrared";
+    values.connection_type_map[HPHIL] = "HP-HIL";
+    values.connection_type_map[AccessBusUSB] = "Access Bus (USB)";
+    values.connection_type_map[SSA_SCSIConnector] = "SSA SCSI";
+    values.connection_type_map[CircularDIN8Male] = "Circular DIN-8 Male";
+    values.connection_type_map[CircularDIN8Female] = "Circular DIN-8 Female";
+    values.connection_type_map[OnBoardIDE] = "On Board IDE";
+    values.connection_type_map[OnBoardFloppy] = "On Board Floppy";
+    values.connection_type_map[DualInline9pin] = "9-pin Dual Inline(pin 10 cut)";
+    values.connection_type_map[DualInline25pin] = "25-pin Dual Inline(pin 26 cut)";
+    values.connection_type_map[DualInline50pin] = "50-pin Dual Inline";
+    values.connection_type_map[DualInline68pin] = "68-pin Dual Inline";
+    values.connection_type_map[OnBoardSound] = "On Board Sound Input from CD-ROM";
+    values.connection_type_map[MiniCentronicsType14] = "Mini-Centronics Type-14";
+    values.connection_type_map[MiniCentronicsType26] = "Mini-Centronics Type-26";
+    values.connection_type_map[MiniJack] = "Mini-jack(headphones)";
+    values.connection_type_map[BNC] = "BNC";
+    values.connection_type_map[IEEE1394] = "1394";
+    values.connection_type_map[SAS_SATA] = "SAS/SATA Plug Receptacle";
+    values.connection_type_map[PC98Connector] = "PC-98";
+    values.connection_type_map[PC98HiresoConnector] = "PC-98Hireso";
+    values.connection_type_map[PCH98Connector] = "PC-H98";
+    values.connection_type_map[PC98Note] = "PC-98Note";
+    values.connection_type_map[PC98Full] = "PC-98Full";
+    values.connection_type_map[OtherConnector] = "Other - See Reference Designator Strings";
+
+    values.port_type_map[NonePort] = "None";
+    values.port_type_map[ParallelXT_AT] = "Parallel Port XT/AT Compatible";
+    values.port_type_map[ParallelPS_2] = "Parallel Port PS/2";
+    values.port_type_map[ParallelECP] = "Parallel Port ECP";
+    values.port_type_map[ParallelEPP] = "Parallel Port EPP";
+    values.port_type_map[ParallelECP_EPP] = "Parallel Port ECP/EPP";
+    values.port_type_map[SerialXT_AT] = "Serial Port XT/AT Compatible";
+    values.port_type_map[Serial16450] = "Serial Port 16450 Compatible";
+    values.port_type_map[Serial16550] = "Serial Port 16550 Compatible";
+    values.port_type_map[Serial16550A] = "Serial Port 16550A Compatible";
+    values.port_type_map[SCSI] = "SCSI Port";
+    values.port_type_map[MIDI] = "MIDI Port";
+    values.port_type_map[JoyStick] = "Joy Stick Port";
+    values.port_type_map[Keyboard] = "Keyboard Port";
+    values.port_type_map[Mouse] = "Mouse Port";
+
+    values.port_type_map[SSA_SCSIPort] = "SSA SCSI";
+    values.port_type_map[USB] = "USB";
+    values.port_type_map[FireWire] = "FireWire(IEEE P1394)";
+    values.port_type_map[PCMCIA] = "PCMCIA Type I";
+    values.port_type_map[PCMCIAType2] = "PCMCIA Type II";
+    values.port_type_map[PCMCIAType3] = "PCMCIA Type III";
+    values.port_type_map[Cardbus] = "Cardbus";
+    values.port_type_map[AccessBusPort] = "Access Bus Port";
+    values.port_type_map[SCSI2] = "SCSI II";
+    values.port_type_map[SCSIWide] = "SCSI Wide";
+    values.port_type_map[PC98Port] = "PC-98";
+    values.port_type_map[PC98HiresoPort] = "PC-98-Hireso";
+    values.port_type_map[PCH98Port] = "PC-H98";
+    values.port_type_map[Video] = "Video Port";
+    values.port_type_map[Audio] = "Audio Port";
+    values.port_type_map[Modem] = "Modem Port";
+    values.port_type_map[Network] = "Network Port";
+    values.port_type_map[SATA] = "SATA";
+    values.port_type_map[SAS] = "SAS";
+    values.port_type_map[Compatible8251] = "8251 Compatible";
+    values.port_type_map[CompatibleFIFO8251] = "8251 FIFO Compatible";
+    values.port_type_map[OtherPort] = "Other";
 }
 
 std::string PortConnectionEntry::get_type() const
@@ -114,17 +124,14 @@ std::string PortConnectionEntry::get_type() const
     return "Port Connection";
 }
 
-std::string PortConnectionEntry::render_to_description() const
+void PortConnectionEntry::render_to(RenderBuffer& out) const
 {
-    std::stringstream decsription;
-    decsription << "Header type: " << get_type() << '\n';
-    decsription << "Internal Reference Designator: " << get_internal_connection_type() << '\n'; // dmi-string
-    decsription << "Internal Connection Type: " << get_internal_connection_string() << '\n';
-    decsription << "External Reference Designator: " << get_external_connection_type() << '\n'; // dmi-string
-    decsription << "External Connection Type: " << get_external_connection_string() << '\n';
-    decsription << "Port Type: " << get_port_string() << '\n';
-
-    return std::move(decsription.str());
+    out << "Header type: " << get_type() << '\n';
+    out << "Internal Reference Designator: " << static_cast<char>(get_internal_connection_type()) << '\n'; // dmi-string
+    out << "Internal Connection Type: " << get_internal_connection_string() << '\n';
+    out << "External Reference Designator: " << static_cast<char>(get_external_connection_type()) << '\n'; // dmi-string
+    out << "External Connection Type: " << get_external_connection_string() << '\n';
+    out << "Port Type: " << get_port_string() << '\n';
 }
 
 
@@ -134,8 +141,8 @@ uint8_t PortConnectionEntry::get_internal_connection_type() const
         return ConnectorType::NoneConnector;
     }
 
-    auto it = connection_type_map_.find(port_connection_->internal_connection);
-    if (it != connection_type_map_.end()) {
+    auto it = string_values().connection_type_map.find(port_connection_->internal_connection);
+    if (it != string_values().connection_type_map.end()) {
         return (*it).first;
     }
     assert(false);
@@ -148,8 +155,8 @@ uint8_t PortConnectionEntry::get_external_connection_type() const
         return ConnectorType::NoneConnector;
     }
 
-    auto it = connection_type_map_.find(port_connection_->external_connection);
-    if (it != connection_type_map_.end()) {
+    auto it = string_values().connection_type_map.find(port_connection_->external_connection);
+    if (it != string_values().connection_type_map.end()) {
         return (*it).first;
     }
     assert(false);
@@ -162,8 +169,8 @@ uint8_t PortConnectionEntry::get_port_type() const
         return PortType::NonePort;
     }
 
-    auto it = port_type_map_.find(port_connection_->port_type);
-    if (it != port_type_map_.end()) {
+    auto it = string_values().port_type_map.find(port_connection_->port_type);
+    if (it != string_values().port_type_map.end()) {
         return (*it).first;
     }
     assert(false);
@@ -172,15 +179,15 @@ uint8_t PortConnectionEntry::get_port_type() const
 
 std::string PortConnectionEntry::get_internal_connection_string() const
 {
-    return (*connection_type_map_.find(get_internal_connection_type())).second;
+    return (*string_values().connection_type_map.find(get_internal_connection_type())).second;
 }
 
 std::string PortConnectionEntry::get_external_connection_string() const
 {
-    return (*connection_type_map_.find(get_external_connection_type())).second;
+    return (*string_values().connection_type_map.find(get_external_connection_type())).second;
 }
 
 std::string PortConnectionEntry::get_port_string() const
 {
-    return (*port_type_map_.find(get_port_type())).second;
+    return (*string_values().port_type_map.find(get_port_type())).second;
 }
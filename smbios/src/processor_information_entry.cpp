@@ -0,0 +1,207 @@
+#include <smbios/processor_information_entry.h>
+#include <smbios/smbios.h>
+#include <smbios/smbios_schema.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t ProcessorInformationEntry::structure_type;
+
+constexpr SMBiosRevision ProcessorInformationLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<ProcessorInformationLayout::ProcessorUpgrade>(
+    ProcessorInformationLayout::revisions), "2.0 layout");
+static_assert(field_in_revision<ProcessorInformationLayout::L3CacheHandle>(
+    ProcessorInformationLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<ProcessorInformationLayout::PartNumber>(
+    ProcessorInformationLayout::revisions), "2.3 layout");
+static_assert(field_in_revision<ProcessorInformationLayout::Characteristics>(
+    ProcessorInformationLayout::revisions), "2.5 layout");
+static_assert(field_in_revision<ProcessorInformationLayout::ProcessorFamily2>(
+    ProcessorInformationLayout::revisions), "2.6 layout");
+static_assert(field_in_revision<ProcessorInformationLayout::ThreadCount2>(
+    ProcessorInformationLayout::revisions), "3.0 layout");
+static_assert(field_in_revision<ProcessorInformationLayout::ThreadEnabled>(
+    ProcessorInformationLayout::revisions), "3.6 layout");
+
+ProcessorInformationEntry::ProcessorInformationEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::ProcessorInformation) {
+        std::stringstream err;
+        err << "Wrong entry type, expected Processor Information, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, ProcessorInformationLayout::revisions);
+}
+
+std::string ProcessorInformationEntry::get_type() const
+{
+    return "Processor Information";
+}
+
+void ProcessorInformationEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Socket Designation: " << dmi_string_view(fields_.get<ProcessorInformationLayout::SocketDesignation>(0)) << '\n';
+    out << "Family: " << get_processor_family_string() << '\n';
+    out << "Manufacturer: " << dmi_string_view(fields_.get<ProcessorInformationLayout::Manufacturer>(0)) << '\n';
+    out << "ID: " << hex(get_processor_id()) << '\n';
+    out << "Version: " << dmi_string_view(fields_.get<ProcessorInformationLayout::ProcessorVersion>(0)) << '\n';
+    out << "External Clock: " << get_external_clock() << " MHz\n";
+    out << "Max Speed: " << get_max_speed() << " MHz\n";
+    out << "Current Speed: " << get_current_speed() << " MHz\n";
+    out << "Status: " << (is_populated() ? "Populated" : "Unpopulated") << '\n';
+    out << "Serial Number: " << dmi_string_view(fields_.get<ProcessorInformationLayout::SerialNumber>(0)) << '\n';
+    out << "Asset Tag: " << dmi_string_view(fields_.get<ProcessorInformationLayout::AssetTag>(0)) << '\n';
+    out << "Part Number: " << dmi_string_view(fields_.get<ProcessorInformationLayout::PartNumber>(0)) << '\n';
+    out << "Core Count: " << get_core_count() << '\n';
+    out << "Core Enabled: " << get_core_enabled() << '\n';
+    out << "Thread Count: " << get_thread_count() << '\n';
+}
+
+uint8_t ProcessorInformationEntry::get_processor_type() const
+{
+    return fields_.get<ProcessorInformationLayout::ProcessorType>(0x02);
+}
+
+uint16_t ProcessorInformationEntry::get_processor_family() const
+{
+    // FEh means 'see Processor Family 2'
+    const uint8_t family = fields_.get<ProcessorInformationLayout::ProcessorFamily>(0x02);
+    if (family == 0xFE) {
+        return fields_.get<ProcessorInformationLayout::ProcessorFamily2>(family);
+    }
+    return family;
+}
+
+uint64_t ProcessorInformationEntry::get_processor_id() const
+{
+    return fields_.get<ProcessorInformationLayout::ProcessorId>(0);
+}
+
+uint8_t ProcessorInformationEntry::get_voltage() const
+{
+    return fields_.get<ProcessorInformationLayout::Voltage>(0);
+}
+
+uint16_t ProcessorInformationEntry::get_external_clock() const
+{
+    return fields_.get<ProcessorInformationLayout::ExternalClock>(0);
+}
+
+uint16_t ProcessorInformationEntry::get_max_speed() const
+{
+    return fields_.get<ProcessorInformationLayout::MaxSpeed>(0);
+}
+
+uint16_t ProcessorInformationEntry::get_current_speed() const
+{
+    return fields_.get<ProcessorInformationLayout::CurrentSpeed>(0);
+}
+
+uint8_t ProcessorInformationEntry::get_status() const
+{
+    return fields_.get<ProcessorInformationLayout::Status>(CpuStatusUnknown);
+}
+
+bool ProcessorInformationEntry::is_populated() const
+{
+    return 0 != (get_status() & SocketPopulated);
+}
+
+uint8_t ProcessorInformationEntry::get_processor_upgrade() const
+{
+    return fields_.get<ProcessorInformationLayout::ProcessorUpgrade>(0x02);
+}
+
+uint16_t ProcessorInformationEntry::get_l1_cache_handle() const
+{
+    return fields_.get<ProcessorInformationLayout::L1CacheHandle>(CacheNotProvided);
+}
+
+uint16_t ProcessorInformationEntry::get_l2_cache_handle() const
+{
+    return fields_.get<ProcessorInformationLayout::L2CacheHandle>(CacheNotProvided);
+}
+
+uint16_t ProcessorInformationEntry::get_l3_cache_handle() const
+{
+    return fields_.get<ProcessorInformationLayout::L3CacheHandle>(CacheNotProvided);
+}
+
+uint16_t ProcessorInformationEntry::get_core_count() const
+{
+    // FFh means the count is in 16-bit field
+    const uint8_t count = fields_.get<ProcessorInformationLayout::CoreCount>(0);
+    if (count == 0xFF) {
+        return fields_.get<ProcessorInformationLayout::CoreCount2>(count);
+    }
+    return count;
+}
+
+uint16_t ProcessorInformationEntry::get_core_enabled() const
+{
+    const uint8_t count = fields_.get<ProcessorInformationLayout::CoreEnabled>(0);
+    if (count == 0xFF) {
+        return fields_.get<ProcessorInformationLayout::CoreEnabled2>(count);
+    }
+    return count;
+}
+
+uint16_t ProcessorInformationEntry::get_thread_count() const
+{
+    const uint8_t count = fields_.get<ProcessorInformationLayout::ThreadCount>(0);
+    if (count == 0xFF) {
+        return fields_.get<ProcessorInformationLayout::ThreadCount2>(count);
+    }
+    return count;
+}
+
+uint16_t ProcessorInformationEntry::get_characteristics() const
+{
+    return fields_.get<ProcessorInformationLayout::Characteristics>(0);
+}
+
+std::string ProcessorInformationEntry::get_socket_designation_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<ProcessorInformationLayout::SocketDesignation>(0));
+}
+
+std::string ProcessorInformationEntry::get_manufacturer_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<ProcessorInformationLayout::Manufacturer>(0));
+}
+
+std::string ProcessorInformationEntry::get_version_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<ProcessorInformationLayout::ProcessorVersion>(0));
+}
+
+std::string ProcessorInformationEntry::get_serial_number_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<ProcessorInformationLayout::SerialNumber>(0));
+}
+
+std::string ProcessorInformationEntry::get_asset_tag_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<ProcessorInformationLayout::AssetTag>(0));
+}
+
+std::string ProcessorInformationEntry::get_part_number_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<ProcessorInformationLayout::PartNumber>(0));
+}
+
+std::string ProcessorInformationEntry::get_processor_family_string() const
+{
+    // names are shared with the generic decoder
+    const uint16_t family = get_processor_family();
+    const FieldSchema* field = find_field_schema(*find_structure_schema(structure_type),
+        ProcessorInformationLayout::ProcessorFamily::offset);
+    const char* name = field ? find_field_name(*field, family) : nullptr;
+    return name ? name : std::to_string(family);
+}
@@ -0,0 +1,218 @@
+#include <smbios/projection.h>
+#include <smbios/columnar_export.h>
+#include <smbios/json_writer.h>
+#include <smbios/smbios_json.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace smbios;
+
+namespace {
+
+/// Positions of the strings of one structure, filled by single walk over the string section
+struct StringSection {
+    boost::string_view strings[255];
+    size_t count = 0;
+
+    void load(const DMIHeader& header)
+    {
+        for (const boost::string_view text : DmiStrings(header)) {
+            if (count == 255) {
+                break;
+            }
+            strings[count++] = text;
+        }
+    }
+
+    /// The same results as find_dmi_string()
+    boost::string_view get(uint8_t string_index) const
+    {
+        if (0 == string_index) {
+            return "Not Specified";
+        }
+        if (string_index > count) {
+            return "Bad index";
+        }
+        return strings[string_index - 1];
+    }
+};
+
+boost::string_view trim(boost::string_view text)
+{
+    while (!text.empty() && text.front() == ' ') {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && text.back() == ' ') {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+ProjectedField parse_selected_field(boost::string_view item)
+{
+    const boost::string_view prefix = "type";
+    const size_t dot = item.find('.');
+    if (!item.starts_with(prefix) || dot == boost::string_view::npos || dot == prefix.size() || dot + 1 == item.size()) {
+        throw std::invalid_argument("Field selection should look like type17.size: " + item.to_string());
+    }
+
+    unsigned type = 0;
+    for (char digit : item.substr(prefix.size(), dot - prefix.size())) {
+        if (digit < '0' || digit > '9' || (type = type * 10 + (digit - '0')) > 0xFF) {
+            throw std::invalid_argument("Wrong structure type in field selection: " + item.to_string());
+        }
+    }
+
+    const StructureSchema* schema = find_structure_schema(static_cast<uint8_t>(type));
+    if (!schema) {
+        throw std::invalid_argument("Structure type has no decoded fields: " + item.to_string());
+    }
+
+    const boost::string_view name = item.substr(dot + 1);
+    for (uint8_t field = 0; field < schema->fields_count; ++field) {
+        if (column_name(schema->fields[field].name) == name) {
+            return ProjectedField{ static_cast<uint8_t>(type), &schema->fields[field], name.to_string() };
+        }
+    }
+    throw std::invalid_argument("Unknown field in field selection: " + item.to_string());
+}
+
+/// logfmt value should be quoted if it is empty or has a space, quote, equals sign or control symbol
+void append_logfmt_text(RenderBuffer& out, boost::string_view text)
+{
+    const bool quoted = text.empty() || std::any_of(text.begin(), text.end(), [](char c) {
+        return c == ' ' || c == '"' || c == '=' || static_cast<uint8_t>(c) < 0x20;
+    });
+    if (!quoted) {
+        out << text;
+        return;
+    }
+
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        }
+        else if (c == '\n') {
+            out.append("\\n", 2);
+        }
+        else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+Projection::Projection(boost::string_view selection)
+{
+    while (!selection.empty()) {
+        const size_t comma = selection.find(',');
+        const boost::string_view item = trim(selection.substr(0, comma));
+        if (!item.empty()) {
+            fields_.push_back(parse_selected_field(item));
+        }
+        selection.remove_prefix(comma == boost::string_view::npos ? selection.size() : comma + 1);
+    }
+    if (fields_.empty()) {
+        throw std::invalid_argument("Field selection is empty");
+    }
+
+    std::stable_sort(fields_.begin(), fields_.end(), [](const ProjectedField& lhs, const ProjectedField& rhs) {
+        return lhs.type < rhs.type;
+    });
+
+    std::fill(std::begin(has_strings_), std::end(has_strings_), false);
+    size_t field = 0;
+    for (size_t type = 0; type <= 0xFF; ++type) {
+        type_begin_[type] = static_cast<uint16_t>(field);
+        for (; field < fields_.size() && fields_[field].type == type; ++field) {
+            has_strings_[type] = has_strings_[type] || fields_[field].field->kind == FieldKind::String;
+        }
+    }
+    type_begin_[256] = static_cast<uint16_t>(fields_.size());
+}
+
+void Projection::extract(const DMIHeader& header, const SMBiosVersion& version, std::vector<ProjectedValue>& values) const
+{
+    values.clear();
+    const ProjectedField* const fields_begin = fields_.data() + type_begin_[header.type];
+    const ProjectedField* const fields_end = fields_.data() + type_begin_[header.type + 1];
+
+    // strings are located once for all selected string fields
+    StringSection strings;
+    if (has_strings_[header.type]) {
+        strings.load(header);
+    }
+
+    for (const ProjectedField* selected = fields_begin; selected != fields_end; ++selected) {
+        const FieldSchema& field = *selected->field;
+        ProjectedValue value = { selected, field_available(field, header, version), { &field, 0, boost::string_view(), nullptr } };
+        if (value.present) {
+            if (field.kind == FieldKind::String) {
+                value.decoded.value = header.data[field.offset];
+                value.decoded.text = strings.get(header.data[field.offset]);
+            }
+            else {
+                value.decoded = decode_field(field, header);
+            }
+        }
+        values.push_back(value);
+    }
+}
+
+void Projection::render_to(const SMBios& smbios, RenderBuffer& out) const
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+    std::vector<ProjectedValue> values;
+    std::string bit_names;
+
+    for (const DMIHeader& header : smbios.get_headers()) {
+        if (!selects(header.type)) {
+            continue;
+        }
+        extract(header, version, values);
+
+        out << "handle=0x" << hex_digits(header.handle, 4) << " type=" << header.type;
+        for (const ProjectedValue& value : values) {
+            if (value.present) {
+                out << ' ' << value.field->name << '=';
+                append_field_value(out, value.decoded, bit_names, append_logfmt_text);
+            }
+        }
+        out << '\n';
+    }
+}
+
+void Projection::render_json(const SMBios& smbios, RenderBuffer& out) const
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+    std::vector<ProjectedValue> values;
+
+    JsonWriter writer(out);
+    writer.begin_array();
+    for (const DMIHeader& header : smbios.get_headers()) {
+        if (!selects(header.type)) {
+            continue;
+        }
+        extract(header, version, values);
+
+        writer.begin_object();
+        writer.key("handle").number(header.handle);
+        writer.key("type").number(header.type);
+        for (const ProjectedValue& value : values) {
+            writer.key(value.field->name);
+            if (value.present) {
+                write_field_value(value.decoded, writer);
+            }
+            else {
+                writer.null();
+            }
+        }
+        writer.end_object();
+    }
+    writer.end_array();
+    out << '\n';
+}
@@ -0,0 +1,42 @@
+#include <smbios/raw_smbios_entry.h>
+
+
+using namespace smbios;
+
+RawSMBiosEntry::RawSMBiosEntry(const DMIHeader& header) : header_(header)
+{
+}
+
+std::string RawSMBiosEntry::get_type() const
+{
+    // Types 128 through 255 are available for system- and OEM-specific information
+    if (header_.type >= 0x80) {
+        return "OEM-specific";
+    }
+    return "Not decoded";
+}
+
+std::string RawSMBiosEntry::render_to_description() const
+{
+    RenderBuffer decsription;
+    render_to(decsription);
+    return decsription.str();
+}
+
+void RawSMBiosEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Type ID: " << header_.get_type() << '\n';
+    out << "Handle: " << hex(header_.handle) << '\n';
+    out << "Length: " << header_.get_length() << '\n';
+}
+
+size_t RawSMBiosEntry::get_entry_size() const
+{
+    return header_.get_length();
+}
+
+const DMIHeader& RawSMBiosEntry::get_header() const
+{
+    return header_;
+}
@@ -0,0 +1,99 @@
+#include <smbios/render_buffer.h>
+
+#include <algorithm>
+
+using namespace smbios;
+
+namespace {
+
+// Two digits per lookup
+const char decimal_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+const char hex_symbols[] = "0123456789abcdef";
+
+// 2^64 has 20 decimal and 16 hex digits
+constexpr size_t max_digits = 20;
+
+} // namespace
+
+RenderBuffer::RenderBuffer(size_t capacity)
+{
+    reserve(capacity);
+}
+
+void RenderBuffer::reserve(size_t size)
+{
+    if (size_ + size > buffer_.size()) {
+        grow(size);
+    }
+}
+
+void RenderBuffer::grow(size_t length)
+{
+    buffer_.resize(std::max(size_ + length, buffer_.size() * 2));
+}
+
+void RenderBuffer::append_decimal(uint64_t value)
+{
+    char digits[max_digits];
+    char* position = digits + max_digits;
+
+    while (value >= 100) {
+        const size_t pair = static_cast<size_t>(value % 100) * 2;
+        value /= 100;
+        *--position = decimal_pairs[pair + 1];
+        *--position = decimal_pairs[pair];
+    }
+    if (value >= 10) {
+        const size_t pair = static_cast<size_t>(value) * 2;
+        *--position = decimal_pairs[pair + 1];
+        *--position = decimal_pairs[pair];
+    }
+    else {
+        *--position = static_cast<char>('0' + value);
+    }
+    append(position, digits + max_digits - position);
+}
+
+void RenderBuffer::append_signed(int64_t value)
+{
+    if (value < 0) {
+        *this << '-';
+        // negate in unsigned domain, INT64_MIN has no positive counterpart
+        append_decimal(0 - static_cast<uint64_t>(value));
+        return;
+    }
+    append_decimal(static_cast<uint64_t>(value));
+}
+
+void RenderBuffer::append_hex(const HexFormat& format)
+{
+    char digits[max_digits];
+    char* position = digits + max_digits;
+
+    uint64_t value = format.value;
+    do {
+        *--position = hex_symbols[value & 0x0F];
+        value >>= 4;
+    } while (value);
+
+    const size_t width = std::min<size_t>(format.width, 16);
+    while (static_cast<size_t>(digits + max_digits - position) < width) {
+        *--position = '0';
+    }
+    if (format.base && format.value) {
+        *--position = 'x';
+        *--position = '0';
+    }
+    append(position, digits + max_digits - position);
+}
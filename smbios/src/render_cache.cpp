@@ -0,0 +1,290 @@
+#include <smbios/render_cache.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <boost/filesystem.hpp>
+
+using namespace smbios;
+namespace fs = boost::filesystem;
+
+namespace {
+
+const char file_magic[4] = { 'S', 'M', 'R', 'C' };
+constexpr size_t file_header_size = 12;
+
+inline uint64_t rotl64(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t fmix64(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    k ^= k >> 33;
+    return k;
+}
+
+/// Little-endian, so the keys of disk cache do not depend on the host
+inline uint64_t load64(const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (size_t i = 8; i > 0; --i) {
+        value = (value << 8) | data[i - 1];
+    }
+    return value;
+}
+
+constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+constexpr uint64_t c2 = 0x4cf5ad432745937full;
+
+inline uint64_t mix_k1(uint64_t k1)
+{
+    k1 *= c1;
+    k1 = rotl64(k1, 31);
+    k1 *= c2;
+    return k1;
+}
+
+inline uint64_t mix_k2(uint64_t k2)
+{
+    k2 *= c2;
+    k2 = rotl64(k2, 33);
+    k2 *= c1;
+    return k2;
+}
+
+} // namespace
+
+std::string RenderKey::to_string() const
+{
+    RenderBuffer out(32);
+    out << hex_digits(high, 16) << hex_digits(low, 16);
+    return out.str();
+}
+
+RenderKey smbios::hash128(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+
+    const size_t blocks = size / 16;
+    for (size_t block = 0; block < blocks; ++block) {
+        h1 ^= mix_k1(load64(bytes + block * 16));
+        h1 = rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+
+        h2 ^= mix_k2(load64(bytes + block * 16 + 8));
+        h2 = rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    // the tail is up to 15 bytes: k1 takes the first 8, k2 the rest
+    const uint8_t* tail = bytes + blocks * 16;
+    const size_t tail_size = size & 15;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    for (size_t i = tail_size; i > 8; --i) {
+        k2 = (k2 << 8) | tail[i - 1];
+    }
+    for (size_t i = std::min<size_t>(tail_size, 8); i > 0; --i) {
+        k1 = (k1 << 8) | tail[i - 1];
+    }
+    if (tail_size > 8) {
+        h2 ^= mix_k2(k2);
+    }
+    if (tail_size > 0) {
+        h1 ^= mix_k1(k1);
+    }
+
+    h1 ^= size;
+    h2 ^= size;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+    return RenderKey{ h1, h2 };
+}
+
+RenderKey smbios::make_render_key(const uint8_t* table, size_t table_size, const SMBiosVersion& version,
+    boost::string_view options, uint32_t format_version)
+{
+    const uint64_t version_seed = (uint64_t(format_version) << 32) | (uint64_t(version.major_version) << 16) |
+        version.minor_version;
+    const RenderKey options_key = hash128(options.data(), options.size(), version_seed);
+    return hash128(table, table_size, options_key.low ^ rotl64(options_key.high, 32));
+}
+
+RenderCache::RenderCache(size_t max_bytes) : max_bytes_(max_bytes)
+{
+}
+
+RenderCache::RenderCache(size_t max_bytes, const std::string& directory) :
+    max_bytes_(max_bytes),
+    directory_(directory)
+{
+    boost::system::error_code error;
+    fs::create_directories(directory_, error);
+}
+
+bool RenderCache::find(const RenderKey& key, RenderBuffer& out)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto found = index_.find(key);
+        if (found != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, found->second);
+            out << found->second->text;
+            ++hits_;
+            return true;
+        }
+    }
+
+    // disk is read without the lock, concurrent loads of the same key are harmless
+    std::string text;
+    if (directory_.empty() || !load(key, text)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++misses_;
+        return false;
+    }
+
+    out << text;
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++hits_;
+    if (text.size() <= max_bytes_) {
+        insert(key, std::move(text));
+    }
+    return true;
+}
+
+void RenderCache::put(const RenderKey& key, boost::string_view text)
+{
+    if (!directory_.empty()) {
+        store(key, text);
+    }
+    if (text.size() > max_bytes_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    insert(key, text.to_string());
+}
+
+bool RenderCache::render(const RenderKey& key, RenderBuffer& out, const std::function<void(RenderBuffer&)>& render)
+{
+    if (find(key, out)) {
+        return true;
+    }
+    const size_t start = out.size();
+    render(out);
+    put(key, boost::string_view(out.data() + start, out.size() - start));
+    return false;
+}
+
+void RenderCache::insert(const RenderKey& key, std::string text)
+{
+    const auto found = index_.find(key);
+    if (found != index_.end()) {
+        bytes_ -= found->second->text.size();
+        entries_.erase(found->second);
+        index_.erase(found);
+    }
+
+    bytes_ += text.size();
+    entries_.push_front(Entry{ key, std::move(text) });
+    index_.emplace(key, entries_.begin());
+
+    while (bytes_ > max_bytes_ && !entries_.empty()) {
+        bytes_ -= entries_.back().text.size();
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+    }
+}
+
+std::string RenderCache::file_path(const RenderKey& key) const
+{
+    return (fs::path(directory_) / (key.to_string() + ".render")).string();
+}
+
+bool RenderCache::load(const RenderKey& key, std::string& text) const
+{
+    std::ifstream file(file_path(key), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (content.size() < file_header_size || !std::equal(std::begin(file_magic), std::end(file_magic), content.begin())) {
+        return false;
+    }
+
+    // the size detects files truncated by a crash
+    uint64_t size = 0;
+    for (size_t i = file_header_size; i > sizeof(file_magic); --i) {
+        size = (size << 8) | static_cast<uint8_t>(content[i - 1]);
+    }
+    if (size != content.size() - file_header_size) {
+        return false;
+    }
+    text = content.substr(file_header_size);
+    return true;
+}
+
+void RenderCache::store(const RenderKey& key, boost::string_view text) const
+{
+    char header[file_header_size];
+    std::copy(std::begin(file_magic), std::end(file_magic), header);
+    uint64_t size = text.size();
+    for (size_t i = sizeof(file_magic); i < file_header_size; ++i, size >>= 8) {
+        header[i] = static_cast<char>(size & 0xFF);
+    }
+
+    // readers never see partial file: it is written aside and renamed
+    const std::string path = file_path(key);
+    boost::system::error_code error;
+    const fs::path temporary = fs::path(path + fs::unique_path(".%%%%-%%%%.tmp", error).string());
+    {
+        std::ofstream file(temporary.string(), std::ios::binary);
+        file.write(header, sizeof(header));
+        file.write(text.data(), text.size());
+        if (!file) {
+            file.close();
+            fs::remove(temporary, error);
+            return;
+        }
+    }
+    fs::rename(temporary, path, error);
+    if (error) {
+        fs::remove(temporary, error);
+    }
+}
+
+size_t RenderCache::get_entries_count() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+size_t RenderCache::get_bytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+}
+
+uint64_t RenderCache::get_hits() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+uint64_t RenderCache::get_misses() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
@@ -5,11 +5,20 @@
 #endif
 
 #include <limits>
+#include <cstddef>
 #include <algorithm>
 #include <sstream>
 #include <smbios/smbios.h>
 #include <smbios/smbios_anchor.h>
 #include <smbios/physical_memory.h>
+#include <smbios/smbios_entry_factory.h>
+#include <smbios/handle_graph.h>
+#include <smbios/system_identity.h>
+#include <smbios/oem_string_index.h>
+#include <smbios/pci_device_map.h>
+#include <smbios/management_controllers.h>
+#include <smbios/render_buffer.h>
+#include <smbios/json_writer.h>
 
 // DEBUG
 #include <iostream>
@@ -17,26 +26,45 @@
 using std::numeric_limits;
 using namespace smbios;
 
-bool smbios::operator>(const SMBiosVersion& lhs, const SMBiosVersion& rhs)
+namespace {
+
+/// @brief Beginning of the structure following the one at 'structure', nullptr if the structure is broken:
+/// the header, formatted area or '\0\0' at the end of the string section goes past the table end,
+/// or the formatted area is shorter than the header
+const uint8_t* next_structure(const uint8_t* structure, const uint8_t* table_end)
 {
-    if (lhs.major_version > rhs.major_version) {
-        return true;
+    constexpr ptrdiff_t header_size = offsetof(DMIHeader, data);
+    if (table_end - structure < header_size) {
+        return nullptr;
     }
-    if (lhs.minor_version > rhs.minor_version) {
-        return true;
+    const uint8_t length = structure[offsetof(DMIHeader, length)];
+    if (length < header_size || table_end - structure < length) {
+        return nullptr;
     }
-    return false;
+    for (const uint8_t* current = structure + length; table_end - current >= 2; ++current) {
+        if (0 == current[0] && 0 == current[1]) {
+            return current + 2;
+        }
+    }
+    return nullptr;
 }
 
-bool smbios::operator<(const SMBiosVersion& lhs, const SMBiosVersion& rhs)
+} // namespace
+
+bool smbios::operator>(const SMBiosVersion& lhs, const SMBiosVersion& rhs)
 {
-    if (lhs.major_version < rhs.major_version) {
-        return true;
+    if (lhs.major_version != rhs.major_version) {
+        return lhs.major_version > rhs.major_version;
     }
-    if (lhs.minor_version < rhs.minor_version) {
-        return true;
+    return lhs.minor_version > rhs.minor_version;
+}
+
+bool smbios::operator<(const SMBiosVersion& lhs, const SMBiosVersion& rhs)
+{
+    if (lhs.major_version != rhs.major_version) {
+        return lhs.major_version < rhs.major_version;
     }
-    return false;
+    return lhs.minor_version < rhs.minor_version;
 }
 
 
@@ -88,6 +116,15 @@ SMBios::SMBios() : native_impl_(std::make_unique<SMBiosImpl>())
     read_smbios_table();
 }
 
+SMBios::SMBios(std::vector<uint8_t> table_dump, const SMBiosVersion& version)
+{
+    table_dump_ = std::move(table_dump);
+    major_version_ = version.major_version;
+    minor_version_ = version.minor_version;
+
+    read_smbios_table();
+}
+
 SMBios::~SMBios()
 {
 }
@@ -95,8 +132,12 @@ SMBios::~SMBios()
 SMBiosVersion SMBios::get_smbios_version() const
 {
     SMBiosVersion ver;
-    size_t major_version = native_impl_->get_major_version();
-    size_t minor_version = native_impl_->get_minor_version();
+    size_t major_version = numeric_limits<size_t>::max();
+    size_t minor_version = numeric_limits<size_t>::max();
+    if (native_impl_) {
+        major_version = native_impl_->get_major_version();
+        minor_version = native_impl_->get_minor_version();
+    }
 
     // native implementation provides version
     if (numeric_limits<size_t>::max() != major_version && numeric_limits<size_t>::max() != minor_version) {
@@ -122,6 +163,9 @@ const uint8_t *SMBios::get_table_base() const
     if(native_impl_ && native_impl_->get_table_base()){
         return native_impl_->get_table_base();
     }
+    if(!table_dump_.empty()){
+        return table_dump_.data();
+    }
     if(smbios_entry32_ && checksum_validated_){
         // convert from intptr_t
         return reinterpret_cast<uint8_t *>(smbios_entry32_->structure_table_address);
@@ -138,6 +182,9 @@ size_t SMBios::get_table_size() const
     if(native_impl_ && native_impl_->get_table_size()){
         return native_impl_->get_table_size();
     }
+    if(!table_dump_.empty()){
+        return table_dump_.size();
+    }
     if(smbios_entry32_ && checksum_validated_){
         return smbios_entry32_->structure_table_length;
     }
@@ -147,6 +194,61 @@ size_t SMBios::get_table_size() const
     return 0;
 }
 
+const std::vector<DMIHeader>& SMBios::get_headers() const
+{
+    return headers_list_;
+}
+
+const AbstractSMBiosEntry* SMBios::entry(size_t header_index) const
+{
+    if (header_index >= headers_list_.size()) {
+        throw std::out_of_range("SMBIOS header index is out of range");
+    }
+
+    std::call_once(entries_decoded_[header_index], [this, header_index]() {
+        entries_cache_[header_index] = entries_factory_->create(headers_list_[header_index], get_smbios_version());
+    });
+    return entries_cache_[header_index].get();
+}
+
+const HandleGraph& SMBios::handle_graph() const
+{
+    std::call_once(*handle_graph_built_, [this]() {
+        handle_graph_ = std::make_unique<HandleGraph>(headers_list_, get_smbios_version());
+    });
+    return *handle_graph_;
+}
+
+SystemIdentity SMBios::identity() const
+{
+    return read_system_identity(get_table_base(), get_table_size(), get_smbios_version());
+}
+
+boost::optional<boost::string_view> SMBios::oem_value(boost::string_view key) const
+{
+    std::call_once(*oem_index_built_, [this]() {
+        oem_index_ = std::make_unique<OemStringIndex>(headers_list_);
+    });
+    return oem_index_->find(key);
+}
+
+const PciDeviceMap& SMBios::pci_devices() const
+{
+    std::call_once(*pci_devices_built_, [this]() {
+        pci_devices_ = std::make_unique<PciDeviceMap>(headers_list_, get_smbios_version());
+    });
+    return *pci_devices_;
+}
+
+const ManagementControllers& SMBios::management_controllers() const
+{
+    std::call_once(*management_controllers_built_, [this]() {
+        management_controllers_ = std::make_unique<ManagementControllers>(
+            find_management_controllers(headers_list_, get_smbios_version()));
+    });
+    return *management_controllers_;
+}
+
 std::vector<DMIHeader>& SMBios::get_headers_list()
 {
     return headers_list_;
@@ -162,32 +264,36 @@ void SMBios::read_smbios_table()
     size_t number_of_structures = get_structures_count();
     const uint8_t* current_structure_begin = table_base;
 
-    for (size_t i = 0; i < number_of_structures && current_structure_begin <= table_end; ++i) {
-
-        DMIHeader header = *reinterpret_cast<const DMIHeader*>(current_structure_begin);
-        header.data = current_structure_begin;
+    for (size_t i = 0; i < number_of_structures; ++i) {
 
-        if (header.length < 4) {
-            // Invalid entry length. DMI table is broken
+        // counted structures are complete, the next one begins after the '\0\0'
+        const uint8_t* next_structure_begin = next_structure(current_structure_begin, table_end);
+        if (nullptr == next_structure_begin) {
             break;
         }
 
+        // only type, length and handle are stored in the table, do not read beyond them
+        DMIHeader header{};
+        std::copy_n(current_structure_begin, offsetof(DMIHeader, data), reinterpret_cast<uint8_t*>(&header));
+        header.data = current_structure_begin;
+
         if (header.type == SMBiosHandler::EndOfTable) {
             // end of table marker. Exit
             break;
         }
 
         headers_list_.push_back(header);
-
-        // look to the current structure end '\0\0'
-        current_structure_begin = current_structure_begin + header.length;
-        while (current_structure_begin < table_end &&
-               (current_structure_begin[0] != 0 || current_structure_begin[1] != 0)) {
-
-            current_structure_begin++;
-        }
-        current_structure_begin += 2;
+        current_structure_begin = next_structure_begin;
     }
+
+    // entries are decoded on demand
+    entries_cache_.resize(headers_list_.size());
+    entries_decoded_ = std::make_unique<std::once_flag[]>(headers_list_.size());
+    entries_factory_ = std::make_unique<SMBiosEntryFactory>();
+    handle_graph_built_ = std::make_unique<std::once_flag>();
+    oem_index_built_ = std::make_unique<std::once_flag>();
+    pci_devices_built_ = std::make_unique<std::once_flag>();
+    management_controllers_built_ = std::make_unique<std::once_flag>();
 }
 
 
@@ -200,29 +306,16 @@ void SMBios::count_smbios_structures()
     //points to the actual address in the buff that's been checked
     const uint8_t* offset = start_table;
 
-    //header of the struct been read to get the length to increase the offset
-    const DMIHeader* header = nullptr;
-
     size_t structures_count = 0;
 
-    //searches structures on the whole SMBIOS Table
+    // searches structures on the whole SMBIOS Table, the table could be a truncated
+    // or corrupted dump, so the count stops at the first incomplete structure
     while (offset < end_table) {
-
-        //get the header to read the length and to increase the offset
-        header = reinterpret_cast<const DMIHeader*>(offset);
-        offset += header->length;
-
-        structures_count++;
-
-        // increases the offset to point to the next header that's
-        // after the strings at the end of the structure.
-        while ((*reinterpret_cast<const uint16_t*>(offset) != 0) && (offset < end_table)) {
-            offset++;
+        offset = next_structure(offset, end_table);
+        if (nullptr == offset) {
+            break;
         }
-
-        // Points to the next structure that after two null bytes
-        // at the end of the strings section
-        offset += 2;
+        structures_count++;
     }
 
     structures_count_ = structures_count;
@@ -291,36 +384,77 @@ uint8_t SMBios::smbios_crc(uint8_t start_offset, uint8_t length) const
 }
 
 std::string SMBios::render_to_description() const
+{
+    RenderBuffer decsription;
+    render_to(decsription);
+    return decsription.str();
+}
+
+void SMBios::render_to(RenderBuffer& out) const
+{
+    if(smbios_entry32_ && checksum_validated_) {
+
+        out << "SMBIOS checksum: " << smbios_entry32_->entry_point_checksum << '\n';
+        out << "SMBIOS length: " << smbios_entry32_->entry_point_length << '\n';
+        out << "SMBIOS major version: " << smbios_entry32_->major_version << '\n';
+        out << "SMBIOS minor version: " << smbios_entry32_->minor_version << '\n';
+        out << "Maximum structure size: " << smbios_entry32_->max_structure_size << '\n';
+        out << "Entry point revision: " << smbios_entry32_->entry_point_revision << '\n';
+        out << "SMBIOS intermediate checksum: " << smbios_entry32_->intermediate_checksum << '\n';
+        out << "Structure table length: " << smbios_entry32_->structure_table_length << '\n';
+        out << "Table address: " << hex_digits(smbios_entry32_->structure_table_address, 1) << '\n';
+        out << "SMBIOS structures count: " << smbios_entry32_->smbios_structures_number << '\n';
+        out << "SMBIOS BCD revision: " << smbios_entry32_->smbios_bcd_revision << '\n';
+        return;
+    }
+
+    if(smbios_entry64_ && checksum_validated_) {
+
+        out << "SMBIOS checksum: " << smbios_entry64_->entry_point_checksum << '\n';
+        out << "SMBIOS length: " << smbios_entry64_->entry_point_length << '\n';
+        out << "SMBIOS major version: " << smbios_entry64_->major_version << '\n';
+        out << "SMBIOS minor version: " << smbios_entry64_->minor_version << '\n';
+        out << "SMBIOS doc version: " << smbios_entry64_->smbios_docrev << '\n';
+        out << "Reserved byte: " << smbios_entry64_->reserved << '\n';
+        out << "Maximum structure size: " << smbios_entry64_->max_structure_size << '\n';
+        out << "Table address: " << hex_digits(smbios_entry64_->structure_table_address, 1) << '\n';
+    }
+}
+
+void SMBios::render_entry_point_json(JsonWriter& writer) const
 {
     if(smbios_entry32_ && checksum_validated_) {
 
-        std::stringstream decsription;
-        decsription << "SMBIOS checksum: " << static_cast<size_t>(smbios_entry32_->entry_point_checksum) << '\n';
-        decsription << "SMBIOS length: " << static_cast<size_t>(smbios_entry32_->entry_point_length) << '\n';
-        decsription << "SMBIOS major version: " << static_cast<size_t>(smbios_entry32_->major_version) << '\n';
-        decsription << "SMBIOS minor version: " << static_cast<size_t>(smbios_entry32_->minor_version) << '\n';
-        decsription << "Maximum structure size: " << smbios_entry32_->max_structure_size << '\n';
-        decsription << "Entry point revision: " << static_cast<size_t>(smbios_entry32_->entry_point_revision) << '\n';
-        decsription << "SMBIOS intermediate checksum: " << static_cast<size_t>(smbios_entry32_->intermediate_checksum) << '\n';
-        decsription << "Structure table length: " << smbios_entry32_->structure_table_length << '\n';
-        decsription << "Table address: " << std::hex << smbios_entry32_->structure_table_address << std::dec << '\n';
-        decsription << "SMBIOS structures count: " << smbios_entry32_->smbios_structures_number << '\n';
-        decsription << "SMBIOS BCD revision: " << static_cast<size_t>(smbios_entry32_->smbios_bcd_revision) << '\n';
-        return std::move(decsription.str());
+        writer.begin_object();
+        writer.key("anchor").string("_SM_");
+        writer.key("checksum").number(smbios_entry32_->entry_point_checksum);
+        writer.key("length").number(smbios_entry32_->entry_point_length);
+        writer.key("major_version").number(smbios_entry32_->major_version);
+        writer.key("minor_version").number(smbios_entry32_->minor_version);
+        writer.key("max_structure_size").number(smbios_entry32_->max_structure_size);
+        writer.key("revision").number(smbios_entry32_->entry_point_revision);
+        writer.key("intermediate_checksum").number(smbios_entry32_->intermediate_checksum);
+        writer.key("table_length").number(smbios_entry32_->structure_table_length);
+        writer.key("table_address").number(static_cast<uint64_t>(smbios_entry32_->structure_table_address));
+        writer.key("structures_count").number(smbios_entry32_->smbios_structures_number);
+        writer.key("bcd_revision").number(smbios_entry32_->smbios_bcd_revision);
+        writer.end_object();
+        return;
     }
 
     if(smbios_entry64_ && checksum_validated_) {
 
-        std::stringstream decsription;
-        decsription << "SMBIOS checksum: " << static_cast<size_t>(smbios_entry64_->entry_point_checksum) << '\n';
-        decsription << "SMBIOS length: " << static_cast<size_t>(smbios_entry64_->entry_point_length) << '\n';
-        decsription << "SMBIOS major version: " << static_cast<size_t>(smbios_entry64_->major_version) << '\n';
-        decsription << "SMBIOS minor version: " << static_cast<size_t>(smbios_entry32_->minor_version) << '\n';
-        decsription << "SMBIOS doc version: " << static_cast<size_t>(smbios_entry64_->smbios_docrev) << '\n';
-        decsription << "Reserved byte: " <<  static_cast<size_t>(smbios_entry64_->reserved) << '\n';
-        decsription << "Maximum structure size: " << smbios_entry64_->max_structure_size << '\n';
-        decsription << "Table address: " << std::hex << smbios_entry64_->structure_table_address << std::dec << '\n';
-        return std::move(decsription.str());
+        writer.begin_object();
+        writer.key("anchor").string("_SM3_");
+        writer.key("checksum").number(smbios_entry64_->entry_point_checksum);
+        writer.key("length").number(smbios_entry64_->entry_point_length);
+        writer.key("major_version").number(smbios_entry64_->major_version);
+        writer.key("minor_version").number(smbios_entry64_->minor_version);
+        writer.key("doc_revision").number(smbios_entry64_->smbios_docrev);
+        writer.key("max_structure_size").number(smbios_entry64_->max_structure_size);
+        writer.key("table_address").number(static_cast<uint64_t>(smbios_entry64_->structure_table_address));
+        writer.end_object();
+        return;
     }
-    return std::string{};
+    writer.null();
 }
@@ -0,0 +1,320 @@
+#include <smbios/smbios_cbor.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace smbios;
+
+namespace {
+
+template <typename Key>
+constexpr uint64_t key(Key value)
+{
+    return static_cast<uint64_t>(value);
+}
+
+[[noreturn]] void throw_malformed(const char* what)
+{
+    throw std::runtime_error(std::string("Malformed SMBIOS message: ") + what);
+}
+
+/// Strings are counted first for definite-length array
+void write_strings(const DMIHeader& header, CborWriter& writer)
+{
+    const DmiStrings strings(header);
+    writer.begin_array(strings.size());
+    for (const boost::string_view text : strings) {
+        writer.string(text);
+    }
+}
+
+/// Elements of definite or indefinite container, break is consumed
+class Elements {
+public:
+
+    Elements(CborReader& reader, const CborItem& container) : reader_(reader), container_(container)
+    {
+    }
+
+    bool next(CborItem& element)
+    {
+        if (!container_.indefinite) {
+            if (read_ == container_.value) {
+                return false;
+            }
+            ++read_;
+        }
+        element = reader_.next();
+        if (CborType::Break == element.type) {
+            if (!container_.indefinite) {
+                throw_malformed("unexpected break");
+            }
+            return false;
+        }
+        return true;
+    }
+
+private:
+
+    CborReader& reader_;
+    const CborItem& container_;
+    uint64_t read_ = 0;
+};
+
+CborItem read_value(CborReader& reader)
+{
+    const CborItem value = reader.next();
+    if (CborType::Break == value.type) {
+        throw_malformed("map value is missing");
+    }
+    return value;
+}
+
+CborItem read_container(CborReader& reader, CborType type, const char* what)
+{
+    const CborItem container = read_value(reader);
+    if (container.type != type) {
+        throw_malformed(what);
+    }
+    return container;
+}
+
+uint64_t read_unsigned(CborReader& reader, uint64_t max, const char* what)
+{
+    const CborItem value = read_value(reader);
+    if (value.type != CborType::Unsigned || value.value > max) {
+        throw_malformed(what);
+    }
+    return value.value;
+}
+
+/// Keys are unsigned and ascending, so known entries come in the known order
+uint64_t check_key(const CborItem& item, uint64_t next_key)
+{
+    if (item.type != CborType::Unsigned || item.value < next_key) {
+        throw_malformed("map keys should be ascending unsigned integers");
+    }
+    return item.value;
+}
+
+/// Entries of the structure map, the strings vector is reused between structures
+void decode_message_structure(CborReader& reader, const CborItem& map, std::vector<boost::string_view>& strings,
+    CborMessageVisitor& visitor)
+{
+    // handle, type and length are required, begin_structure() is reported before the fields
+    constexpr uint64_t required_keys = 3;
+    uint64_t present_keys = 0;
+    uint64_t handle = 0;
+    uint64_t type = 0;
+    uint64_t length = 0;
+    bool begun = false;
+    strings.clear();
+    MessageStructure structure{};
+
+    auto begin = [&]() {
+        if (present_keys != required_keys) {
+            throw_malformed("structure without handle, type or length");
+        }
+        structure.handle = static_cast<uint16_t>(handle);
+        structure.type = static_cast<uint8_t>(type);
+        structure.length = static_cast<uint8_t>(length);
+        structure.schema = find_structure_schema(structure.type);
+        structure.strings = strings.data();
+        structure.strings_count = strings.size();
+        visitor.begin_structure(structure);
+        begun = true;
+    };
+
+    Elements entries(reader, map);
+    uint64_t next_key = 0;
+    for (CborItem item; entries.next(item);) {
+        const uint64_t entry_key = check_key(item, next_key);
+        next_key = entry_key + 1;
+
+        switch (entry_key) {
+        case key(CborStructureKey::Handle):
+            handle = read_unsigned(reader, 0xFFFF, "handle should be 16-bit number");
+            ++present_keys;
+            break;
+        case key(CborStructureKey::Type):
+            type = read_unsigned(reader, 0xFF, "type should be 8-bit number");
+            ++present_keys;
+            break;
+        case key(CborStructureKey::Length):
+            length = read_unsigned(reader, 0xFF, "length should be 8-bit number");
+            ++present_keys;
+            break;
+        case key(CborStructureKey::Strings): {
+            const CborItem array = read_container(reader, CborType::Array, "strings should be an array");
+            Elements elements(reader, array);
+            for (CborItem element; elements.next(element);) {
+                if (element.type != CborType::Text) {
+                    throw_malformed("string should be a text");
+                }
+                strings.push_back(element.text());
+            }
+            break;
+        }
+        case key(CborStructureKey::Fields): {
+            begin();
+            const CborItem fields = read_container(reader, CborType::Map, "fields should be a map");
+            Elements field_entries(reader, fields);
+            uint64_t next_offset = 0;
+            for (CborItem field_key; field_entries.next(field_key);) {
+                next_offset = check_key(field_key, next_offset) + 1;
+                if (field_key.value > 0xFF) {
+                    throw_malformed("field offset should be 8-bit number");
+                }
+
+                MessageField field{ static_cast<uint8_t>(field_key.value), nullptr, read_value(reader), boost::string_view() };
+                reader.skip(field.value);
+                if (structure.schema) {
+                    field.schema = find_field_schema(*structure.schema, field.offset);
+                }
+                if (field.schema && CborType::Unsigned == field.value.type) {
+                    if (FieldKind::String == field.schema->kind) {
+                        if (field.value.value >= 1 && field.value.value <= strings.size()) {
+                            field.text = strings[static_cast<size_t>(field.value.value - 1)];
+                        }
+                    }
+                    else if (FieldKind::Enum == field.schema->kind && field.value.value <= 0xFFFF) {
+                        if (const char* name = find_field_name(*field.schema, static_cast<uint16_t>(field.value.value))) {
+                            field.text = name;
+                        }
+                    }
+                }
+                visitor.field(structure, field);
+            }
+            break;
+        }
+        default:
+            reader.skip(read_value(reader));
+            break;
+        }
+    }
+
+    if (!begun) {
+        begin();
+    }
+    visitor.end_structure(structure);
+}
+
+} // namespace
+
+void smbios::write_cbor_field_value(const DecodedField& field, CborWriter& writer)
+{
+    const FieldSchema& schema = *field.schema;
+    if (FieldKind::Bytes == schema.kind) {
+        writer.bytes(field.bytes, schema.width);
+    }
+    else {
+        // string index, enum value and bit set as they are in the table
+        writer.number(field.value);
+    }
+}
+
+void smbios::render_structure_cbor(const DMIHeader& header, const SMBiosVersion& version, CborWriter& writer)
+{
+    const StructureSchema* schema = find_structure_schema(header.type);
+
+    writer.begin_map(schema ? 5 : 4);
+    writer.number(key(CborStructureKey::Handle)).number(header.handle);
+    writer.number(key(CborStructureKey::Type)).number(header.type);
+    writer.number(key(CborStructureKey::Length)).number(header.length);
+    writer.number(key(CborStructureKey::Strings));
+    write_strings(header, writer);
+    if (schema) {
+        // fields are counted by the schema walk, so the map is closed by a break
+        writer.number(key(CborStructureKey::Fields)).begin_map();
+        decode_structure(*schema, header, version, [&writer](const DecodedField& field) {
+            writer.number(field.schema->offset);
+            write_cbor_field_value(field, writer);
+        });
+        writer.end();
+    }
+}
+
+void smbios::render_cbor(const SMBios& smbios, boost::string_view host, RenderBuffer& out)
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+
+    CborWriter writer(out);
+    writer.begin_map(host.empty() ? 3 : 4);
+    writer.number(key(CborMessageKey::Version)).begin_array(2).number(version.major_version).number(version.minor_version);
+    writer.number(key(CborMessageKey::TableSize)).number(smbios.get_table_size());
+    if (!host.empty()) {
+        writer.number(key(CborMessageKey::Host)).string(host);
+    }
+    writer.number(key(CborMessageKey::Structures)).begin_array(headers.size());
+    for (const DMIHeader& header : headers) {
+        render_structure_cbor(header, version, writer);
+    }
+}
+
+size_t smbios::decode_cbor_message(const uint8_t* data, size_t size, CborMessageVisitor& visitor)
+{
+    CborReader reader(data, size);
+    const CborItem map = read_container(reader, CborType::Map, "message should be a map");
+
+    SMBiosVersion version{ 0, 0 };
+    uint64_t table_size = 0;
+    boost::string_view host;
+    bool reported = false;
+    auto report_table = [&]() {
+        visitor.table(version, table_size, host);
+        reported = true;
+    };
+
+    std::vector<boost::string_view> strings;
+    Elements entries(reader, map);
+    uint64_t next_key = 0;
+    for (CborItem item; entries.next(item);) {
+        const uint64_t entry_key = check_key(item, next_key);
+        next_key = entry_key + 1;
+
+        switch (entry_key) {
+        case key(CborMessageKey::Version): {
+            const CborItem array = read_container(reader, CborType::Array, "version should be an array");
+            if (array.indefinite || array.value != 2) {
+                throw_malformed("version should be [major, minor]");
+            }
+            version.major_version = static_cast<uint16_t>(read_unsigned(reader, 0xFFFF, "version should be [major, minor]"));
+            version.minor_version = static_cast<uint16_t>(read_unsigned(reader, 0xFFFF, "version should be [major, minor]"));
+            break;
+        }
+        case key(CborMessageKey::TableSize):
+            table_size = read_unsigned(reader, UINT64_MAX, "table size should be a number");
+            break;
+        case key(CborMessageKey::Host): {
+            const CborItem text = read_value(reader);
+            if (text.type != CborType::Text) {
+                throw_malformed("host should be a text");
+            }
+            host = text.text();
+            break;
+        }
+        case key(CborMessageKey::Structures): {
+            report_table();
+            const CborItem array = read_container(reader, CborType::Array, "structures should be an array");
+            Elements structures(reader, array);
+            for (CborItem structure; structures.next(structure);) {
+                if (structure.type != CborType::Map) {
+                    throw_malformed("structure should be a map");
+                }
+                decode_message_structure(reader, structure, strings, visitor);
+            }
+            break;
+        }
+        default:
+            reader.skip(read_value(reader));
+            break;
+        }
+    }
+
+    if (!reported) {
+        report_table();
+    }
+    return reader.position();
+}
@@ -8,8 +8,24 @@ using namespace smbios;
 SMBiosEntryFactory::SMBiosEntryFactory()
 {
     entries_factory_[SMBios::BIOSInformation] = boost::bind(boost::factory<BiosInformationEntry*>(), _1, _2);
+    entries_factory_[SMBios::ProcessorInformation] =
+        boost::bind(boost::factory<ProcessorInformationEntry*>(), _1, _2);
+    entries_factory_[SMBios::CacheInformation] = boost::bind(boost::factory<CacheInformationEntry*>(), _1, _2);
     entries_factory_[SMBios::PortConnection] = boost::bind(boost::factory<PortConnectionEntry*>(), _1, _2);
+    entries_factory_[SMBios::SystemSlots] = boost::bind(boost::factory<SystemSlotsEntry*>(), _1, _2);
+    entries_factory_[SMBios::OemStrings] = boost::bind(boost::factory<OemStringsEntry*>(), _1, _2);
+    entries_factory_[SMBios::SystemConfigurationOptions] =
+        boost::bind(boost::factory<SystemConfigurationOptionsEntry*>(), _1, _2);
     entries_factory_[SMBios::MemoryDevice] = boost::bind(boost::factory<MemoryDeviceEntry*>(), _1, _2);
+    entries_factory_[SMBios::MemoryArrayMappedAddress] =
+        boost::bind(boost::factory<MemoryArrayMappedAddressEntry*>(), _1, _2);
+    entries_factory_[SMBios::MemoryDeviceMappedAddress] =
+        boost::bind(boost::factory<MemoryDeviceMappedAddressEntry*>(), _1, _2);
+    entries_factory_[SMBios::IpmiDevice] = boost::bind(boost::factory<IpmiDeviceEntry*>(), _1, _2);
+    entries_factory_[SMBios::OnboardDevicesExtended] =
+        boost::bind(boost::factory<OnboardDevicesExtendedEntry*>(), _1, _2);
+    entries_factory_[SMBios::ManagementHostInterface] =
+        boost::bind(boost::factory<ManagementHostInterfaceEntry*>(), _1, _2);
 }
 
 std::unique_ptr<AbstractSMBiosEntry> smbios::SMBiosEntryFactory::create(const DMIHeader& header, 
@@ -18,8 +34,62 @@ std::unique_ptr<AbstractSMBiosEntry> smbios::SMBiosEntryFactory::create(const DM
     if (entries_factory_.find(header.type) != entries_factory_.end()) {
         return std::unique_ptr<AbstractSMBiosEntry>(entries_factory_.at(header.type)(header, version));
     } 
+    else if (find_structure_schema(header.type)) {
+        // standard structure without dedicated class, decode by its schema
+        return std::unique_ptr<AbstractSMBiosEntry>(new GenericSMBiosEntry(header, version));
+    }
     else{
         // no such index, just proceed
         return nullptr;
     }
 }
+
+SMBiosEntryVariant SMBiosEntryFactory::create_variant(const DMIHeader& header,
+    const SMBiosVersion& version) const
+{
+    switch (header.type) {
+    case SMBios::BIOSInformation:
+        return BiosInformationEntry(header, version);
+    case SMBios::ProcessorInformation:
+        return ProcessorInformationEntry(header, version);
+    case SMBios::CacheInformation:
+        return CacheInformationEntry(header, version);
+    case SMBios::PortConnection:
+        return PortConnectionEntry(header, version);
+    case SMBios::SystemSlots:
+        return SystemSlotsEntry(header, version);
+    case SMBios::OemStrings:
+        return OemStringsEntry(header, version);
+    case SMBios::SystemConfigurationOptions:
+        return SystemConfigurationOptionsEntry(header, version);
+    case SMBios::MemoryDevice:
+        return MemoryDeviceEntry(header, version);
+    case SMBios::MemoryArrayMappedAddress:
+        return MemoryArrayMappedAddressEntry(header, version);
+    case SMBios::MemoryDeviceMappedAddress:
+        return MemoryDeviceMappedAddressEntry(header, version);
+    case SMBios::IpmiDevice:
+        return IpmiDeviceEntry(header, version);
+    case SMBios::OnboardDevicesExtended:
+        return OnboardDevicesExtendedEntry(header, version);
+    case SMBios::ManagementHostInterface:
+        return ManagementHostInterfaceEntry(header, version);
+    default:
+        if (find_structure_schema(header.type)) {
+            return GenericSMBiosEntry(header, version);
+        }
+        return RawSMBiosEntry(header);
+    }
+}
+
+std::vector<SMBiosEntryVariant> SMBiosEntryFactory::create_all(SMBios& smbios) const
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+
+    std::vector<SMBiosEntryVariant> entries;
+    entries.reserve(smbios.get_structures_count());
+    for (const DMIHeader& header : smbios) {
+        entries.push_back(create_variant(header, version));
+    }
+    return entries;
+}
@@ -0,0 +1,113 @@
+#include <smbios/smbios_json.h>
+#include <smbios/smbios_schema.h>
+
+using namespace smbios;
+
+namespace {
+
+void write_field(const DecodedField& field, JsonWriter& writer)
+{
+    writer.key(field.schema->name);
+    write_field_value(field, writer);
+}
+
+void write_strings(const DMIHeader& header, JsonWriter& writer)
+{
+    writer.begin_array();
+    for (const boost::string_view text : DmiStrings(header)) {
+        writer.string(text);
+    }
+    writer.end_array();
+}
+
+} // namespace
+
+void smbios::write_field_value(const DecodedField& field, JsonWriter& writer)
+{
+    const FieldSchema& schema = *field.schema;
+    switch (schema.kind) {
+    case FieldKind::String:
+        writer.string(field.text);
+        break;
+    case FieldKind::Enum:
+        if (!field.text.empty()) {
+            writer.string(field.text);
+        }
+        else {
+            writer.number(field.value);
+        }
+        break;
+    case FieldKind::Bitfield:
+        writer.begin_array();
+        for (size_t bit = 0; bit < schema.width * 8u; ++bit) {
+            if (field.value & (uint64_t(1) << bit)) {
+                if (const char* name = find_field_name(schema, static_cast<uint16_t>(bit))) {
+                    writer.string(name);
+                }
+            }
+        }
+        writer.end_array();
+        break;
+    case FieldKind::Bytes:
+        writer.hex_bytes(field.bytes, schema.width);
+        break;
+    default:
+        writer.number(field.value);
+        break;
+    }
+}
+
+void smbios::render_structure_json(const DMIHeader& header, const SMBiosVersion& version, JsonWriter& writer)
+{
+    const StructureSchema* schema = find_structure_schema(header.type);
+
+    writer.begin_object();
+    writer.key("handle").number(header.handle);
+    writer.key("type").number(header.type);
+    writer.key("length").number(header.length);
+    if (schema) {
+        writer.key("name").string(schema->name);
+        writer.key("fields").begin_object();
+        decode_structure(*schema, header, version, [&writer](const DecodedField& field) {
+            write_field(field, writer);
+        });
+        writer.end_object();
+    }
+    else {
+        // the same names as RawSMBiosEntry has
+        writer.key("name").string(header.type >= 0x80 ? "OEM-specific" : "Not decoded");
+    }
+    writer.key("strings");
+    write_strings(header, writer);
+    writer.end_object();
+}
+
+void smbios::render_json(const SMBios& smbios, RenderBuffer& out)
+{
+    const SMBiosVersion version = smbios.get_smbios_version();
+
+    JsonWriter writer(out);
+    writer.begin_object();
+    writer.key("version").begin_object();
+    writer.key("major").number(version.major_version);
+    writer.key("minor").number(version.minor_version);
+    writer.end_object();
+    writer.key("table_size").number(smbios.get_table_size());
+    writer.key("entry_point");
+    smbios.render_entry_point_json(writer);
+
+    writer.key("structures").begin_array();
+    for (const DMIHeader& header : smbios.get_headers()) {
+        render_structure_json(header, version, writer);
+    }
+    writer.end_array();
+    writer.end_object();
+    out << '\n';
+}
+
+std::string smbios::render_json(const SMBios& smbios)
+{
+    RenderBuffer out;
+    render_json(smbios, out);
+    return out.str();
+}
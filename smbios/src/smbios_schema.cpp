@@ -0,0 +1,1161 @@
+#include <smbios/smbios_schema.h>
+#include <smbios/smbios_field.h>
+
+#include <algorithm>
+#include <cstring>
+
+// SMBIOS structure descriptors, see DMTF DSP0134 'Structure definitions'
+// Fields of the original structure layout are marked with version 2.0, so that
+// structures reported by firmware with older table version are still decoded;
+// extensions are marked with the version which introduced them
+
+using namespace smbios;
+
+namespace {
+
+//////////////////////////////////////////////////////////////////////////
+// Common name tables
+
+constexpr FieldName common_status_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "OK" }, { 0x04, "Non-critical" },
+    { 0x05, "Critical" }, { 0x06, "Non-recoverable" }
+};
+
+constexpr FieldName error_correction_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "None" }, { 0x04, "Parity" },
+    { 0x05, "Single-bit ECC" }, { 0x06, "Multi-bit ECC" }, { 0x07, "CRC" }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 0: BIOS Information
+
+constexpr FieldName bios_characteristics_names[] = {
+    { 2, "Unknown" }, { 3, "BIOS characteristics not supported" },
+    { 4, "ISA is supported" }, { 5, "MCA is supported" }, { 6, "EISA is supported" },
+    { 7, "PCI is supported" }, { 8, "PC Card (PCMCIA) is supported" }, { 9, "PNP is supported" },
+    { 10, "APM is supported" }, { 11, "BIOS is upgradeable" }, { 12, "BIOS shadowing is allowed" },
+    { 13, "VLB is supported" }, { 14, "ESCD support is available" }, { 15, "Boot from CD is supported" },
+    { 16, "Selectable boot is supported" }, { 17, "BIOS ROM is socketed" },
+    { 18, "Boot from PC Card (PCMCIA) is supported" }, { 19, "EDD is supported" },
+    { 20, "Japanese floppy for NEC 9800 1.2 MB is supported (int 13h)" },
+    { 21, "Japanese floppy for Toshiba 1.2 MB is supported (int 13h)" },
+    { 22, "5.25\"/360 kB floppy services are supported (int 13h)" },
+    { 23, "5.25\"/1.2 MB floppy services are supported (int 13h)" },
+    { 24, "3.5\"/720 kB floppy services are supported (int 13h)" },
+    { 25, "3.5\"/2.88 MB floppy services are supported (int 13h)" },
+    { 26, "Print screen service is supported (int 5h)" },
+    { 27, "8042 keyboard services are supported (int 9h)" },
+    { 28, "Serial services are supported (int 14h)" }, { 29, "Printer services are supported (int 17h)" },
+    { 30, "CGA/mono video services are supported (int 10h)" }, { 31, "NEC PC-98" }
+};
+
+constexpr FieldName bios_extension1_names[] = {
+    { 0, "ACPI is supported" }, { 1, "USB legacy is supported" }, { 2, "AGP is supported" },
+    { 3, "I2O boot is supported" }, { 4, "LS-120 boot is supported" }, { 5, "ATAPI Zip drive boot is supported" },
+    { 6, "IEEE 1394 boot is supported" }, { 7, "Smart battery is supported" }
+};
+
+constexpr FieldName bios_extension2_names[] = {
+    { 0, "BIOS boot specification is supported" },
+    { 1, "Function key-initiated network boot is supported" },
+    { 2, "Targeted content distribution is supported" }, { 3, "UEFI is supported" },
+    { 4, "System is a virtual machine" }, { 5, "Manufacturing mode is supported" },
+    { 6, "Manufacturing mode is enabled" }
+};
+
+constexpr FieldSchema bios_information_fields[] = {
+    string_field("Vendor", 0x04),
+    string_field("Version", 0x05),
+    integer_field("Starting Address Segment", 0x06, 2),
+    string_field("Release Date", 0x08),
+    integer_field("ROM Size", 0x09, 1),
+    bitfield_field("Characteristics", 0x0A, 8, bios_characteristics_names),
+    bitfield_field("Characteristics Extension 1", 0x12, 1, bios_extension1_names, 2, 4),
+    bitfield_field("Characteristics Extension 2", 0x13, 1, bios_extension2_names, 2, 4),
+    integer_field("BIOS Major Release", 0x14, 1, 2, 4),
+    integer_field("BIOS Minor Release", 0x15, 1, 2, 4),
+    integer_field("Firmware Major Release", 0x16, 1, 2, 4),
+    integer_field("Firmware Minor Release", 0x17, 1, 2, 4),
+    integer_field("Extended ROM Size", 0x18, 2, 3, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 1: System Information
+
+constexpr FieldName wake_up_type_names[] = {
+    { 0x00, "Reserved" }, { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "APM Timer" },
+    { 0x04, "Modem Ring" }, { 0x05, "LAN Remote" }, { 0x06, "Power Switch" }, { 0x07, "PCI PME#" },
+    { 0x08, "AC Power Restored" }
+};
+
+constexpr FieldSchema system_information_fields[] = {
+    string_field("Manufacturer", 0x04),
+    string_field("Product Name", 0x05),
+    string_field("Version", 0x06),
+    string_field("Serial Number", 0x07),
+    bytes_field("UUID", 0x08, 16, 2, 1),
+    enum_field("Wake-up Type", 0x18, 1, wake_up_type_names, 2, 1),
+    string_field("SKU Number", 0x19, 2, 4),
+    string_field("Family", 0x1A, 2, 4)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 2: Baseboard Information
+
+constexpr FieldName baseboard_feature_names[] = {
+    { 0, "Board is a hosting board" }, { 1, "Board requires at least one daughter board" },
+    { 2, "Board is removable" }, { 3, "Board is replaceable" }, { 4, "Board is hot swappable" }
+};
+
+constexpr FieldName baseboard_type_names[] = {
+    { 0x01, "Unknown" }, { 0x02, "Other" }, { 0x03, "Server Blade" }, { 0x04, "Connectivity Switch" },
+    { 0x05, "System Management Module" }, { 0x06, "Processor Module" }, { 0x07, "I/O Module" },
+    { 0x08, "Memory Module" }, { 0x09, "Daughter Board" }, { 0x0A, "Motherboard" },
+    { 0x0B, "Processor+Memory Module" }, { 0x0C, "Processor+I/O Module" }, { 0x0D, "Interconnect Board" }
+};
+
+constexpr FieldSchema baseboard_information_fields[] = {
+    string_field("Manufacturer", 0x04),
+    string_field("Product Name", 0x05),
+    string_field("Version", 0x06),
+    string_field("Serial Number", 0x07),
+    string_field("Asset Tag", 0x08),
+    bitfield_field("Features", 0x09, 1, baseboard_feature_names),
+    string_field("Location In Chassis", 0x0A),
+    handle_field("Chassis Handle", 0x0B),
+    enum_field("Type", 0x0D, 1, baseboard_type_names),
+    integer_field("Contained Object Handles", 0x0E, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 3: System Enclosure or Chassis
+
+constexpr FieldName chassis_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Desktop" }, { 0x04, "Low Profile Desktop" },
+    { 0x05, "Pizza Box" }, { 0x06, "Mini Tower" }, { 0x07, "Tower" }, { 0x08, "Portable" },
+    { 0x09, "Laptop" }, { 0x0A, "Notebook" }, { 0x0B, "Hand Held" }, { 0x0C, "Docking Station" },
+    { 0x0D, "All In One" }, { 0x0E, "Sub Notebook" }, { 0x0F, "Space-saving" }, { 0x10, "Lunch Box" },
+    { 0x11, "Main Server Chassis" }, { 0x12, "Expansion Chassis" }, { 0x13, "Sub Chassis" },
+    { 0x14, "Bus Expansion Chassis" }, { 0x15, "Peripheral Chassis" }, { 0x16, "RAID Chassis" },
+    { 0x17, "Rack Mount Chassis" }, { 0x18, "Sealed-case PC" }, { 0x19, "Multi-system" },
+    { 0x1A, "CompactPCI" }, { 0x1B, "AdvancedTCA" }, { 0x1C, "Blade" }, { 0x1D, "Blade Enclosing" },
+    { 0x1E, "Tablet" }, { 0x1F, "Convertible" }, { 0x20, "Detachable" }, { 0x21, "IoT Gateway" },
+    { 0x22, "Embedded PC" }, { 0x23, "Mini PC" }, { 0x24, "Stick PC" }
+};
+
+constexpr FieldName chassis_security_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "None" },
+    { 0x04, "External Interface Locked Out" }, { 0x05, "External Interface Enabled" }
+};
+
+constexpr FieldSchema chassis_fields[] = {
+    string_field("Manufacturer", 0x04),
+    enum_field("Type", 0x05, 1, chassis_type_names, 2, 0, 7),
+    string_field("Version", 0x06),
+    string_field("Serial Number", 0x07),
+    string_field("Asset Tag", 0x08),
+    enum_field("Boot-up State", 0x09, 1, common_status_names, 2, 1),
+    enum_field("Power Supply State", 0x0A, 1, common_status_names, 2, 1),
+    enum_field("Thermal State", 0x0B, 1, common_status_names, 2, 1),
+    enum_field("Security Status", 0x0C, 1, chassis_security_names, 2, 1),
+    integer_field("OEM Information", 0x0D, 4, 2, 3),
+    integer_field("Height", 0x11, 1, 2, 3),
+    integer_field("Number Of Power Cords", 0x12, 1, 2, 3),
+    integer_field("Contained Element Count", 0x13, 1, 2, 3),
+    integer_field("Contained Element Record Length", 0x14, 1, 2, 3)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 4: Processor Information
+
+constexpr FieldName processor_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Central Processor" }, { 0x04, "Math Processor" },
+    { 0x05, "DSP Processor" }, { 0x06, "Video Processor" }
+};
+
+constexpr FieldName processor_family_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "8086" }, { 0x04, "80286" }, { 0x05, "Intel386" },
+    { 0x06, "Intel486" }, { 0x0B, "Pentium" }, { 0x0C, "Pentium Pro" }, { 0x0D, "Pentium II" },
+    { 0x0E, "Pentium MMX" }, { 0x0F, "Celeron" }, { 0x10, "Pentium II Xeon" }, { 0x11, "Pentium III" },
+    { 0x14, "Celeron M" }, { 0x15, "Pentium 4 HT" }, { 0x18, "Duron" }, { 0x19, "K5" }, { 0x1A, "K6" },
+    { 0x1B, "K6-2" }, { 0x1C, "K6-3" }, { 0x1D, "Athlon" }, { 0x28, "Core Duo" },
+    { 0x29, "Core Duo Mobile" }, { 0x2A, "Core Solo Mobile" }, { 0x2B, "Atom" }, { 0x2C, "Core M" },
+    { 0x6B, "Zen" }, { 0x83, "Athlon 64" }, { 0x84, "Opteron" }, { 0x85, "Sempron" },
+    { 0x86, "Turion 64" }, { 0x87, "Dual-Core Opteron" }, { 0x88, "Athlon 64 X2" },
+    { 0x8A, "Quad-Core Opteron" }, { 0x8B, "Third-Generation Opteron" }, { 0xB3, "Xeon" },
+    { 0xB5, "Xeon MP" }, { 0xB6, "Athlon XP" }, { 0xB7, "Athlon MP" }, { 0xB8, "Itanium 2" },
+    { 0xB9, "Pentium M" }, { 0xBA, "Celeron D" }, { 0xBB, "Pentium D" }, { 0xBC, "Pentium EE" },
+    { 0xBD, "Core Solo" }, { 0xBF, "Core 2 Duo" }, { 0xC0, "Core 2 Solo" }, { 0xC1, "Core 2 Extreme" },
+    { 0xC2, "Core 2 Quad" }, { 0xC6, "Core i7" }, { 0xC7, "Dual-Core Celeron" }, { 0xCD, "Core i5" },
+    { 0xCE, "Core i3" }, { 0xCF, "Core i9" }, { 0xFE, "See Processor Family 2" },
+    { 0x100, "ARMv7" }, { 0x101, "ARMv8" }, { 0x102, "ARMv9" }, { 0x200, "RISC-V RV32" },
+    { 0x201, "RISC-V RV64" }, { 0x202, "RISC-V RV128" }
+};
+
+constexpr FieldName processor_upgrade_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Daughter Board" }, { 0x04, "ZIF Socket" },
+    { 0x05, "Replaceable Piggy Back" }, { 0x06, "None" }, { 0x07, "LIF Socket" }, { 0x08, "Slot 1" },
+    { 0x09, "Slot 2" }, { 0x0A, "370-pin Socket" }, { 0x0B, "Slot A" }, { 0x0C, "Slot M" },
+    { 0x0D, "Socket 423" }, { 0x0E, "Socket A (Socket 462)" }, { 0x0F, "Socket 478" },
+    { 0x10, "Socket 754" }, { 0x11, "Socket 940" }, { 0x12, "Socket 939" }, { 0x13, "Socket mPGA604" },
+    { 0x14, "Socket LGA771" }, { 0x15, "Socket LGA775" }, { 0x16, "Socket S1" }, { 0x17, "Socket AM2" },
+    { 0x18, "Socket F (1207)" }, { 0x19, "Socket LGA1366" }, { 0x1A, "Socket G34" },
+    { 0x1B, "Socket AM3" }, { 0x1C, "Socket C32" }, { 0x1D, "Socket LGA1156" }, { 0x1E, "Socket LGA1567" },
+    { 0x1F, "Socket PGA988A" }, { 0x20, "Socket BGA1288" }, { 0x21, "Socket rPGA988B" },
+    { 0x22, "Socket BGA1023" }, { 0x23, "Socket BGA1224" }, { 0x24, "Socket LGA1155" },
+    { 0x25, "Socket LGA1356" }, { 0x26, "Socket LGA2011" }, { 0x27, "Socket FS1" }, { 0x28, "Socket FS2" },
+    { 0x29, "Socket FM1" }, { 0x2A, "Socket FM2" }, { 0x2B, "Socket LGA2011-3" },
+    { 0x2C, "Socket LGA1356-3" }, { 0x2D, "Socket LGA1150" }, { 0x2E, "Socket BGA1168" },
+    { 0x2F, "Socket BGA1234" }, { 0x30, "Socket BGA1364" }, { 0x31, "Socket AM4" },
+    { 0x32, "Socket LGA1151" }, { 0x33, "Socket BGA1356" }, { 0x34, "Socket BGA1440" },
+    { 0x35, "Socket BGA1515" }, { 0x36, "Socket LGA3647-1" }, { 0x37, "Socket SP3" },
+    { 0x38, "Socket SP3r2" }, { 0x39, "Socket LGA2066" }, { 0x3A, "Socket BGA1392" },
+    { 0x3B, "Socket BGA1510" }, { 0x3C, "Socket BGA1528" }
+};
+
+constexpr FieldName processor_characteristics_names[] = {
+    { 1, "Unknown" }, { 2, "64-bit capable" }, { 3, "Multi-Core" }, { 4, "Hardware Thread" },
+    { 5, "Execute Protection" }, { 6, "Enhanced Virtualization" }, { 7, "Power/Performance Control" },
+    { 8, "128-bit Capable" }, { 9, "Arm64 SoC ID" }
+};
+
+constexpr FieldSchema processor_fields[] = {
+    string_field("Socket Designation", 0x04),
+    enum_field("Type", 0x05, 1, processor_type_names),
+    enum_field("Family", 0x06, 1, processor_family_names),
+    string_field("Manufacturer", 0x07),
+    integer_field("ID", 0x08, 8),
+    string_field("Version", 0x10),
+    integer_field("Voltage", 0x11, 1),
+    integer_field("External Clock", 0x12, 2),
+    integer_field("Max Speed", 0x14, 2),
+    integer_field("Current Speed", 0x16, 2),
+    integer_field("Status", 0x18, 1),
+    enum_field("Upgrade", 0x19, 1, processor_upgrade_names),
+    handle_field("L1 Cache Handle", 0x1A, 2, 1),
+    handle_field("L2 Cache Handle", 0x1C, 2, 1),
+    handle_field("L3 Cache Handle", 0x1E, 2, 1),
+    string_field("Serial Number", 0x20, 2, 3),
+    string_field("Asset Tag", 0x21, 2, 3),
+    string_field("Part Number", 0x22, 2, 3),
+    integer_field("Core Count", 0x23, 1, 2, 5),
+    integer_field("Core Enabled", 0x24, 1, 2, 5),
+    integer_field("Thread Count", 0x25, 1, 2, 5),
+    bitfield_field("Characteristics", 0x26, 2, processor_characteristics_names, 2, 5),
+    enum_field("Family 2", 0x28, 2, processor_family_names, 2, 6),
+    integer_field("Core Count 2", 0x2A, 2, 3, 0),
+    integer_field("Core Enabled 2", 0x2C, 2, 3, 0),
+    integer_field("Thread Count 2", 0x2E, 2, 3, 0)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 5: Memory Controller Information (obsolete)
+
+constexpr FieldName error_detecting_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "None" }, { 0x04, "8-bit Parity" },
+    { 0x05, "32-bit ECC" }, { 0x06, "64-bit ECC" }, { 0x07, "128-bit ECC" }, { 0x08, "CRC" }
+};
+
+constexpr FieldName interleave_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "One-way Interleave" }, { 0x04, "Two-way Interleave" },
+    { 0x05, "Four-way Interleave" }, { 0x06, "Eight-way Interleave" }, { 0x07, "Sixteen-way Interleave" }
+};
+
+constexpr FieldSchema memory_controller_fields[] = {
+    enum_field("Error Detecting Method", 0x04, 1, error_detecting_names),
+    integer_field("Error Correcting Capabilities", 0x05, 1),
+    enum_field("Supported Interleave", 0x06, 1, interleave_names),
+    enum_field("Current Interleave", 0x07, 1, interleave_names),
+    integer_field("Maximum Memory Module Size", 0x08, 1),
+    integer_field("Supported Speeds", 0x09, 2),
+    integer_field("Supported Memory Types", 0x0B, 2),
+    integer_field("Memory Module Voltage", 0x0D, 1),
+    integer_field("Associated Memory Slots", 0x0E, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 6: Memory Module Information (obsolete)
+
+constexpr FieldSchema memory_module_fields[] = {
+    string_field("Socket Designation", 0x04),
+    integer_field("Bank Connections", 0x05, 1),
+    integer_field("Current Speed", 0x06, 1),
+    integer_field("Current Memory Type", 0x07, 2),
+    integer_field("Installed Size", 0x09, 1),
+    integer_field("Enabled Size", 0x0A, 1),
+    integer_field("Error Status", 0x0B, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 7: Cache Information
+
+constexpr FieldName sram_type_names[] = {
+    { 0, "Other" }, { 1, "Unknown" }, { 2, "Non-Burst" }, { 3, "Burst" }, { 4, "Pipeline Burst" },
+    { 5, "Synchronous" }, { 6, "Asynchronous" }
+};
+
+constexpr FieldName cache_error_correction_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "None" }, { 0x04, "Parity" },
+    { 0x05, "Single-bit ECC" }, { 0x06, "Multi-bit ECC" }
+};
+
+constexpr FieldName system_cache_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Instruction" }, { 0x04, "Data" }, { 0x05, "Unified" }
+};
+
+constexpr FieldName cache_associativity_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Direct Mapped" }, { 0x04, "2-way Set-associative" },
+    { 0x05, "4-way Set-associative" }, { 0x06, "Fully Associative" }, { 0x07, "8-way Set-associative" },
+    { 0x08, "16-way Set-associative" }, { 0x09, "12-way Set-associative" },
+    { 0x0A, "24-way Set-associative" }, { 0x0B, "32-way Set-associative" },
+    { 0x0C, "48-way Set-associative" }, { 0x0D, "64-way Set-associative" },
+    { 0x0E, "20-way Set-associative" }
+};
+
+constexpr FieldSchema cache_fields[] = {
+    string_field("Socket Designation", 0x04),
+    integer_field("Configuration", 0x05, 2),
+    integer_field("Maximum Size", 0x07, 2),
+    integer_field("Installed Size", 0x09, 2),
+    bitfield_field("Supported SRAM Type", 0x0B, 2, sram_type_names),
+    bitfield_field("Current SRAM Type", 0x0D, 2, sram_type_names),
+    integer_field("Speed", 0x0F, 1, 2, 1),
+    enum_field("Error Correction Type", 0x10, 1, cache_error_correction_names, 2, 1),
+    enum_field("System Type", 0x11, 1, system_cache_type_names, 2, 1),
+    enum_field("Associativity", 0x12, 1, cache_associativity_names, 2, 1),
+    integer_field("Maximum Size 2", 0x13, 4, 3, 1),
+    integer_field("Installed Size 2", 0x17, 4, 3, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 8: Port Connector Information (names are in PortConnectionEntry)
+
+constexpr FieldSchema port_connector_fields[] = {
+    string_field("Internal Reference Designator", 0x04),
+    integer_field("Internal Connector Type", 0x05, 1),
+    string_field("External Reference Designator", 0x06),
+    integer_field("External Connector Type", 0x07, 1),
+    integer_field("Port Type", 0x08, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 9: System Slots
+
+constexpr FieldName slot_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "ISA" }, { 0x04, "MCA" }, { 0x05, "EISA" },
+    { 0x06, "PCI" }, { 0x07, "PC Card (PCMCIA)" }, { 0x08, "VLB" }, { 0x09, "Proprietary" },
+    { 0x0A, "Processor Card" }, { 0x0B, "Proprietary Memory Card" }, { 0x0C, "I/O Riser Card" },
+    { 0x0D, "NuBus" }, { 0x0E, "PCI-66" }, { 0x0F, "AGP" }, { 0x10, "AGP 2x" }, { 0x11, "AGP 4x" },
+    { 0x12, "PCI-X" }, { 0x13, "AGP 8x" }, { 0x14, "M.2 Socket 1-DP" }, { 0x15, "M.2 Socket 1-SD" },
+    { 0x16, "M.2 Socket 2" }, { 0x17, "M.2 Socket 3" }, { 0x18, "MXM Type I" }, { 0x19, "MXM Type II" },
+    { 0x1A, "MXM Type III" }, { 0x1B, "MXM Type III-HE" }, { 0x1C, "MXM Type IV" },
+    { 0x1D, "MXM 3.0 Type A" }, { 0x1E, "MXM 3.0 Type B" }, { 0x1F, "PCI Express 2 SFF-8639 (U.2)" },
+    { 0x20, "PCI Express 3 SFF-8639 (U.2)" }, { 0x21, "PCI Express Mini 52-pin with bottom-side keep-outs" },
+    { 0x22, "PCI Express Mini 52-pin without bottom-side keep-outs" }, { 0x23, "PCI Express Mini 76-pin" },
+    { 0xA5, "PCI Express" }, { 0xA6, "PCI Express x1" }, { 0xA7, "PCI Express x2" },
+    { 0xA8, "PCI Express x4" }, { 0xA9, "PCI Express x8" }, { 0xAA, "PCI Express x16" },
+    { 0xAB, "PCI Express 2" }, { 0xAC, "PCI Express 2 x1" }, { 0xAD, "PCI Express 2 x2" },
+    { 0xAE, "PCI Express 2 x4" }, { 0xAF, "PCI Express 2 x8" }, { 0xB0, "PCI Express 2 x16" },
+    { 0xB1, "PCI Express 3" }, { 0xB2, "PCI Express 3 x1" }, { 0xB3, "PCI Express 3 x2" },
+    { 0xB4, "PCI Express 3 x4" }, { 0xB5, "PCI Express 3 x8" }, { 0xB6, "PCI Express 3 x16" },
+    { 0xB8, "PCI Express 4" }, { 0xB9, "PCI Express 4 x1" }, { 0xBA, "PCI Express 4 x2" },
+    { 0xBB, "PCI Express 4 x4" }, { 0xBC, "PCI Express 4 x8" }, { 0xBD, "PCI Express 4 x16" }
+};
+
+constexpr FieldName slot_bus_width_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "8 bit" }, { 0x04, "16 bit" }, { 0x05, "32 bit" },
+    { 0x06, "64 bit" }, { 0x07, "128 bit" }, { 0x08, "x1" }, { 0x09, "x2" }, { 0x0A, "x4" },
+    { 0x0B, "x8" }, { 0x0C, "x12" }, { 0x0D, "x16" }, { 0x0E, "x32" }
+};
+
+constexpr FieldName slot_usage_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Available" }, { 0x04, "In Use" }, { 0x05, "Unavailable" }
+};
+
+constexpr FieldName slot_length_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Short" }, { 0x04, "Long" },
+    { 0x05, "2.5\" drive form factor" }, { 0x06, "3.5\" drive form factor" }
+};
+
+constexpr FieldName slot_characteristics1_names[] = {
+    { 0, "Unknown" }, { 1, "5.0 V is provided" }, { 2, "3.3 V is provided" }, { 3, "Opening is shared" },
+    { 4, "PC Card-16 is supported" }, { 5, "Cardbus is supported" }, { 6, "Zoom Video is supported" },
+    { 7, "Modem ring resume is supported" }
+};
+
+constexpr FieldName slot_characteristics2_names[] = {
+    { 0, "PME signal is supported" }, { 1, "Hot-plug devices are supported" },
+    { 2, "SMBus signal is supported" }, { 3, "PCIe slot bifurcation is supported" },
+    { 4, "Async/surprise removal is supported" }, { 5, "Flexbus slot, CXL 1.0 capable" },
+    { 6, "Flexbus slot, CXL 2.0 capable" }
+};
+
+constexpr FieldSchema system_slots_fields[] = {
+    string_field("Designation", 0x04),
+    enum_field("Type", 0x05, 1, slot_type_names),
+    enum_field("Data Bus Width", 0x06, 1, slot_bus_width_names),
+    enum_field("Current Usage", 0x07, 1, slot_usage_names),
+    enum_field("Length", 0x08, 1, slot_length_names),
+    integer_field("ID", 0x09, 2),
+    bitfield_field("Characteristics", 0x0B, 1, slot_characteristics1_names),
+    bitfield_field("Characteristics 2", 0x0C, 1, slot_characteristics2_names, 2, 1),
+    integer_field("Segment Group Number", 0x0D, 2, 2, 6),
+    integer_field("Bus Number", 0x0F, 1, 2, 6),
+    integer_field("Device/Function Number", 0x10, 1, 2, 6),
+    integer_field("Data Bus Width Base", 0x11, 1, 3, 2),
+    integer_field("Peer Grouping Count", 0x12, 1, 3, 2)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 10: On Board Devices Information (obsolete), the first device only
+
+constexpr FieldName onboard_device_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Video" }, { 0x04, "SCSI Controller" },
+    { 0x05, "Ethernet" }, { 0x06, "Token Ring" }, { 0x07, "Sound" }, { 0x08, "PATA Controller" },
+    { 0x09, "SATA Controller" }, { 0x0A, "SAS Controller" }, { 0x0B, "Wireless LAN" },
+    { 0x0C, "Bluetooth" }, { 0x0D, "WWAN" }, { 0x0E, "eMMC" }, { 0x0F, "NVMe Controller" },
+    { 0x10, "UFS Controller" }
+};
+
+constexpr FieldSchema onboard_devices_fields[] = {
+    enum_field("Type", 0x04, 1, onboard_device_type_names, 2, 0, 7),
+    string_field("Description", 0x05)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 11, 12: OEM Strings, System Configuration Options
+
+constexpr FieldSchema oem_strings_fields[] = {
+    integer_field("Count", 0x04, 1)
+};
+
+constexpr FieldSchema system_configuration_options_fields[] = {
+    integer_field("Count", 0x04, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 13: BIOS Language Information
+
+constexpr FieldName bios_language_flags_names[] = {
+    { 0, "Abbreviated format" }
+};
+
+constexpr FieldSchema bios_language_fields[] = {
+    integer_field("Installable Languages", 0x04, 1),
+    bitfield_field("Flags", 0x05, 1, bios_language_flags_names, 2, 1),
+    string_field("Currently Installed Language", 0x15)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 14: Group Associations, the first item only
+
+constexpr FieldSchema group_associations_fields[] = {
+    string_field("Name", 0x04),
+    integer_field("Item Type", 0x05, 1),
+    handle_field("Item Handle", 0x06)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 15: System Event Log
+
+constexpr FieldName event_log_access_names[] = {
+    { 0x00, "Indexed I/O, one 8-bit index port, one 8-bit data port" },
+    { 0x01, "Indexed I/O, two 8-bit index ports, one 8-bit data port" },
+    { 0x02, "Indexed I/O, one 16-bit index port, one 8-bit data port" },
+    { 0x03, "Memory-mapped physical 32-bit address" },
+    { 0x04, "General-purpose non-volatile data functions" }
+};
+
+constexpr FieldName event_log_status_names[] = {
+    { 0, "Log area valid" }, { 1, "Log area full" }
+};
+
+constexpr FieldSchema system_event_log_fields[] = {
+    integer_field("Area Length", 0x04, 2),
+    integer_field("Header Start Offset", 0x06, 2),
+    integer_field("Data Start Offset", 0x08, 2),
+    enum_field("Access Method", 0x0A, 1, event_log_access_names),
+    bitfield_field("Status", 0x0B, 1, event_log_status_names),
+    integer_field("Change Token", 0x0C, 4),
+    integer_field("Access Address", 0x10, 4),
+    integer_field("Header Format", 0x14, 1, 2, 1),
+    integer_field("Supported Log Type Descriptors", 0x15, 1, 2, 1),
+    integer_field("Log Type Descriptor Length", 0x16, 1, 2, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 16: Physical Memory Array
+
+constexpr FieldName memory_array_location_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "System Board Or Motherboard" },
+    { 0x04, "ISA Add-on Card" }, { 0x05, "EISA Add-on Card" }, { 0x06, "PCI Add-on Card" },
+    { 0x07, "MCA Add-on Card" }, { 0x08, "PCMCIA Add-on Card" }, { 0x09, "Proprietary Add-on Card" },
+    { 0x0A, "NuBus" }, { 0xA0, "PC-98/C20 Add-on Card" }, { 0xA1, "PC-98/C24 Add-on Card" },
+    { 0xA2, "PC-98/E Add-on Card" }, { 0xA3, "PC-98/Local Bus Add-on Card" }, { 0xA4, "CXL Add-on Card" }
+};
+
+constexpr FieldName memory_array_use_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "System Memory" }, { 0x04, "Video Memory" },
+    { 0x05, "Flash Memory" }, { 0x06, "Non-volatile RAM" }, { 0x07, "Cache Memory" }
+};
+
+constexpr FieldSchema physical_memory_array_fields[] = {
+    enum_field("Location", 0x04, 1, memory_array_location_names),
+    enum_field("Use", 0x05, 1, memory_array_use_names),
+    enum_field("Error Correction Type", 0x06, 1, error_correction_names),
+    integer_field("Maximum Capacity", 0x07, 4),
+    handle_field("Error Information Handle", 0x0B),
+    integer_field("Number Of Devices", 0x0D, 2),
+    integer_field("Extended Maximum Capacity", 0x0F, 8, 2, 7)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 17: Memory Device
+
+constexpr FieldName memory_form_factor_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "SIMM" }, { 0x04, "SIP" }, { 0x05, "Chip" },
+    { 0x06, "DIP" }, { 0x07, "ZIP" }, { 0x08, "Proprietary Card" }, { 0x09, "DIMM" }, { 0x0A, "TSOP" },
+    { 0x0B, "Row Of Chips" }, { 0x0C, "RIMM" }, { 0x0D, "SODIMM" }, { 0x0E, "SRIMM" }, { 0x0F, "FB-DIMM" },
+    { 0x10, "Die" }
+};
+
+constexpr FieldName memory_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "DRAM" }, { 0x04, "EDRAM" }, { 0x05, "VRAM" },
+    { 0x06, "SRAM" }, { 0x07, "RAM" }, { 0x08, "ROM" }, { 0x09, "Flash" }, { 0x0A, "EEPROM" },
+    { 0x0B, "FEPROM" }, { 0x0C, "EPROM" }, { 0x0D, "CDRAM" }, { 0x0E, "3DRAM" }, { 0x0F, "SDRAM" },
+    { 0x10, "SGRAM" }, { 0x11, "RDRAM" }, { 0x12, "DDR" }, { 0x13, "DDR2" }, { 0x14, "DDR2 FB-DIMM" },
+    { 0x18, "DDR3" }, { 0x19, "FBD2" }, { 0x1A, "DDR4" }, { 0x1B, "LPDDR" }, { 0x1C, "LPDDR2" },
+    { 0x1D, "LPDDR3" }, { 0x1E, "LPDDR4" }, { 0x1F, "Logical non-volatile device" }, { 0x20, "HBM" },
+    { 0x21, "HBM2" }, { 0x22, "DDR5" }, { 0x23, "LPDDR5" }, { 0x24, "HBM3" }
+};
+
+constexpr FieldName memory_type_detail_names[] = {
+    { 1, "Other" }, { 2, "Unknown" }, { 3, "Fast-paged" }, { 4, "Static Column" }, { 5, "Pseudo-static" },
+    { 6, "RAMBus" }, { 7, "Synchronous" }, { 8, "CMOS" }, { 9, "EDO" }, { 10, "Window DRAM" },
+    { 11, "Cache DRAM" }, { 12, "Non-Volatile" }, { 13, "Registered (Buffered)" },
+    { 14, "Unbuffered (Unregistered)" }, { 15, "LRDIMM" }
+};
+
+constexpr FieldName memory_technology_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "DRAM" }, { 0x04, "NVDIMM-N" }, { 0x05, "NVDIMM-F" },
+    { 0x06, "NVDIMM-P" }, { 0x07, "Intel Optane persistent memory" }
+};
+
+constexpr FieldName memory_operating_mode_names[] = {
+    { 1, "Other" }, { 2, "Unknown" }, { 3, "Volatile memory" }, { 4, "Byte-accessible persistent memory" },
+    { 5, "Block-accessible persistent memory" }
+};
+
+constexpr FieldSchema memory_device_fields[] = {
+    handle_field("Array Handle", 0x04, 2, 1),
+    handle_field("Error Information Handle", 0x06, 2, 1),
+    integer_field("Total Width", 0x08, 2, 2, 1),
+    integer_field("Data Width", 0x0A, 2, 2, 1),
+    integer_field("Size", 0x0C, 2, 2, 1),
+    enum_field("Form Factor", 0x0E, 1, memory_form_factor_names, 2, 1),
+    integer_field("Set", 0x0F, 1, 2, 1),
+    string_field("Locator", 0x10, 2, 1),
+    string_field("Bank Locator", 0x11, 2, 1),
+    enum_field("Type", 0x12, 1, memory_type_names, 2, 1),
+    bitfield_field("Type Detail", 0x13, 2, memory_type_detail_names, 2, 1),
+    integer_field("Speed", 0x15, 2, 2, 3),
+    string_field("Manufacturer", 0x17, 2, 3),
+    string_field("Serial Number", 0x18, 2, 3),
+    string_field("Asset Tag", 0x19, 2, 3),
+    string_field("Part Number", 0x1A, 2, 3),
+    integer_field("Rank", 0x1B, 1, 2, 6),
+    integer_field("Extended Size", 0x1C, 4, 2, 7),
+    integer_field("Configured Memory Speed", 0x20, 2, 2, 7),
+    integer_field("Minimum Voltage", 0x22, 2, 2, 8),
+    integer_field("Maximum Voltage", 0x24, 2, 2, 8),
+    integer_field("Configured Voltage", 0x26, 2, 2, 8),
+    enum_field("Memory Technology", 0x28, 1, memory_technology_names, 3, 2),
+    bitfield_field("Operating Mode Capability", 0x29, 2, memory_operating_mode_names, 3, 2),
+    string_field("Firmware Version", 0x2B, 3, 2),
+    integer_field("Module Manufacturer ID", 0x2C, 2, 3, 2),
+    integer_field("Module Product ID", 0x2E, 2, 3, 2),
+    integer_field("Subsystem Controller Manufacturer ID", 0x30, 2, 3, 2),
+    integer_field("Subsystem Controller Product ID", 0x32, 2, 3, 2),
+    integer_field("Non-volatile Size", 0x34, 8, 3, 2),
+    integer_field("Volatile Size", 0x3C, 8, 3, 2),
+    integer_field("Cache Size", 0x44, 8, 3, 2),
+    integer_field("Logical Size", 0x4C, 8, 3, 2),
+    integer_field("Extended Speed", 0x54, 4, 3, 3),
+    integer_field("Extended Configured Memory Speed", 0x58, 4, 3, 3)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 18, 33: 32-bit and 64-bit Memory Error Information
+
+constexpr FieldName memory_error_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "OK" }, { 0x04, "Bad Read" }, { 0x05, "Parity Error" },
+    { 0x06, "Single-bit Error" }, { 0x07, "Double-bit Error" }, { 0x08, "Multi-bit Error" },
+    { 0x09, "Nibble Error" }, { 0x0A, "Checksum Error" }, { 0x0B, "CRC Error" },
+    { 0x0C, "Corrected Single-bit Error" }, { 0x0D, "Corrected Error" }, { 0x0E, "Uncorrectable Error" }
+};
+
+constexpr FieldName memory_error_granularity_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Device Level" }, { 0x04, "Memory Partition Level" }
+};
+
+constexpr FieldName memory_error_operation_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Read" }, { 0x04, "Write" }, { 0x05, "Partial Write" }
+};
+
+constexpr FieldSchema memory_error32_fields[] = {
+    enum_field("Type", 0x04, 1, memory_error_type_names),
+    enum_field("Granularity", 0x05, 1, memory_error_granularity_names),
+    enum_field("Operation", 0x06, 1, memory_error_operation_names),
+    integer_field("Vendor Syndrome", 0x07, 4),
+    integer_field("Memory Array Address", 0x0B, 4),
+    integer_field("Device Address", 0x0F, 4),
+    integer_field("Resolution", 0x13, 4)
+};
+
+constexpr FieldSchema memory_error64_fields[] = {
+    enum_field("Type", 0x04, 1, memory_error_type_names),
+    enum_field("Granularity", 0x05, 1, memory_error_granularity_names),
+    enum_field("Operation", 0x06, 1, memory_error_operation_names),
+    integer_field("Vendor Syndrome", 0x07, 4),
+    integer_field("Memory Array Address", 0x0B, 8),
+    integer_field("Device Address", 0x13, 8),
+    integer_field("Resolution", 0x1B, 4)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 19, 20: Memory Array Mapped Address, Memory Device Mapped Address
+
+constexpr FieldSchema memory_array_mapped_address_fields[] = {
+    integer_field("Starting Address", 0x04, 4),
+    integer_field("Ending Address", 0x08, 4),
+    handle_field("Physical Array Handle", 0x0C),
+    integer_field("Partition Width", 0x0E, 1),
+    integer_field("Extended Starting Address", 0x0F, 8, 2, 7),
+    integer_field("Extended Ending Address", 0x17, 8, 2, 7)
+};
+
+constexpr FieldSchema memory_device_mapped_address_fields[] = {
+    integer_field("Starting Address", 0x04, 4),
+    integer_field("Ending Address", 0x08, 4),
+    handle_field("Physical Device Handle", 0x0C),
+    handle_field("Memory Array Mapped Address Handle", 0x0E),
+    integer_field("Partition Row Position", 0x10, 1),
+    integer_field("Interleave Position", 0x11, 1),
+    integer_field("Interleaved Data Depth", 0x12, 1),
+    integer_field("Extended Starting Address", 0x13, 8, 2, 7),
+    integer_field("Extended Ending Address", 0x1B, 8, 2, 7)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 21: Built-in Pointing Device
+
+constexpr FieldName pointing_device_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Mouse" }, { 0x04, "Track Ball" }, { 0x05, "Track Point" },
+    { 0x06, "Glide Point" }, { 0x07, "Touch Pad" }, { 0x08, "Touch Screen" }, { 0x09, "Optical Sensor" }
+};
+
+constexpr FieldName pointing_device_interface_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Serial" }, { 0x04, "PS/2" }, { 0x05, "Infrared" },
+    { 0x06, "HIP-HIL" }, { 0x07, "Bus Mouse" }, { 0x08, "ADB (Apple Desktop Bus)" },
+    { 0xA0, "Bus Mouse DB-9" }, { 0xA1, "Bus Mouse Micro DIN" }, { 0xA2, "USB" }, { 0xA3, "I2C" },
+    { 0xA4, "SPI" }
+};
+
+constexpr FieldSchema pointing_device_fields[] = {
+    enum_field("Type", 0x04, 1, pointing_device_type_names),
+    enum_field("Interface", 0x05, 1, pointing_device_interface_names),
+    integer_field("Buttons", 0x06, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 22: Portable Battery
+
+constexpr FieldName battery_chemistry_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Lead Acid" }, { 0x04, "Nickel Cadmium" },
+    { 0x05, "Nickel Metal Hydride" }, { 0x06, "Lithium Ion" }, { 0x07, "Zinc Air" },
+    { 0x08, "Lithium Polymer" }
+};
+
+constexpr FieldSchema portable_battery_fields[] = {
+    string_field("Location", 0x04),
+    string_field("Manufacturer", 0x05),
+    string_field("Manufacture Date", 0x06),
+    string_field("Serial Number", 0x07),
+    string_field("Name", 0x08),
+    enum_field("Chemistry", 0x09, 1, battery_chemistry_names),
+    integer_field("Design Capacity", 0x0A, 2),
+    integer_field("Design Voltage", 0x0C, 2),
+    string_field("SBDS Version", 0x0E),
+    integer_field("Maximum Error", 0x0F, 1),
+    integer_field("SBDS Serial Number", 0x10, 2, 2, 2),
+    integer_field("SBDS Manufacture Date", 0x12, 2, 2, 2),
+    string_field("SBDS Chemistry", 0x14, 2, 2),
+    integer_field("Design Capacity Multiplier", 0x15, 1, 2, 2),
+    integer_field("OEM-specific Information", 0x16, 4, 2, 2)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 23, 24, 25: System Reset, Hardware Security, System Power Controls
+
+constexpr FieldSchema system_reset_fields[] = {
+    integer_field("Capabilities", 0x04, 1),
+    integer_field("Reset Count", 0x05, 2),
+    integer_field("Reset Limit", 0x07, 2),
+    integer_field("Timer Interval", 0x09, 2),
+    integer_field("Timeout", 0x0B, 2)
+};
+
+constexpr FieldSchema hardware_security_fields[] = {
+    integer_field("Settings", 0x04, 1)
+};
+
+constexpr FieldSchema system_power_controls_fields[] = {
+    integer_field("Next Scheduled Power-on Month", 0x04, 1),
+    integer_field("Next Scheduled Power-on Day", 0x05, 1),
+    integer_field("Next Scheduled Power-on Hour", 0x06, 1),
+    integer_field("Next Scheduled Power-on Minute", 0x07, 1),
+    integer_field("Next Scheduled Power-on Second", 0x08, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 26, 28, 29: Voltage, Temperature and Electrical Current Probes share the layout
+
+constexpr FieldSchema probe_fields[] = {
+    string_field("Description", 0x04),
+    integer_field("Location And Status", 0x05, 1),
+    integer_field("Maximum Value", 0x06, 2),
+    integer_field("Minimum Value", 0x08, 2),
+    integer_field("Resolution", 0x0A, 2),
+    integer_field("Tolerance", 0x0C, 2),
+    integer_field("Accuracy", 0x0E, 2),
+    integer_field("OEM-specific Information", 0x10, 4),
+    integer_field("Nominal Value", 0x14, 2)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 27: Cooling Device
+
+constexpr FieldSchema cooling_device_fields[] = {
+    handle_field("Temperature Probe Handle", 0x04),
+    integer_field("Type And Status", 0x06, 1),
+    integer_field("Cooling Unit Group", 0x07, 1),
+    integer_field("OEM-specific Information", 0x08, 4),
+    integer_field("Nominal Speed", 0x0C, 2),
+    string_field("Description", 0x0E, 2, 7)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 30, 31, 32: Out-of-Band Remote Access, Boot Integrity Services, System Boot
+
+constexpr FieldName remote_access_connections_names[] = {
+    { 0, "Inbound connection enabled" }, { 1, "Outbound connection enabled" }
+};
+
+constexpr FieldSchema remote_access_fields[] = {
+    string_field("Manufacturer", 0x04),
+    bitfield_field("Connections", 0x05, 1, remote_access_connections_names)
+};
+
+constexpr FieldSchema boot_integrity_services_fields[] = {
+    integer_field("Checksum", 0x04, 1),
+    integer_field("16-bit Entry Point Address", 0x08, 4),
+    integer_field("32-bit Entry Point Address", 0x0C, 4)
+};
+
+constexpr FieldName boot_status_names[] = {
+    { 0x00, "No errors detected" }, { 0x01, "No bootable media" },
+    { 0x02, "Operating system failed to load" }, { 0x03, "Firmware-detected hardware failure" },
+    { 0x04, "Operating system-detected hardware failure" }, { 0x05, "User-requested boot" },
+    { 0x06, "System security violation" }, { 0x07, "Previously-requested image" },
+    { 0x08, "System watchdog timer expired" }
+};
+
+constexpr FieldSchema system_boot_fields[] = {
+    enum_field("Status", 0x0A, 1, boot_status_names)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 34, 35, 36: Management Device, its Component and Threshold Data
+
+constexpr FieldName management_device_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "LM75" }, { 0x04, "LM78" }, { 0x05, "LM79" },
+    { 0x06, "LM80" }, { 0x07, "LM81" }, { 0x08, "ADM9240" }, { 0x09, "DS1780" }, { 0x0A, "MAX1617" },
+    { 0x0B, "GL518SM" }, { 0x0C, "W83781D" }, { 0x0D, "HT82H791" }
+};
+
+constexpr FieldName management_address_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "I/O Port" }, { 0x04, "Memory" }, { 0x05, "SMBus" }
+};
+
+constexpr FieldSchema management_device_fields[] = {
+    string_field("Description", 0x04),
+    enum_field("Type", 0x05, 1, management_device_type_names),
+    integer_field("Address", 0x06, 4),
+    enum_field("Address Type", 0x0A, 1, management_address_type_names)
+};
+
+constexpr FieldSchema management_device_component_fields[] = {
+    string_field("Description", 0x04),
+    handle_field("Management Device Handle", 0x05),
+    handle_field("Component Handle", 0x07),
+    handle_field("Threshold Handle", 0x09)
+};
+
+constexpr FieldSchema management_device_threshold_fields[] = {
+    integer_field("Lower Non-critical Threshold", 0x04, 2),
+    integer_field("Upper Non-critical Threshold", 0x06, 2),
+    integer_field("Lower Critical Threshold", 0x08, 2),
+    integer_field("Upper Critical Threshold", 0x0A, 2),
+    integer_field("Lower Non-recoverable Threshold", 0x0C, 2),
+    integer_field("Upper Non-recoverable Threshold", 0x0E, 2)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 37: Memory Channel, the first device only
+
+constexpr FieldName memory_channel_type_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "RamBus" }, { 0x04, "SyncLink" }
+};
+
+constexpr FieldSchema memory_channel_fields[] = {
+    enum_field("Type", 0x04, 1, memory_channel_type_names),
+    integer_field("Maximal Load", 0x05, 1),
+    integer_field("Devices", 0x06, 1),
+    integer_field("Device Load", 0x07, 1),
+    handle_field("Device Handle", 0x08)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 38: IPMI Device Information
+
+constexpr FieldName ipmi_interface_names[] = {
+    { 0x00, "Unknown" }, { 0x01, "KCS (Keyboard Control Style)" },
+    { 0x02, "SMIC (Server Management Interface Chip)" }, { 0x03, "BT (Block Transfer)" },
+    { 0x04, "SSIF (SMBus System Interface)" }
+};
+
+constexpr FieldSchema ipmi_device_fields[] = {
+    enum_field("Interface Type", 0x04, 1, ipmi_interface_names),
+    integer_field("Specification Version", 0x05, 1),
+    integer_field("I2C Target Address", 0x06, 1),
+    integer_field("NV Storage Device Address", 0x07, 1),
+    integer_field("Base Address", 0x08, 8),
+    integer_field("Base Address Modifier", 0x10, 1),
+    integer_field("Interrupt Number", 0x11, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 39: System Power Supply
+
+constexpr FieldSchema system_power_supply_fields[] = {
+    integer_field("Power Unit Group", 0x04, 1),
+    string_field("Location", 0x05),
+    string_field("Name", 0x06),
+    string_field("Manufacturer", 0x07),
+    string_field("Serial Number", 0x08),
+    string_field("Asset Tag", 0x09),
+    string_field("Model Part Number", 0x0A),
+    string_field("Revision", 0x0B),
+    integer_field("Max Power Capacity", 0x0C, 2),
+    integer_field("Characteristics", 0x0E, 2),
+    handle_field("Input Voltage Probe Handle", 0x10),
+    handle_field("Cooling Device Handle", 0x12),
+    handle_field("Input Current Probe Handle", 0x14)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 40: Additional Information, the first entry only
+
+constexpr FieldSchema additional_information_fields[] = {
+    integer_field("Entries", 0x04, 1),
+    integer_field("Entry Length", 0x05, 1),
+    handle_field("Referenced Handle", 0x06),
+    integer_field("Referenced Offset", 0x08, 1),
+    string_field("String", 0x09)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 41: Onboard Devices Extended Information
+
+constexpr FieldSchema onboard_devices_extended_fields[] = {
+    string_field("Reference Designation", 0x04),
+    enum_field("Type", 0x05, 1, onboard_device_type_names, 2, 0, 7),
+    integer_field("Type Instance", 0x06, 1),
+    integer_field("Segment Group Number", 0x07, 2),
+    integer_field("Bus Number", 0x09, 1),
+    integer_field("Device/Function Number", 0x0A, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 42: Management Controller Host Interface
+
+constexpr FieldName host_interface_type_names[] = {
+    { 0x02, "KCS: Keyboard Controller Style" }, { 0x03, "8250 UART Register Compatible" },
+    { 0x04, "16450 UART Register Compatible" }, { 0x05, "16550/16550A UART Register Compatible" },
+    { 0x06, "16650/16650A UART Register Compatible" }, { 0x07, "16750/16750A UART Register Compatible" },
+    { 0x08, "16850/16850A UART Register Compatible" }, { 0x40, "Network" }, { 0xF0, "OEM" }
+};
+
+constexpr FieldSchema management_host_interface_fields[] = {
+    enum_field("Interface Type", 0x04, 1, host_interface_type_names),
+    integer_field("Interface Type Specific Data Length", 0x05, 1)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 43: TPM Device
+
+constexpr FieldName tpm_characteristics_names[] = {
+    { 2, "TPM Device characteristics not supported" }, { 3, "Family configurable via firmware update" },
+    { 4, "Family configurable via platform software support" },
+    { 5, "Family configurable via OEM proprietary mechanism" }
+};
+
+constexpr FieldSchema tpm_device_fields[] = {
+    bytes_field("Vendor ID", 0x04, 4),
+    integer_field("Major Spec Version", 0x08, 1),
+    integer_field("Minor Spec Version", 0x09, 1),
+    integer_field("Firmware Version 1", 0x0A, 4),
+    integer_field("Firmware Version 2", 0x0E, 4),
+    string_field("Description", 0x12),
+    bitfield_field("Characteristics", 0x13, 8, tpm_characteristics_names),
+    integer_field("OEM-specific Information", 0x1B, 4)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Type 44: Processor Additional Information
+
+constexpr FieldName processor_architecture_names[] = {
+    { 0x01, "IA32 (x86)" }, { 0x02, "x64 (x86-64, Intel64, AMD64, EM64T)" },
+    { 0x03, "Intel Itanium architecture" }, { 0x04, "32-bit ARM (Aarch32)" },
+    { 0x05, "64-bit ARM (Aarch64)" }, { 0x06, "32-bit RISC-V (RV32)" }, { 0x07, "64-bit RISC-V (RV64)" },
+    { 0x08, "128-bit RISC-V (RV128)" }, { 0x09, "32-bit LoongArch" }, { 0x0A, "64-bit LoongArch" }
+};
+
+constexpr FieldSchema processor_additional_fields[] = {
+    handle_field("Referenced Handle", 0x04),
+    integer_field("Block Length", 0x06, 1),
+    enum_field("Processor Type", 0x07, 1, processor_architecture_names)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Types 45, 46: Firmware Inventory Information, String Property
+
+constexpr FieldName firmware_state_names[] = {
+    { 0x01, "Other" }, { 0x02, "Unknown" }, { 0x03, "Disabled" }, { 0x04, "Enabled" }, { 0x05, "Absent" },
+    { 0x06, "Standby Offline" }, { 0x07, "Standby Spare" }, { 0x08, "Unavailable Offline" }
+};
+
+constexpr FieldName firmware_characteristics_names[] = {
+    { 0, "Updatable" }, { 1, "Write-Protect" }
+};
+
+constexpr FieldSchema firmware_inventory_fields[] = {
+    string_field("Component Name", 0x04),
+    string_field("Version", 0x05),
+    integer_field("Version Format", 0x06, 1),
+    string_field("ID", 0x07),
+    integer_field("ID Format", 0x08, 1),
+    string_field("Release Date", 0x09),
+    string_field("Manufacturer", 0x0A),
+    string_field("Lowest Supported Version", 0x0B),
+    integer_field("Image Size", 0x0C, 8),
+    bitfield_field("Characteristics", 0x14, 2, firmware_characteristics_names),
+    enum_field("State", 0x16, 1, firmware_state_names),
+    integer_field("Associated Components", 0x17, 1)
+};
+
+constexpr FieldName string_property_id_names[] = {
+    { 0x0001, "UEFI device path" }
+};
+
+constexpr FieldSchema string_property_fields[] = {
+    enum_field("Property ID", 0x04, 2, string_property_id_names),
+    string_field("Property Value", 0x06),
+    handle_field("Parent Handle", 0x07)
+};
+
+//////////////////////////////////////////////////////////////////////////
+// All standard structures, index is the structure type
+
+constexpr StructureSchema structure_schemas[] = {
+    structure_schema(0, "BIOS Information", bios_information_fields),
+    structure_schema(1, "System Information", system_information_fields),
+    structure_schema(2, "Baseboard Information", baseboard_information_fields),
+    structure_schema(3, "Chassis Information", chassis_fields),
+    structure_schema(4, "Processor Information", processor_fields),
+    structure_schema(5, "Memory Controller Information", memory_controller_fields),
+    structure_schema(6, "Memory Module Information", memory_module_fields),
+    structure_schema(7, "Cache Information", cache_fields),
+    structure_schema(8, "Port Connector Information", port_connector_fields),
+    structure_schema(9, "System Slot Information", system_slots_fields),
+    structure_schema(10, "On Board Device Information", onboard_devices_fields),
+    structure_schema(11, "OEM Strings", oem_strings_fields),
+    structure_schema(12, "System Configuration Options", system_configuration_options_fields),
+    structure_schema(13, "BIOS Language Information", bios_language_fields),
+    structure_schema(14, "Group Associations", group_associations_fields),
+    structure_schema(15, "System Event Log", system_event_log_fields),
+    structure_schema(16, "Physical Memory Array", physical_memory_array_fields),
+    structure_schema(17, "Memory Device", memory_device_fields),
+    structure_schema(18, "32-bit Memory Error Information", memory_error32_fields),
+    structure_schema(19, "Memory Array Mapped Address", memory_array_mapped_address_fields),
+    structure_schema(20, "Memory Device Mapped Address", memory_device_mapped_address_fields),
+    structure_schema(21, "Built-in Pointing Device", pointing_device_fields),
+    structure_schema(22, "Portable Battery", portable_battery_fields),
+    structure_schema(23, "System Reset", system_reset_fields),
+    structure_schema(24, "Hardware Security", hardware_security_fields),
+    structure_schema(25, "System Power Controls", system_power_controls_fields),
+    structure_schema(26, "Voltage Probe", probe_fields),
+    structure_schema(27, "Cooling Device", cooling_device_fields),
+    structure_schema(28, "Temperature Probe", probe_fields),
+    structure_schema(29, "Electrical Current Probe", probe_fields),
+    structure_schema(30, "Out-of-band Remote Access", remote_access_fields),
+    structure_schema(31, "Boot Integrity Services Entry Point", boot_integrity_services_fields),
+    structure_schema(32, "System Boot Information", system_boot_fields),
+    structure_schema(33, "64-bit Memory Error Information", memory_error64_fields),
+    structure_schema(34, "Management Device", management_device_fields),
+    structure_schema(35, "Management Device Component", management_device_component_fields),
+    structure_schema(36, "Management Device Threshold Data", management_device_threshold_fields),
+    structure_schema(37, "Memory Channel", memory_channel_fields),
+    structure_schema(38, "IPMI Device Information", ipmi_device_fields),
+    structure_schema(39, "System Power Supply", system_power_supply_fields),
+    structure_schema(40, "Additional Information", additional_information_fields),
+    structure_schema(41, "Onboard Device", onboard_devices_extended_fields),
+    structure_schema(42, "Management Controller Host Interface", management_host_interface_fields),
+    structure_schema(43, "TPM Device", tpm_device_fields),
+    structure_schema(44, "Processor Additional Information", processor_additional_fields),
+    structure_schema(45, "Firmware Inventory Information", firmware_inventory_fields),
+    structure_schema(46, "String Property", string_property_fields)
+};
+
+/// Every schema should be placed at its own type index
+constexpr bool schemas_indexed_by_type()
+{
+    for (size_t i = 0; i < sizeof(structure_schemas) / sizeof(structure_schemas[0]); ++i) {
+        if (structure_schemas[i].type != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(schemas_indexed_by_type(), "Structure schemas should be ordered by type");
+
+} // namespace
+
+const StructureSchema* smbios::find_structure_schema(uint8_t type)
+{
+    if (type >= sizeof(structure_schemas) / sizeof(structure_schemas[0])) {
+        return nullptr;
+    }
+    return &structure_schemas[type];
+}
+
+const FieldSchema* smbios::find_field_schema(const StructureSchema& schema, uint8_t offset)
+{
+    const FieldSchema* const fields_end = schema.fields + schema.fields_count;
+    const FieldSchema* it = std::find_if(schema.fields, fields_end,
+        [offset](const FieldSchema& field) { return field.offset == offset; });
+    return it != fields_end ? it : nullptr;
+}
+
+const char* smbios::find_field_name(const FieldSchema& field, uint16_t value)
+{
+    const FieldName* names_end = field.names + field.names_count;
+    const FieldName* it = std::find_if(field.names, names_end,
+        [value](const FieldName& name) { return name.value == value; });
+    return it != names_end ? it->name : nullptr;
+}
+
+DmiStrings::const_iterator::const_iterator(const char* current, const char* limit) : limit_(limit)
+{
+    load(current);
+}
+
+DmiStrings::const_iterator& DmiStrings::const_iterator::operator++()
+{
+    load(string_.data() + string_.size() + 1);
+    return *this;
+}
+
+void DmiStrings::const_iterator::load(const char* current)
+{
+    // string section ends with \0\0, empty section is \0\0 as well
+    string_ = boost::string_view();
+    if (nullptr == current || (limit_ && current >= limit_) || 0 == *current) {
+        return;
+    }
+    if (nullptr == limit_) {
+        string_ = boost::string_view(current, std::strlen(current));
+        return;
+    }
+    const void* terminator = std::memchr(current, 0, static_cast<size_t>(limit_ - current));
+    if (terminator) {
+        string_ = boost::string_view(current, static_cast<const char*>(terminator) - current);
+    }
+}
+
+boost::string_view smbios::find_dmi_string(const uint8_t* structure, uint8_t length, uint8_t string_index,
+    const uint8_t* limit)
+{
+    if (0 == string_index) {
+        return "Not Specified";
+    }
+    if (nullptr == structure) {
+        return "Bad index";
+    }
+
+    size_t index = 1;
+    for (const boost::string_view text : DmiStrings(structure, length, limit)) {
+        if (index == string_index) {
+            return text;
+        }
+        ++index;
+    }
+    return "Bad index";
+}
+
+DecodedField smbios::decode_field(const FieldSchema& field, const DMIHeader& header)
+{
+    DecodedField decoded = { &field, 0, boost::string_view(), nullptr };
+    const uint8_t* field_data = header.data + field.offset;
+
+    if (field.kind == FieldKind::Bytes) {
+        decoded.bytes = field_data;
+        return decoded;
+    }
+
+    decoded.value = load_uint(field_data, field.width);
+    if (field.value_bits) {
+        decoded.value &= (uint64_t(1) << field.value_bits) - 1;
+    }
+
+    switch (field.kind) {
+    case FieldKind::String:
+        decoded.text = find_dmi_string(header.data, header.length, static_cast<uint8_t>(decoded.value));
+        break;
+    case FieldKind::Enum:
+        if (const char* name = find_field_name(field, static_cast<uint16_t>(decoded.value))) {
+            decoded.text = name;
+        }
+        break;
+    default:
+        break;
+    }
+    return decoded;
+}
+
+void smbios::join_bit_names(const DecodedField& decoded, std::string& names)
+{
+    const FieldSchema& field = *decoded.schema;
+    names.clear();
+    for (size_t bit = 0; bit < field.width * 8u; ++bit) {
+        if (decoded.value & (uint64_t(1) << bit)) {
+            if (const char* name = find_field_name(field, static_cast<uint16_t>(bit))) {
+                if (!names.empty()) {
+                    names.push_back('|');
+                }
+                names.append(name);
+            }
+        }
+    }
+}
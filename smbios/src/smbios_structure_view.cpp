@@ -0,0 +1,12 @@
+#include <smbios/smbios_structure_view.h>
+#include <smbios/smbios_schema.h>
+
+using namespace smbios;
+
+static_assert(sizeof(SMBiosStructureView) <= 16, "View should be small enough to be passed in registers");
+static_assert(std::is_trivially_copyable<SMBiosStructureView>::value, "View should be trivially copyable");
+
+boost::string_view SMBiosStructureView::dmi_string(uint8_t string_index) const
+{
+    return find_dmi_string(data_, length_, string_index);
+}
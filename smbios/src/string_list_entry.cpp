@@ -0,0 +1,62 @@
+#include <smbios/string_list_entry.h>
+#include <smbios/smbios.h>
+#include <smbios/smbios_schema.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr SMBiosRevision StringListLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<StringListLayout::Count>(
+    StringListLayout::revisions), "2.0 layout");
+
+StringListEntry::StringListEntry(const DMIHeader& header, const SMBiosVersion& version, uint8_t structure_type,
+    const char* label)
+    : AbstractSMBiosEntry(header), length_(header.length), label_(label)
+{
+    if (header.type != structure_type) {
+        std::stringstream err;
+        err << "Wrong entry type, expected " << label << ", called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, StringListLayout::revisions);
+}
+
+std::string StringListEntry::get_type() const
+{
+    return label_;
+}
+
+void StringListEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    const uint8_t count = get_count();
+    // unsigned index, uint8_t one never exceeds count of 255
+    for (unsigned i = 1; i <= count; ++i) {
+        out << "String " << i << ": " << get_string(static_cast<uint8_t>(i)) << '\n';
+    }
+}
+
+uint8_t StringListEntry::get_count() const
+{
+    return fields_.get<StringListLayout::Count>(0);
+}
+
+boost::string_view StringListEntry::get_string(uint8_t string_index) const
+{
+    return find_dmi_string(fields_.data(), length_, string_index);
+}
+
+std::vector<boost::string_view> StringListEntry::get_strings() const
+{
+    const uint8_t count = get_count();
+    std::vector<boost::string_view> strings;
+    strings.reserve(count);
+    for (unsigned i = 1; i <= count; ++i) {
+        strings.push_back(get_string(static_cast<uint8_t>(i)));
+    }
+    return strings;
+}
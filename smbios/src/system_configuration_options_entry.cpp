@@ -0,0 +1,10 @@
+#include <smbios/system_configuration_options_entry.h>
+
+using namespace smbios;
+
+constexpr uint8_t SystemConfigurationOptionsEntry::structure_type;
+
+SystemConfigurationOptionsEntry::SystemConfigurationOptionsEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : StringListEntry(header, version, structure_type, "System Configuration Options")
+{
+}
@@ -0,0 +1,154 @@
+#include <smbios/system_identity.h>
+#include <smbios/smbios.h>
+#include <smbios/smbios_schema.h>
+#include <smbios/render_buffer.h>
+
+#include <algorithm>
+
+using namespace smbios;
+
+namespace {
+
+// Structure offsets, see SMBIOS specification
+constexpr uint8_t serial_number_offset = 0x07;  // the same for types 1, 2 and 3
+constexpr uint8_t uuid_offset = 0x08;
+constexpr uint8_t uuid_length = 16;
+
+// Since 2.6 the first three UUID fields are stored little-endian
+const SMBiosVersion uuid_little_endian_version = { 2, 6 };
+
+void copy_serial(const uint8_t* structure, uint8_t length, const uint8_t* table_end,
+    char (&serial)[SystemIdentity::max_serial_length + 1])
+{
+    if (length <= serial_number_offset || 0 == structure[serial_number_offset]) {
+        return;
+    }
+
+    // serial is left empty if the structure has fewer strings than the index
+    const uint8_t index = structure[serial_number_offset];
+    uint8_t current = 0;
+    for (const boost::string_view text : DmiStrings(structure, length, table_end)) {
+        if (++current == index) {
+            const size_t copied = std::min(text.size(), SystemIdentity::max_serial_length);
+            std::copy_n(text.data(), copied, serial);
+            serial[copied] = '\0';
+            return;
+        }
+    }
+}
+
+void copy_uuid(const uint8_t* structure, uint8_t length, const SMBiosVersion& version, SystemIdentity& identity)
+{
+    if (length < uuid_offset + uuid_length) {
+        return;
+    }
+
+    const uint8_t* uuid = structure + uuid_offset;
+    std::copy_n(uuid, uuid_length, identity.uuid);
+    normalize_uuid(identity.uuid, version);
+
+    const bool all_zero = std::all_of(uuid, uuid + uuid_length, [](uint8_t byte) { return byte == 0x00; });
+    const bool all_ones = std::all_of(uuid, uuid + uuid_length, [](uint8_t byte) { return byte == 0xFF; });
+    identity.uuid_present = !all_zero && !all_ones;
+}
+
+} // namespace
+
+constexpr size_t SystemIdentity::max_serial_length;
+
+void smbios::normalize_uuid(uint8_t (&uuid)[16], const SMBiosVersion& version)
+{
+    if (!(version < uuid_little_endian_version)) {
+        std::reverse(uuid, uuid + 4);
+        std::reverse(uuid + 4, uuid + 6);
+        std::reverse(uuid + 6, uuid + 8);
+    }
+}
+
+SystemIdentity smbios::read_system_identity(const uint8_t* table, size_t table_size, const SMBiosVersion& version)
+{
+    SystemIdentity identity{};
+    if (nullptr == table) {
+        return identity;
+    }
+
+    const uint8_t* table_end = table + table_size;
+    const uint8_t* structure = table;
+
+    while (!identity.complete() && structure + 4 <= table_end) {
+
+        const uint8_t type = structure[0];
+        const uint8_t length = structure[1];
+        if (length < 4 || structure + length > table_end || type == SMBios::EndOfTable) {
+            break;
+        }
+
+        // the first structure of every type is taken, types are singletons by spec
+        if (type == SMBios::SystemInformation && !identity.system_found) {
+            copy_uuid(structure, length, version, identity);
+            copy_serial(structure, length, table_end, identity.system_serial);
+            identity.system_found = true;
+        }
+        else if (type == SMBios::BaseboardInformation && !identity.baseboard_found) {
+            copy_serial(structure, length, table_end, identity.baseboard_serial);
+            identity.baseboard_found = true;
+        }
+        else if (type == SMBios::SystemEnclosure && !identity.chassis_found) {
+            copy_serial(structure, length, table_end, identity.chassis_serial);
+            identity.chassis_found = true;
+        }
+
+        // skip strings section up to '\0\0'
+        structure += length;
+        while (structure + 1 < table_end && (structure[0] != 0 || structure[1] != 0)) {
+            ++structure;
+        }
+        structure += 2;
+    }
+    return identity;
+}
+
+void smbios::append_uuid(RenderBuffer& out, const uint8_t (&uuid)[16])
+{
+    static const char hex_digits[] = "0123456789ABCDEF";
+
+    char text[36];
+    char* position = text;
+    for (size_t i = 0; i < 16; ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            *position++ = '-';
+        }
+        *position++ = hex_digits[uuid[i] >> 4];
+        *position++ = hex_digits[uuid[i] & 0x0F];
+    }
+    out.append(text, sizeof(text));
+}
+
+std::string smbios::format_uuid(const uint8_t (&uuid)[16])
+{
+    RenderBuffer text(36);
+    append_uuid(text, uuid);
+    return text.str();
+}
+
+void smbios::render_system_identity(const SystemIdentity& identity, RenderBuffer& out)
+{
+    out << "UUID: ";
+    if (identity.uuid_present) {
+        append_uuid(out, identity.uuid);
+    }
+    else {
+        out << "Not Present";
+    }
+    out << '\n';
+    out << "System serial: " << identity.system_serial << '\n';
+    out << "Baseboard serial: " << identity.baseboard_serial << '\n';
+    out << "Chassis serial: " << identity.chassis_serial << '\n';
+}
+
+std::string smbios::render_system_identity(const SystemIdentity& identity)
+{
+    RenderBuffer decsription;
+    render_system_identity(identity, decsription);
+    return decsription.str();
+}
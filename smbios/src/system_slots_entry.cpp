@@ -0,0 +1,100 @@
+#include <smbios/system_slots_entry.h>
+#include <smbios/smbios.h>
+
+#include <sstream>
+
+using namespace smbios;
+
+constexpr uint8_t SystemSlotsEntry::structure_type;
+
+constexpr SMBiosRevision SystemSlotsLayout::revisions[];
+
+// the last field of every revision should fit into it
+static_assert(field_in_revision<SystemSlotsLayout::SlotCharacteristics1>(
+    SystemSlotsLayout::revisions), "2.0 layout");
+static_assert(field_in_revision<SystemSlotsLayout::SlotCharacteristics2>(
+    SystemSlotsLayout::revisions), "2.1 layout");
+static_assert(field_in_revision<SystemSlotsLayout::DeviceFunctionNumber>(
+    SystemSlotsLayout::revisions), "2.6 layout");
+static_assert(field_in_revision<SystemSlotsLayout::PeerGroupingCount>(
+    SystemSlotsLayout::revisions), "3.2 layout");
+
+SystemSlotsEntry::SystemSlotsEntry(const DMIHeader& header, const SMBiosVersion& version)
+    : AbstractSMBiosEntry(header)
+{
+    if (header.type != SMBios::SystemSlots) {
+        std::stringstream err;
+        err << "Wrong entry type, expected System Slots, called Type = " << header.type;
+        throw std::runtime_error(err.str().c_str());
+    }
+
+    fields_ = SMBiosFieldReader(header, version, SystemSlotsLayout::revisions);
+}
+
+std::string SystemSlotsEntry::get_type() const
+{
+    return "System Slots";
+}
+
+void SystemSlotsEntry::render_to(RenderBuffer& out) const
+{
+    out << "Header type: " << get_type() << '\n';
+    out << "Designation: " << dmi_string_view(fields_.get<SystemSlotsLayout::SlotDesignation>(0)) << '\n';
+    out << "Type: " << static_cast<unsigned>(get_slot_type()) << '\n';
+    out << "Current Usage: " << static_cast<unsigned>(get_current_usage()) << '\n';
+    out << "ID: " << get_slot_id() << '\n';
+    const PciAddress address = get_pci_address();
+    if (address.is_valid()) {
+        out << "Bus Address: " << format_pci_address(address) << '\n';
+    }
+}
+
+uint8_t SystemSlotsEntry::get_slot_type() const
+{
+    return fields_.get<SystemSlotsLayout::SlotType>(0x02);
+}
+
+uint8_t SystemSlotsEntry::get_slot_data_bus_width() const
+{
+    return fields_.get<SystemSlotsLayout::SlotDataBusWidth>(0x02);
+}
+
+uint8_t SystemSlotsEntry::get_current_usage() const
+{
+    return fields_.get<SystemSlotsLayout::CurrentUsage>(UsageUnknown);
+}
+
+uint8_t SystemSlotsEntry::get_slot_length() const
+{
+    return fields_.get<SystemSlotsLayout::SlotLength>(0x02);
+}
+
+uint16_t SystemSlotsEntry::get_slot_id() const
+{
+    return fields_.get<SystemSlotsLayout::SlotId>(0);
+}
+
+uint8_t SystemSlotsEntry::get_slot_characteristics1() const
+{
+    return fields_.get<SystemSlotsLayout::SlotCharacteristics1>(0);
+}
+
+uint8_t SystemSlotsEntry::get_slot_characteristics2() const
+{
+    return fields_.get<SystemSlotsLayout::SlotCharacteristics2>(0);
+}
+
+PciAddress SystemSlotsEntry::get_pci_address() const
+{
+    // FFh bus and device/function mean the slot is not on PCI, the same for old versions
+    PciAddress address;
+    address.segment = fields_.get<SystemSlotsLayout::SegmentGroupNumber>(0xFFFF);
+    address.bus = fields_.get<SystemSlotsLayout::BusNumber>(0xFF);
+    address.device_function = fields_.get<SystemSlotsLayout::DeviceFunctionNumber>(0xFF);
+    return address;
+}
+
+std::string SystemSlotsEntry::get_slot_designation_string() const
+{
+    return AbstractSMBiosEntry::dmi_string(fields_.get<SystemSlotsLayout::SlotDesignation>(0));
+}
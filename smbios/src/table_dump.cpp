@@ -0,0 +1,103 @@
+#include <smbios/table_dump.h>
+#include <smbios/smbios_anchor.h>
+#include <smbios/smbios_field.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <boost/filesystem.hpp>
+
+using namespace smbios;
+namespace fs = boost::filesystem;
+
+namespace {
+
+/// Entry point fields needed to find the table in the file
+struct EntryPoint {
+    size_t length;
+    SMBiosVersion version;
+    uint64_t table_offset;
+    uint64_t table_size;
+};
+
+EntryPoint parse_entry_point(const std::vector<uint8_t>& file, SMBiosAnchorType anchor)
+{
+    switch (anchor) {
+    case SMBiosAnchorType::SMBios32:
+        if (file.size() < 0x1F) {
+            throw std::runtime_error("Truncated 32-bit SMBIOS entry point");
+        }
+        return EntryPoint{ 0x1F, { file[0x06], file[0x07] }, load_uint(&file[0x18], 4), load_uint(&file[0x16], 2) };
+    case SMBiosAnchorType::SMBios64:
+        if (file.size() < 0x18) {
+            throw std::runtime_error("Truncated 64-bit SMBIOS entry point");
+        }
+        // table size is the maximum one, the end of table structure comes earlier
+        return EntryPoint{ 0x18, { file[0x07], file[0x08] }, load_uint(&file[0x10], 8), load_uint(&file[0x0C], 4) };
+    default:
+        if (file.size() < 0x0F) {
+            throw std::runtime_error("Truncated legacy DMI entry point");
+        }
+        // BCD revision, e.g. 21h is 2.1
+        return EntryPoint{ 0x0F, { static_cast<uint16_t>(file[0x0E] >> 4), static_cast<uint16_t>(file[0x0E] & 0x0F) },
+            load_uint(&file[0x08], 4), load_uint(&file[0x06], 2) };
+    }
+}
+
+} // namespace
+
+TableDump smbios::parse_table_dump(std::vector<uint8_t> file, const SMBiosVersion& raw_version)
+{
+    const SMBiosAnchorType anchor = file.size() >= 5 ? detect_smbios_anchor(file.begin()) : SMBiosAnchorType::NoHeader;
+    if (anchor == SMBiosAnchorType::NoHeader) {
+        return TableDump{ std::move(file), raw_version };
+    }
+
+    const EntryPoint entry_point = parse_entry_point(file, anchor);
+    if (entry_point.table_offset < entry_point.length || entry_point.table_offset >= file.size()) {
+        throw std::runtime_error("SMBIOS table address is out of the dump file");
+    }
+    const size_t table_begin = static_cast<size_t>(entry_point.table_offset);
+    const size_t table_end = static_cast<size_t>(std::min<uint64_t>(file.size(), table_begin + entry_point.table_size));
+
+    file.erase(file.begin() + table_end, file.end());
+    file.erase(file.begin(), file.begin() + table_begin);
+    return TableDump{ std::move(file), entry_point.version };
+}
+
+TableDump smbios::read_table_dump(const std::string& path, const SMBiosVersion& raw_version)
+{
+    std::ifstream dump_file(path, std::ios::binary);
+    if (!dump_file) {
+        throw std::runtime_error("Unable to open SMBIOS dump file " + path);
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(dump_file)), std::istreambuf_iterator<char>());
+    if (file.empty()) {
+        throw std::runtime_error("SMBIOS dump file is empty: " + path);
+    }
+    return parse_table_dump(std::move(file), raw_version);
+}
+
+std::vector<std::string> smbios::list_table_dumps(const std::string& directory)
+{
+    boost::system::error_code error;
+    if (!fs::is_directory(directory, error)) {
+        throw std::runtime_error("Not a directory: " + directory);
+    }
+
+    std::vector<std::string> paths;
+    for (fs::directory_iterator entry(directory, error), end; !error && entry != end; entry.increment(error)) {
+        // entry which status could not be read is not a dump, the listing goes on
+        boost::system::error_code status_error;
+        if (fs::is_regular_file(entry->path(), status_error)) {
+            paths.push_back(entry->path().string());
+        }
+    }
+    // partial listing would silently skip dumps
+    if (error) {
+        throw std::runtime_error("Unable to list directory " + directory + ": " + error.message());
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
@@ -0,0 +1,149 @@
+#include <smbios/vectored_output.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+using namespace smbios;
+
+namespace {
+
+#ifndef IOV_MAX
+// POSIX minimum
+constexpr size_t iov_max = 16;
+#else
+constexpr size_t iov_max = IOV_MAX;
+#endif
+
+/// Headroom over the seal size, so that the structure which crosses it does not reallocate the chunk
+size_t chunk_capacity(size_t chunk_size)
+{
+    return chunk_size + chunk_size / 4;
+}
+
+} // namespace
+
+constexpr size_t VectoredOutput::default_chunk_size;
+constexpr size_t VectoredOutput::default_max_chunks;
+
+VectoredOutput::VectoredOutput(int fd, size_t chunk_size, size_t max_chunks) :
+    fd_(fd),
+    chunk_size_(std::max<size_t>(chunk_size, 1)),
+    max_chunks_(std::max<size_t>(max_chunks, 1))
+{
+    chunks_.emplace_back(chunk_capacity(chunk_size_));
+}
+
+VectoredOutput::~VectoredOutput()
+{
+    try {
+        flush();
+    }
+    catch (const std::exception&) {
+        // nobody to report to, e.g. reader of the pipe has gone
+    }
+}
+
+void VectoredOutput::commit()
+{
+    if (chunks_[active_].size() < chunk_size_) {
+        return;
+    }
+    ++active_;
+    if (active_ == chunks_.size()) {
+        chunks_.emplace_back(chunk_capacity(chunk_size_));
+    }
+    if (active_ >= max_chunks_) {
+        flush();
+    }
+}
+
+void VectoredOutput::flush()
+{
+    // chunks are dropped even if the write has failed, the output is never repeated
+    auto drop_chunks = [this]() {
+        for (size_t chunk = 0; chunk <= active_; ++chunk) {
+            chunks_[chunk].clear();
+        }
+        active_ = 0;
+    };
+    try {
+        write_pending();
+    }
+    catch (...) {
+        drop_chunks();
+        throw;
+    }
+    drop_chunks();
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+void VectoredOutput::write_pending()
+{
+    for (size_t chunk = 0; chunk <= active_; ++chunk) {
+        const char* data = chunks_[chunk].data();
+        size_t size = chunks_[chunk].size();
+        while (size) {
+            const int written = _write(fd_, data, static_cast<unsigned int>(std::min<size_t>(size, INT_MAX)));
+            ++write_calls_;
+            if (written < 0) {
+                throw std::runtime_error("Unable to write output: " + std::string(std::strerror(errno)));
+            }
+            data += written;
+            size -= written;
+            bytes_written_ += written;
+        }
+    }
+}
+
+#else
+
+void VectoredOutput::write_pending()
+{
+    std::vector<iovec> vectors;
+    vectors.reserve(active_ + 1);
+    for (size_t chunk = 0; chunk <= active_; ++chunk) {
+        if (!chunks_[chunk].empty()) {
+            vectors.push_back(iovec{ const_cast<char*>(chunks_[chunk].data()), chunks_[chunk].size() });
+        }
+    }
+
+    size_t first = 0;
+    while (first < vectors.size()) {
+        const size_t count = std::min(vectors.size() - first, iov_max);
+        const ssize_t result = ::writev(fd_, &vectors[first], static_cast<int>(count));
+        ++write_calls_;
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Unable to write output: " + std::string(std::strerror(errno)));
+        }
+        bytes_written_ += static_cast<uint64_t>(result);
+
+        // skip written vectors, the last one could be written partially
+        size_t written = static_cast<size_t>(result);
+        while (first < vectors.size() && written >= vectors[first].iov_len) {
+            written -= vectors[first].iov_len;
+            ++first;
+        }
+        if (written) {
+            vectors[first].iov_base = static_cast<char*>(vectors[first].iov_base) + written;
+            vectors[first].iov_len -= written;
+        }
+    }
+}
+
+#endif // defined(_WIN32) || defined(_WIN64)
@@ -1,8 +1,46 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <map>
+#include <thread>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
 #include <smbios/smbios.h>
 #include <smbios/smbios_entry_factory.h>
+#include <smbios/smbios_entry_variant.h>
+#include <smbios/memory_device_view.h>
+#include <smbios/bios_information_view.h>
+#include <smbios/smbios_field.h>
+#include <smbios/smbios_schema.h>
+#include <smbios/generic_smbios_entry.h>
+#include <smbios/memory_address_index.h>
+#include <smbios/handle_graph.h>
+#include <smbios/memory_topology.h>
+#include <smbios/cpu_topology.h>
+#include <smbios/system_identity.h>
+#include <smbios/oem_string_index.h>
+#include <smbios/pci_device_map.h>
+#include <smbios/management_controllers.h>
+#include <smbios/edac_correlation.h>
+#include <smbios/dimm_locator.h>
+#include <smbios/render_buffer.h>
+#include <smbios/json_writer.h>
+#include <smbios/smbios_json.h>
+#include <smbios/smbios_cbor.h>
+#include <smbios/columnar_export.h>
+#include <smbios/csv_export.h>
+#include <smbios/table_dump.h>
+#include <smbios/projection.h>
+#include <smbios/vectored_output.h>
+#include <smbios/render_cache.h>
+#include <smbios/dmidecode_output.h>
+#include <smbios/parallel_render.h>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/algorithm/string.hpp>
+#include "synthetic_table.h"
+#include "sysfs_fixture.h"
 
 #define BOOST_AUTO_TEST_MAIN
 #include <boost/test/unit_test.hpp>
@@ -61,4 +99,1831 @@ BOOST_AUTO_TEST_CASE(SMBiosIterationTestCase)
 }
 
 
+/// Decode synthetic table into variants, unknown structures are kept raw
+BOOST_AUTO_TEST_CASE(SMBiosVariantTestCase)
+{
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+    BOOST_REQUIRE_EQUAL(smbios.get_structures_count(), 6u);
+
+    SMBiosEntryFactory smbios_factory;
+    std::vector<SMBiosEntryVariant> entries = smbios_factory.create_all(smbios);
+    BOOST_REQUIRE_EQUAL(entries.size(), 5u);
+
+    BOOST_CHECK(boost::get<BiosInformationEntry>(&entries[0]));
+    BOOST_CHECK(boost::get<PortConnectionEntry>(&entries[1]));
+    BOOST_CHECK(boost::get<MemoryDeviceEntry>(&entries[2]));
+    BOOST_CHECK(boost::get<MemoryDeviceEntry>(&entries[3]));
+    BOOST_CHECK(!is_decoded(entries[4]));
+
+    const BiosInformationEntry& bios = boost::get<BiosInformationEntry>(entries[0]);
+    BOOST_CHECK_EQUAL(bios.get_vendor_string(), "Test Vendor");
+
+    const MemoryDeviceEntry& memory = boost::get<MemoryDeviceEntry>(entries[2]);
+    BOOST_CHECK_EQUAL(memory.get_device_locator_string(), "DIMM_A1");
+    BOOST_CHECK_EQUAL(memory.get_device_size(), 8192);
+
+    // same output as virtual interface
+    SMBiosVersion ver = smbios.get_smbios_version();
+    size_t index = 0;
+    for (const DMIHeader& header : smbios) {
+        std::unique_ptr<AbstractSMBiosEntry> entry = smbios_factory.create(header, ver);
+        if (entry) {
+            BOOST_CHECK_EQUAL(entry->render_to_description(),
+                boost::apply_visitor(RenderVisitor(), entries[index]));
+            BOOST_CHECK_EQUAL(entry->get_entry_size(),
+                boost::apply_visitor(EntrySizeVisitor(), entries[index]));
+        }
+        ++index;
+    }
+}
+/// Typed views should report the same values as full entries
+BOOST_AUTO_TEST_CASE(SMBiosViewTestCase)
+{
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+    SMBiosVersion ver = smbios.get_smbios_version();
+
+    std::vector<MemoryDeviceView> memory_views = smbios.view_all<MemoryDeviceView>();
+    std::vector<BiosInformationView> bios_views = smbios.view_all<BiosInformationView>();
+    BOOST_REQUIRE_EQUAL(memory_views.size(), 2u);
+    BOOST_REQUIRE_EQUAL(bios_views.size(), 1u);
+
+    size_t memory_index = 0;
+    for (const DMIHeader& header : smbios) {
+        if (header.type == SMBios::MemoryDevice) {
+            MemoryDeviceEntry entry(header, ver);
+            const MemoryDeviceView& view = memory_views[memory_index++];
+            BOOST_CHECK_EQUAL(view.get_handle(), header.handle);
+            BOOST_CHECK_EQUAL(view.get_array_handle(), entry.get_array_handle());
+            BOOST_CHECK_EQUAL(view.get_device_size(), entry.get_device_size());
+            BOOST_CHECK_EQUAL(view.get_device_type(), entry.get_device_type());
+            BOOST_CHECK_EQUAL(view.get_device_speed(), entry.get_device_speed());
+            BOOST_CHECK_EQUAL(view.get_device_locator_string(), entry.get_device_locator_string());
+            BOOST_CHECK_EQUAL(view.get_bank_locator_string(), entry.get_bank_locator_string());
+            BOOST_CHECK_EQUAL(view.get_part_number_string(), entry.get_part_number_string());
+        }
+        if (header.type == SMBios::BIOSInformation) {
+            BiosInformationEntry entry(header, ver);
+            const BiosInformationView& view = bios_views.front();
+            BOOST_CHECK_EQUAL(view.get_vendor_string(), entry.get_vendor_string());
+            BOOST_CHECK_EQUAL(view.get_release_date_string(), entry.get_release_date_string());
+            BOOST_CHECK_EQUAL(view.get_properties(), entry.get_properties());
+            BOOST_CHECK_EQUAL(view.get_runtime_size(), entry.get_runtime_size());
+        }
+    }
+    BOOST_CHECK_EQUAL(memory_views[0].get_configured_voltage(), 1200);
+
+    // fields newer than table version are not available
+    SMBios old_smbios(test::make_basic_table(), SMBiosVersion{ 2, 3 });
+    std::vector<MemoryDeviceView> old_views = old_smbios.view_all<MemoryDeviceView>();
+    BOOST_REQUIRE_EQUAL(old_views.size(), 2u);
+    BOOST_CHECK_EQUAL(old_views[0].get_device_speed(), 2400);
+    BOOST_CHECK_EQUAL(old_views[0].get_device_rank(), 0);
+    BOOST_CHECK_EQUAL(old_views[0].get_configured_voltage(), 0);
+}
+/// Version-resolved field access for entries, views and batches
+BOOST_AUTO_TEST_CASE(SMBiosFieldTestCase)
+{
+    BOOST_CHECK(SMBiosVersion({ 3, 0 }) > SMBiosVersion({ 2, 8 }));
+    BOOST_CHECK(SMBiosVersion({ 2, 8 }) < SMBiosVersion({ 3, 0 }));
+    BOOST_CHECK(!(SMBiosVersion({ 3, 0 }) < SMBiosVersion({ 2, 1 })));
+
+    BOOST_CHECK_EQUAL(revision_length(MemoryDeviceLayout::revisions, 2, 0), 0);
+    BOOST_CHECK_EQUAL(revision_length(MemoryDeviceLayout::revisions, 2, 5), 0x1B);
+    BOOST_CHECK_EQUAL(revision_length(MemoryDeviceLayout::revisions, 3, 0), 0x28);
+
+    // the same table, 2.6 field is cut by version
+    SMBios smbios(test::make_basic_table(), SMBiosVersion{ 2, 5 });
+    for (const DMIHeader& header : smbios) {
+        if (header.type == SMBios::MemoryDevice) {
+            MemoryDeviceEntry entry(header, smbios.get_smbios_version());
+            BOOST_CHECK_EQUAL(entry.get_device_rank(), 0);
+            BOOST_CHECK_EQUAL(entry.get_manufacturer_index(), 3);
+        }
+    }
+
+    std::vector<MemoryDeviceView> views = smbios.view_all<MemoryDeviceView>();
+    std::vector<uint16_t> speeds;
+    read_field_batch<MemoryDeviceLayout::DeviceSpeed>(views.begin(), views.end(), 0, std::back_inserter(speeds));
+    BOOST_REQUIRE_EQUAL(speeds.size(), 2u);
+    BOOST_CHECK_EQUAL(speeds[0], 2400);
+    BOOST_CHECK_EQUAL(speeds[1], 0);
+
+    std::vector<uint8_t> ranks;
+    read_field_batch<MemoryDeviceLayout::DeviceRank>(views.begin(), views.end(), 0xFF, std::back_inserter(ranks));
+    BOOST_CHECK(ranks == std::vector<uint8_t>(2, 0xFF));
+
+    // headers of one type are resolved per run, the result is the same as of the views
+    std::vector<DMIHeader> device_headers;
+    for (const DMIHeader& header : smbios) {
+        if (header.type == SMBios::MemoryDevice) {
+            device_headers.push_back(header);
+        }
+    }
+    std::vector<uint16_t> header_speeds;
+    read_field_batch<MemoryDeviceLayout::DeviceSpeed>(MemoryDeviceLayout::revisions, smbios.get_smbios_version(),
+        device_headers.data(), device_headers.data() + device_headers.size(), 0, std::back_inserter(header_speeds));
+    BOOST_CHECK(header_speeds == speeds);
+    std::vector<uint8_t> header_ranks;
+    read_field_batch<MemoryDeviceLayout::DeviceRank>(MemoryDeviceLayout::revisions, smbios.get_smbios_version(),
+        device_headers.data(), device_headers.data() + device_headers.size(), 0xFF, std::back_inserter(header_ranks));
+    BOOST_CHECK(header_ranks == ranks);
+}
+/// Entries are decoded once and shared between threads
+BOOST_AUTO_TEST_CASE(SMBiosEntryCacheTestCase)
+{
+    const SMBios smbios(test::make_basic_table(), test::make_basic_version());
+
+    constexpr size_t threads_count = 4;
+    std::vector<std::vector<const AbstractSMBiosEntry*>> seen(threads_count);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&smbios, &seen, t]() {
+            for (size_t i = 0; i < 5; ++i) {
+                seen[t].push_back(smbios.entry(i));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (size_t t = 1; t < threads_count; ++t) {
+        BOOST_CHECK(seen[t] == seen[0]);
+    }
+
+    BOOST_CHECK(smbios.entry(0));
+    BOOST_CHECK(!smbios.entry(4));
+    BOOST_CHECK_EQUAL(smbios.entry(0)->get_type(), "BIOS Information");
+    BOOST_CHECK_THROW(smbios.entry(5), std::out_of_range);
+
+    std::vector<const MemoryDeviceEntry*> memory = smbios.entries_of_type<MemoryDeviceEntry>();
+    BOOST_REQUIRE_EQUAL(memory.size(), 2u);
+    BOOST_CHECK_EQUAL(memory[0], smbios.entry(2));
+    BOOST_CHECK_EQUAL(memory[1]->get_device_locator_string(), "DIMM_A2");
+}
+
+/// Structures without dedicated classes should be decoded by their schema
+BOOST_AUTO_TEST_CASE(SMBiosSchemaTestCase)
+{
+    for (uint8_t type = 0; type <= 46; ++type) {
+        const StructureSchema* schema = find_structure_schema(type);
+        BOOST_REQUIRE(schema);
+        BOOST_CHECK_EQUAL(schema->type, type);
+        for (size_t i = 0; i < schema->fields_count; ++i) {
+            BOOST_CHECK_GE(schema->fields[i].offset, 4);
+        }
+    }
+    BOOST_CHECK(!find_structure_schema(SMBios::EndOfTable));
+    BOOST_CHECK(!find_structure_schema(0x80));
+
+    // bit names follow the spec, every bit of a bitfield has its own name
+    const FieldSchema* characteristics = find_field_schema(*find_structure_schema(0), 0x0A);
+    BOOST_REQUIRE(characteristics);
+    BOOST_CHECK_EQUAL(find_field_name(*characteristics, 2), "Unknown");
+    BOOST_CHECK_EQUAL(find_field_name(*characteristics, 3), "BIOS characteristics not supported");
+    for (uint8_t type = 0; type <= 46; ++type) {
+        const StructureSchema* schema = find_structure_schema(type);
+        for (size_t i = 0; i < schema->fields_count; ++i) {
+            const FieldSchema& field = schema->fields[i];
+            if (field.kind != FieldKind::Bitfield) {
+                continue;
+            }
+            for (size_t j = 0; j < field.names_count; ++j) {
+                for (size_t k = j + 1; k < field.names_count; ++k) {
+                    BOOST_CHECK_MESSAGE(std::strcmp(field.names[j].name, field.names[k].name) != 0,
+                        schema->name << ": " << field.name << ": " << field.names[j].name);
+                }
+            }
+        }
+    }
+
+    // flat text form of the line-oriented exporters, text is bracketed by the caller
+    const auto bracketed = [](RenderBuffer& out, boost::string_view text) { out << '[' << text << ']'; };
+    std::string bit_names;
+    RenderBuffer flat;
+    append_field_value(flat, DecodedField{ characteristics, 0x0C, boost::string_view(), nullptr }, bit_names, bracketed);
+    BOOST_CHECK_EQUAL(flat.view(), "[Unknown|BIOS characteristics not supported]");
+    flat.clear();
+    const FieldSchema* wake_up = find_field_schema(*find_structure_schema(1), 0x18);
+    BOOST_REQUIRE(wake_up);
+    append_field_value(flat, DecodedField{ wake_up, 0xEE, boost::string_view(), nullptr }, bit_names, bracketed);
+    append_field_value(flat, DecodedField{ wake_up, 6, "Power Switch", nullptr }, bit_names, bracketed);
+    const uint8_t raw_bytes[16] = { 0x0A, 0xFF };
+    append_field_value(flat, DecodedField{ find_field_schema(*find_structure_schema(1), 0x08), 0, boost::string_view(), raw_bytes },
+        bit_names, bracketed);
+    BOOST_CHECK_EQUAL(flat.view(), "238[Power Switch]0aff0000000000000000000000000000");
+
+    const uint8_t uuid[16] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    test::SyntheticTable table;
+    table.add(1, 0x0001, test::system_information_v24(uuid),
+            { "Test Vendor", "Test Product", "1.0", "SN-42", "SKU-7", "Family" })
+        .add(3, 0x0003, test::chassis_v21(), { "Test Vendor", "2.0", "CH-1", "Tag" });
+    SMBios smbios(table.build(), SMBiosVersion{ 2, 4 });
+
+    SMBiosEntryFactory smbios_factory;
+    std::vector<SMBiosEntryVariant> entries = smbios_factory.create_all(smbios);
+    BOOST_REQUIRE_EQUAL(entries.size(), 2u);
+    BOOST_REQUIRE(boost::get<GenericSMBiosEntry>(&entries[0]));
+    BOOST_REQUIRE(boost::get<GenericSMBiosEntry>(&entries[1]));
+
+    const GenericSMBiosEntry& system = boost::get<GenericSMBiosEntry>(entries[0]);
+    BOOST_CHECK_EQUAL(system.get_type(), "System Information");
+    const std::string system_description = system.render_to_description();
+    BOOST_CHECK(system_description.find("Product Name: Test Product\n") != std::string::npos);
+    BOOST_CHECK(system_description.find("UUID: 00112233445566778899aabbccddeeff\n") != std::string::npos);
+    BOOST_CHECK(system_description.find("Wake-up Type: Power Switch\n") != std::string::npos);
+    BOOST_CHECK(system_description.find("Family: Family\n") != std::string::npos);
+
+    // lock flag is not the part of chassis type, fields of 2.3+ are not in the 2.1 structure
+    const GenericSMBiosEntry& chassis = boost::get<GenericSMBiosEntry>(entries[1]);
+    const std::string chassis_description = chassis.render_to_description();
+    BOOST_CHECK(chassis_description.find("Type: Rack Mount Chassis\n") != std::string::npos);
+    BOOST_CHECK(chassis_description.find("Thermal State: OK\n") != std::string::npos);
+    BOOST_CHECK(chassis_description.find("Height") == std::string::npos);
+
+    size_t fields_count = 0;
+    chassis.for_each_field([&fields_count](const DecodedField&) { ++fields_count; });
+    BOOST_CHECK_EQUAL(fields_count, 9u);
+
+    // same decoding through the virtual interface
+    BOOST_REQUIRE(smbios.entry(1));
+    BOOST_CHECK_EQUAL(smbios.entry(1)->render_to_description(), chassis_description);
+}
+
+/// Physical addresses should be resolved to DIMMs, 32-bit and extended ranges
+BOOST_AUTO_TEST_CASE(SMBiosMemoryAddressIndexTestCase)
+{
+    constexpr uint64_t gb = uint64_t(1) << 30;
+    constexpr uint32_t kb_in_gb = 1u << 20;
+
+    test::SyntheticTable table;
+    table.add(SMBios::MemoryArrayMappedAddress, 0x0013,
+            test::memory_array_mapped_address_v27(0xFFFFFFFF, 0xFFFFFFFF, 0x0010, 0, 16 * gb - 1))
+        .add(SMBios::MemoryDeviceMappedAddress, 0x0014,
+            test::memory_device_mapped_address_v27(0, 8 * kb_in_gb - 1, 0x0011, 0x0013))
+        .add(SMBios::MemoryDeviceMappedAddress, 0x0015,
+            test::memory_device_mapped_address_v27(0xFFFFFFFF, 0xFFFFFFFF, 0x0012, 0x0013, 8 * gb, 16 * gb - 1))
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(SMBios::MemoryDevice, 0x0012, test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A2", "BANK 1", "Vendor", "0002", "Tag", "PN-2" });
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const auto device_ranges = smbios.entries_of_type<MemoryDeviceMappedAddressEntry>();
+    BOOST_REQUIRE_EQUAL(device_ranges.size(), 2u);
+    BOOST_CHECK_EQUAL(device_ranges[0]->get_address_range().begin, 0u);
+    BOOST_CHECK_EQUAL(device_ranges[0]->get_address_range().end, 8 * gb - 1);
+    BOOST_CHECK_EQUAL(device_ranges[1]->get_address_range().begin, 8 * gb);
+    BOOST_CHECK_EQUAL(device_ranges[1]->get_device_handle(), 0x0012);
+
+    const MemoryAddressIndex index(smbios);
+    BOOST_CHECK_EQUAL(index.get_device_ranges_count(), 2u);
+    BOOST_CHECK_EQUAL(index.get_array_ranges_count(), 1u);
+
+    BOOST_REQUIRE(index.find_device(0));
+    BOOST_CHECK_EQUAL(index.find_device(0)->get_device_locator_string(), "DIMM_A1");
+    BOOST_CHECK_EQUAL(index.find_device(8 * gb - 1)->get_device_locator_string(), "DIMM_A1");
+    BOOST_REQUIRE(index.find_device(8 * gb));
+    BOOST_CHECK_EQUAL(index.find_device(8 * gb)->get_bank_locator_string(), "BANK 1");
+    BOOST_CHECK_EQUAL(index.find_device(12 * gb + 123)->get_device_locator_string(), "DIMM_A2");
+    BOOST_CHECK(!index.find_device(16 * gb));
+
+    BOOST_REQUIRE(index.find_array_range(5 * gb));
+    BOOST_CHECK_EQUAL(index.find_array_range(5 * gb)->get_array_handle(), 0x0010);
+    BOOST_CHECK(!index.find_array_range(16 * gb));
+
+    // overlapping ranges: nested range wins, but does not hide the outer one
+    AddressIntervals<int> intervals;
+    intervals.add(MappedAddressRange{ 0, 100 }, 1);
+    intervals.add(MappedAddressRange{ 10, 20 }, 2);
+    intervals.add(MappedAddressRange{ 200, 300 }, 3);
+    intervals.build();
+    BOOST_CHECK_EQUAL(intervals.find(15), 2);
+    BOOST_CHECK_EQUAL(intervals.find(50), 1);
+    BOOST_CHECK_EQUAL(intervals.find(150, -1), -1);
+    BOOST_CHECK_EQUAL(intervals.find(300), 3);
+
+    // wide first range under many narrow ones, compared with a linear scan
+    AddressIntervals<int> nested;
+    std::vector<MappedAddressRange> ranges{ MappedAddressRange{ 0, 100000 } };
+    for (uint64_t i = 1; i < 1000; ++i) {
+        ranges.push_back(MappedAddressRange{ i * 100, i * 100 + (i % 3) * 40 });
+    }
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        nested.add(ranges[i], static_cast<int>(i));
+    }
+    nested.build();
+    for (uint64_t address = 0; address <= 100100; address += 7) {
+        int expected = -1;
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            if (ranges[i].contains(address)) {
+                expected = static_cast<int>(i);
+            }
+        }
+        BOOST_CHECK_EQUAL(nested.find(address, -1), expected);
+    }
+
+    // extended range announced by a 2.1 structure is not mapped
+    test::StructureBuilder legacy_range;
+    legacy_range.u32(0xFFFFFFFF).u32(0xFFFFFFFF).u16(0x0010).u8(1);
+    test::SyntheticTable legacy;
+    legacy.add(SMBios::MemoryArrayMappedAddress, 0x0013, legacy_range);
+    const SMBios legacy_smbios(legacy.build(), test::make_basic_version());
+    const auto legacy_ranges = legacy_smbios.entries_of_type<MemoryArrayMappedAddressEntry>();
+    BOOST_REQUIRE_EQUAL(legacy_ranges.size(), 1u);
+    BOOST_CHECK(legacy_ranges[0]->get_address_range().empty());
+    const MemoryAddressIndex legacy_index(legacy_smbios);
+    BOOST_CHECK_EQUAL(legacy_index.get_array_ranges_count(), 0u);
+    BOOST_CHECK(!legacy_index.find_array_range(0));
+}
+
+/// References by handle should be resolved in both directions
+BOOST_AUTO_TEST_CASE(SMBiosHandleGraphTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::ProcessorInformation, 0x0400, test::processor_v30(0x0700, 0x0701, 0x0702, 8, 16),
+            { "CPU0", "Intel", "Xeon", "SN", "Tag", "PN" })
+        .add(SMBios::CacheInformation, 0x0700, test::cache_v31(1, 512), { "L1" })
+        .add(SMBios::CacheInformation, 0x0701, test::cache_v31(2, 8192), { "L2" })
+        .add(SMBios::CacheInformation, 0x0702, test::cache_v31(3, 16384), { "L3" })
+        .add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x4000000, 2), {})
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(SMBios::MemoryDevice, 0x0012, test::memory_device_v28(0x0010, 0, 0),
+            { "DIMM_A2", "BANK 1", "Vendor", "0002", "Tag", "PN-2" })
+        .add(SMBios::MemoryDevice, 0x0013, test::memory_device_v28(0x0099, 0, 0),
+            { "DIMM_B1", "BANK 2", "Vendor", "0003", "Tag", "PN-3" });
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const HandleGraph& graph = smbios.handle_graph();
+    BOOST_CHECK_EQUAL(&graph, &smbios.handle_graph());
+    BOOST_CHECK_EQUAL(graph.get_vertices_count(), 8u);
+    BOOST_CHECK_EQUAL(graph.get_edges_count(), 5u);
+    BOOST_CHECK_EQUAL(graph.find_index(0x0010), 4u);
+    BOOST_CHECK_EQUAL(graph.find_index(0x0099), HandleGraph::npos);
+
+    // caches of CPU
+    std::vector<uint32_t> caches(graph.get_references(0).begin(), graph.get_references(0).end());
+    BOOST_CHECK((caches == std::vector<uint32_t>{ 1, 2, 3 }));
+    BOOST_CHECK_EQUAL(graph.get_referrers(2).size(), 1u);
+    BOOST_CHECK_EQUAL(graph.get_referrers(2).front(), 0u);
+
+    // all DIMMs under array, dangling array handle is not an edge
+    std::vector<std::string> locators;
+    for (uint32_t index : graph.get_referrers(graph.find_index(0x0010))) {
+        if (smbios.get_headers()[index].type == SMBios::MemoryDevice) {
+            locators.push_back(static_cast<const MemoryDeviceEntry*>(smbios.entry(index))->get_device_locator_string());
+        }
+    }
+    BOOST_CHECK((locators == std::vector<std::string>{ "DIMM_A1", "DIMM_A2" }));
+    BOOST_CHECK(graph.get_references(7).empty());
+    BOOST_CHECK_THROW(graph.get_references(8), std::out_of_range);
+}
+
+/// Memory summary should decode all size encodings and skip non-system arrays
+BOOST_AUTO_TEST_CASE(SMBiosMemoryTopologyTestCase)
+{
+    constexpr uint64_t mb = uint64_t(1) << 20;
+    const std::vector<std::string> strings = { "DIMM", "BANK", "Vendor", "0001", "Tag", "PN" };
+
+    test::SyntheticTable table;
+    table.add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x80000000, 6, 2048 * 1024 * mb))
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400), strings)
+        .add(SMBios::MemoryDevice, 0x0012, test::memory_device_v28(0x0010, 0x7FFF, 3200, 65536), strings)
+        .add(SMBios::MemoryDevice, 0x0013, test::memory_device_v28(0x0010, 0x8000 | 512, 2400), strings)
+        .add(SMBios::MemoryDevice, 0x0014, test::memory_device_v28(0x0010, 0, 0), strings)
+        .add(SMBios::MemoryDevice, 0x0015, test::memory_device_v28(0x0010, 0xFFFF, 0), strings)
+        .add(SMBios::PhysicalMemoryArray, 0x0020, test::physical_memory_array_v27(16384, 1, 0, 0x05), {})
+        .add(SMBios::MemoryDevice, 0x0021, test::memory_device_v28(0x0020, 16, 0), strings);
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const MemoryTopology topology = summarize_memory_topology(smbios);
+    BOOST_CHECK_EQUAL(topology.installed_size, 8192 * mb + 65536 * mb + 512 * 1024);
+    BOOST_CHECK_EQUAL(topology.populated_slots, 4u);
+    BOOST_CHECK_EQUAL(topology.empty_slots, 1u);
+    BOOST_CHECK_EQUAL(topology.unknown_size_devices, 1u);
+
+    BOOST_REQUIRE_EQUAL(topology.arrays.size(), 2u);
+    BOOST_CHECK_EQUAL(topology.arrays[0].slots, 6u);
+    BOOST_CHECK_EQUAL(topology.arrays[0].populated_slots, 4u);
+    BOOST_CHECK_EQUAL(topology.arrays[0].empty_slots, 1u);
+    BOOST_CHECK_EQUAL(topology.arrays[0].maximum_capacity, 2048 * 1024 * mb);
+    BOOST_CHECK_EQUAL(topology.arrays[1].maximum_capacity, 16384u * 1024);
+    BOOST_CHECK_EQUAL(topology.arrays[1].installed_size, 16 * mb);
+
+    BOOST_REQUIRE_EQUAL(topology.speed_mix.size(), 3u);
+    BOOST_CHECK_EQUAL(topology.speed_mix[0].value, 0u);
+    BOOST_CHECK_EQUAL(topology.speed_mix[1].value, 2400u);
+    BOOST_CHECK_EQUAL(topology.speed_mix[1].count, 2u);
+    BOOST_CHECK_EQUAL(topology.speed_mix[2].value, 3200u);
+    BOOST_REQUIRE_EQUAL(topology.type_mix.size(), 1u);
+    BOOST_CHECK_EQUAL(topology.type_mix[0].value, MemoryDeviceEntry::DDR4);
+    BOOST_CHECK_EQUAL(topology.type_mix[0].count, 4u);
+
+    // string rendering agrees with the numeric decoding
+    const auto devices = smbios.entries_of_type<MemoryDeviceEntry>();
+    BOOST_CHECK_EQUAL(devices[1]->get_device_size_string(), "65536 MB");
+    BOOST_CHECK_EQUAL(devices[1]->get_device_size_bytes(), 65536 * mb);
+    BOOST_CHECK_EQUAL(devices[2]->get_device_size_bytes(), 512u * 1024);
+
+    // devices listed before their arrays belong to them as well
+    test::SyntheticTable reordered_table;
+    reordered_table.add(SMBios::MemoryDevice, 0x0021, test::memory_device_v28(0x0020, 16, 0), strings)
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400), strings)
+        .add(SMBios::PhysicalMemoryArray, 0x0020, test::physical_memory_array_v27(16384, 1, 0, 0x05), {})
+        .add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x80000000, 2, 0));
+    const MemoryTopology reordered = summarize_memory_topology(SMBios(reordered_table.build(), test::make_basic_version()));
+    BOOST_REQUIRE_EQUAL(reordered.arrays.size(), 2u);
+    BOOST_CHECK_EQUAL(reordered.arrays[0].installed_size, 16 * mb);
+    BOOST_CHECK_EQUAL(reordered.arrays[1].populated_slots, 1u);
+    BOOST_CHECK_EQUAL(reordered.installed_size, 8192 * mb);
+    BOOST_CHECK_EQUAL(reordered.populated_slots, 1u);
+}
+
+/// Processors with their caches, binary form should restore the same summary
+BOOST_AUTO_TEST_CASE(SMBiosCpuTopologyTestCase)
+{
+    const std::vector<std::string> strings = { "CPU", "Intel", "Xeon", "SN", "Tag", "PN" };
+
+    test::SyntheticTable table;
+    table.add(SMBios::CacheInformation, 0x0700, test::cache_v31(1, 1280), { "L1" })
+        .add(SMBios::CacheInformation, 0x0701, test::cache_v31(2, 40960), { "L2" })
+        .add(SMBios::CacheInformation, 0x0702, test::cache_v31(3, 49152), { "L3" })
+        .add(SMBios::ProcessorInformation, 0x0400, test::processor_v30(0x0700, 0x0701, 0x0702, 32, 64), strings)
+        .add(SMBios::ProcessorInformation, 0x0401, test::processor_v30(0x0700, 0x0701, 0x0702, 300, 600), strings)
+        .add(SMBios::ProcessorInformation, 0x0402, test::processor_v30(0xFFFF, 0xFFFF, 0xFFFF, 0, 0, 0x00), strings);
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const auto caches = smbios.entries_of_type<CacheInformationEntry>();
+    BOOST_REQUIRE_EQUAL(caches.size(), 3u);
+    BOOST_CHECK_EQUAL(caches[1]->get_level(), 2u);
+    BOOST_CHECK(caches[1]->is_enabled());
+    BOOST_CHECK_EQUAL(caches[1]->get_installed_size_bytes(), 40960u * 1024);
+    BOOST_CHECK_EQUAL(cache_size_bytes(0x8000 | 640, 0, false), 640u * 64 * 1024);
+    BOOST_CHECK_EQUAL(cache_size_bytes(0xFFFF, 0x80000000 | 2048, true), 2048u * 64 * 1024);
+
+    const auto processors = smbios.entries_of_type<ProcessorInformationEntry>();
+    BOOST_REQUIRE_EQUAL(processors.size(), 3u);
+    BOOST_CHECK_EQUAL(processors[0]->get_processor_family_string(), "Xeon");
+    BOOST_CHECK_EQUAL(processors[1]->get_core_count(), 300u);
+    BOOST_CHECK_EQUAL(processors[1]->get_thread_count(), 600u);
+    BOOST_CHECK(!processors[2]->is_populated());
+
+    const CpuTopology topology = summarize_cpu_topology(smbios);
+    BOOST_CHECK_EQUAL(topology.populated_sockets, 2u);
+    BOOST_CHECK_EQUAL(topology.cores, 332u);
+    BOOST_CHECK_EQUAL(topology.threads, 664u);
+    BOOST_REQUIRE_EQUAL(topology.sockets.size(), 3u);
+    BOOST_CHECK_EQUAL(topology.sockets[0].max_speed, 4000u);
+    BOOST_CHECK_EQUAL(topology.sockets[0].current_speed, 2100u);
+    BOOST_CHECK_EQUAL(topology.sockets[0].l1_cache_size, 1280u * 1024);
+    BOOST_CHECK_EQUAL(topology.sockets[0].l3_cache_size, 49152u * 1024);
+    BOOST_CHECK_EQUAL(topology.sockets[2].l2_cache_size, 0u);
+
+    const std::vector<uint8_t> binary = serialize_cpu_topology(topology);
+    BOOST_CHECK_EQUAL(binary.size(), 8u + 3 * 26);
+    const CpuTopology restored = deserialize_cpu_topology(binary.data(), binary.size());
+    BOOST_CHECK_EQUAL(render_cpu_topology(restored), render_cpu_topology(topology));
+    BOOST_CHECK_EQUAL(restored.cores, topology.cores);
+    BOOST_CHECK_THROW(deserialize_cpu_topology(binary.data(), binary.size() - 1), std::runtime_error);
+
+    const std::string text = render_cpu_topology(topology);
+    BOOST_CHECK_EQUAL(text.substr(0, text.find('\n')), "sockets=2 cores=332 threads=664");
+}
+
+/// Identity fast path stops at chassis, UUID byte order depends on the version
+BOOST_AUTO_TEST_CASE(SMBiosIdentityTestCase)
+{
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66,
+                               0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    const std::string long_serial(100, 'S');
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid), { "Vendor", "Product", "1.0", "SYS-0001", "SKU", "Family" })
+        .add(SMBios::BaseboardInformation, 0x0002, test::baseboard_v24(0x0003), { "Vendor", "Board", "1.0", long_serial, "Tag", "Slot" })
+        .add(SMBios::SystemEnclosure, 0x0003, test::chassis_v21(), { "Vendor", "1.0", "CHS-0001", "Tag" })
+        .add(SMBios::SystemEnclosure, 0x0004, test::chassis_v21(), { "Vendor", "1.0", "CHS-0002", "Tag" });
+    const std::vector<uint8_t> dump = table.build();
+
+    const SMBios smbios(dump, test::make_basic_version());
+    const SystemIdentity identity = smbios.identity();
+    BOOST_CHECK(identity.complete());
+    BOOST_CHECK(identity.uuid_present);
+    BOOST_CHECK_EQUAL(format_uuid(identity.uuid), "00112233-4455-6677-8899-AABBCCDDEEFF");
+    BOOST_CHECK_EQUAL(identity.system_serial, "SYS-0001");
+    BOOST_CHECK_EQUAL(std::string(identity.baseboard_serial), long_serial.substr(0, SystemIdentity::max_serial_length));
+    BOOST_CHECK_EQUAL(identity.chassis_serial, "CHS-0001");
+
+    // before 2.6 UUID is stored as is
+    const SystemIdentity legacy = read_system_identity(dump.data(), dump.size(), SMBiosVersion{ 2, 5 });
+    BOOST_CHECK_EQUAL(format_uuid(legacy.uuid), "33221100-5544-7766-8899-AABBCCDDEEFF");
+
+    // missing structures are reported, not thrown
+    test::SyntheticTable partial;
+    partial.add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid), { "Vendor", "Product", "1.0", "SYS-0001", "SKU", "Family" });
+    const std::vector<uint8_t> partial_dump = partial.build();
+    const SystemIdentity incomplete = read_system_identity(partial_dump.data(), partial_dump.size(), test::make_basic_version());
+    BOOST_CHECK(incomplete.system_found);
+    BOOST_CHECK(!incomplete.baseboard_found);
+    BOOST_CHECK(!incomplete.chassis_found);
+    BOOST_CHECK_EQUAL(incomplete.chassis_serial, "");
+
+    // serial string index past the strings leaves the serial empty
+    test::SyntheticTable missing;
+    missing.add(SMBios::BaseboardInformation, 0x0002, test::baseboard_v24(0x0003), { "Vendor", "Board", "1.0" });
+    const std::vector<uint8_t> missing_dump = missing.build();
+    const SystemIdentity missing_serial = read_system_identity(missing_dump.data(), missing_dump.size(), test::make_basic_version());
+    BOOST_CHECK(missing_serial.baseboard_found);
+    BOOST_CHECK_EQUAL(missing_serial.baseboard_serial, "");
+
+    BOOST_CHECK_EQUAL(render_system_identity(identity).substr(0, 43), "UUID: 00112233-4455-6677-8899-AABBCCDDEEFF\n");
+}
+
+/// OEM metadata from types 11 and 12 is indexed by key, values point into the table
+BOOST_AUTO_TEST_CASE(SMBiosOemStringsTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::OemStrings, 0x0B00, test::string_list(4), { "role=worker", "rack=R12=B", "empty=", "standalone" })
+        .add(SMBios::SystemConfigurationOptions, 0x0C00, test::string_list(2), { "JP2: 1-2 Cache", "role=master" })
+        .add(SMBios::OemStrings, 0x0B01, test::string_list(0), {});
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const auto oem_entries = smbios.entries_of_type<OemStringsEntry>();
+    BOOST_REQUIRE_EQUAL(oem_entries.size(), 2u);
+    BOOST_CHECK_EQUAL(oem_entries[0]->get_count(), 4u);
+    BOOST_CHECK_EQUAL(oem_entries[0]->get_string(2), "rack=R12=B");
+    BOOST_CHECK_EQUAL(oem_entries[0]->get_strings().size(), 4u);
+    BOOST_CHECK_EQUAL(oem_entries[1]->get_strings().size(), 0u);
+
+    const auto options = smbios.entries_of_type<SystemConfigurationOptionsEntry>();
+    BOOST_REQUIRE_EQUAL(options.size(), 1u);
+    BOOST_CHECK_EQUAL(options[0]->get_string(1), "JP2: 1-2 Cache");
+
+    // the first key in table order wins
+    BOOST_REQUIRE(smbios.oem_value("role"));
+    BOOST_CHECK_EQUAL(*smbios.oem_value("role"), "worker");
+    BOOST_CHECK_EQUAL(*smbios.oem_value("rack"), "R12=B");
+    BOOST_CHECK_EQUAL(*smbios.oem_value("empty"), "");
+    BOOST_CHECK_EQUAL(*smbios.oem_value("standalone"), "");
+    BOOST_CHECK(!smbios.oem_value("missing"));
+
+    // zero copy: value is inside the table
+    const boost::string_view role = *smbios.oem_value("role");
+    BOOST_CHECK(reinterpret_cast<const uint8_t*>(role.data()) >= smbios.get_table_base());
+    BOOST_CHECK(reinterpret_cast<const uint8_t*>(role.data()) < smbios.get_table_base() + smbios.get_table_size());
+
+    const OemStringIndex index(smbios.get_headers());
+    BOOST_CHECK_EQUAL(index.size(), 5u);
+
+    // Count of 255 is the largest one, the loops should not wrap
+    test::SyntheticTable full_table;
+    full_table.add(SMBios::OemStrings, 0x0B00, test::string_list(0xFF), { "first", "second" })
+        .add(SMBios::SystemConfigurationOptions, 0x0C00, test::string_list(0xFF), { "option" });
+    const SMBios full(full_table.build(), test::make_basic_version());
+    const auto full_oem = full.entries_of_type<OemStringsEntry>();
+    BOOST_REQUIRE_EQUAL(full_oem.size(), 1u);
+    BOOST_CHECK_EQUAL(full_oem[0]->get_count(), 0xFFu);
+    const std::vector<boost::string_view> full_strings = full_oem[0]->get_strings();
+    BOOST_REQUIRE_EQUAL(full_strings.size(), 0xFFu);
+    BOOST_CHECK_EQUAL(full_strings[1], "second");
+    BOOST_CHECK_EQUAL(full_strings[0xFE], "Bad index");
+    const auto full_options = full.entries_of_type<SystemConfigurationOptionsEntry>();
+    BOOST_REQUIRE_EQUAL(full_options.size(), 1u);
+    BOOST_CHECK_EQUAL(full_options[0]->get_strings().size(), 0xFFu);
+
+    RenderBuffer full_text;
+    full_oem[0]->render_to(full_text);
+    full_options[0]->render_to(full_text);
+    BOOST_CHECK_EQUAL(std::count(full_text.view().begin(), full_text.view().end(), '\n'), 2 * (1 + 0xFF));
+}
+
+/// Slots and onboard devices are looked up by PCI address
+BOOST_AUTO_TEST_CASE(SMBiosPciDeviceMapTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemSlots, 0x0900, test::system_slot_v26(1, 0x0000, 0x3B, 0x00), { "PCIE1" })
+        .add(SMBios::SystemSlots, 0x0901, test::system_slot_v26(2, 0x0001, 0x17, 0x08), { "PCIE2" })
+        .add(SMBios::SystemSlots, 0x0902, test::system_slot_v26(3, 0xFFFF, 0xFF, 0xFF), { "M2_SLOT" })
+        .add(SMBios::OnboardDevicesExtended, 0x2900, test::onboard_device_v26(0x05, 1, 0x0000, 0x18, 0x00), { "Onboard LAN 1" })
+        .add(SMBios::OnboardDevicesExtended, 0x2901, test::onboard_device_v26(0x05, 2, 0x0000, 0x18, 0x01), { "Onboard LAN 2" });
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const auto slots = smbios.entries_of_type<SystemSlotsEntry>();
+    BOOST_REQUIRE_EQUAL(slots.size(), 3u);
+    BOOST_CHECK_EQUAL(slots[1]->get_slot_designation_string(), "PCIE2");
+    BOOST_CHECK_EQUAL(slots[1]->get_slot_id(), 2u);
+    BOOST_CHECK_EQUAL(slots[1]->get_current_usage(), SystemSlotsEntry::UsageInUse);
+    BOOST_CHECK_EQUAL(format_pci_address(slots[1]->get_pci_address()), "0001:17:01.0");
+    BOOST_CHECK(!slots[2]->get_pci_address().is_valid());
+
+    const auto devices = smbios.entries_of_type<OnboardDevicesExtendedEntry>();
+    BOOST_REQUIRE_EQUAL(devices.size(), 2u);
+    BOOST_CHECK_EQUAL(devices[1]->get_reference_designation_string(), "Onboard LAN 2");
+    BOOST_CHECK_EQUAL(devices[1]->get_device_type(), 0x05u);
+    BOOST_CHECK(devices[1]->is_enabled());
+    BOOST_CHECK_EQUAL(devices[1]->get_device_type_instance(), 2u);
+
+    PciAddress address{};
+    BOOST_REQUIRE(parse_pci_address("0000:3b:00.0", address));
+    BOOST_CHECK_EQUAL(address.bus, 0x3Bu);
+    BOOST_REQUIRE(parse_pci_address("17:01.0", address));
+    BOOST_CHECK_EQUAL(address.segment, 0u);
+    BOOST_CHECK_EQUAL(address.get_device(), 1u);
+    BOOST_CHECK(!parse_pci_address("0000:3b:00", address));
+    BOOST_CHECK(!parse_pci_address("0000:3b:20.0", address));
+    BOOST_CHECK(!parse_pci_address("0000:3b:00.0x", address));
+
+    const PciDeviceMap& map = smbios.pci_devices();
+    BOOST_REQUIRE_EQUAL(map.get_records().size(), 4u);
+    BOOST_CHECK_EQUAL(map.get_records().front().label, "Onboard LAN 1");
+    BOOST_CHECK_EQUAL(map.get_records().back().label, "PCIE2");
+
+    const PciDeviceRecord* record = nullptr;
+    BOOST_REQUIRE(parse_pci_address("0000:18:00.1", address));
+    record = map.find(address);
+    BOOST_REQUIRE(record);
+    BOOST_CHECK_EQUAL(record->label, "Onboard LAN 2");
+    BOOST_CHECK_EQUAL(record->structure_type, SMBios::OnboardDevicesExtended);
+
+    // other functions of the slot device fall back to function 0
+    BOOST_REQUIRE(parse_pci_address("0000:3b:00.3", address));
+    record = map.find(address);
+    BOOST_REQUIRE(record);
+    BOOST_CHECK_EQUAL(record->label, "PCIE1");
+    BOOST_CHECK_EQUAL(record->handle, 0x0900u);
+
+    BOOST_REQUIRE(parse_pci_address("0000:3c:00.0", address));
+    BOOST_CHECK(!map.find(address));
+}
+
+/// BMC interfaces: KCS with 4-byte register spacing, SSIF and Redfish host interface
+BOOST_AUTO_TEST_CASE(SMBiosManagementControllersTestCase)
+{
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66,
+                               0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::IpmiDevice, 0x2600, test::ipmi_device(IpmiDeviceEntry::InterfaceKCS, 0xCA3, 0x40 | 0x10, 0))
+        .add(SMBios::IpmiDevice, 0x2601, test::ipmi_device(IpmiDeviceEntry::InterfaceSSIF, 0x20, 0x00, 0))
+        .add(SMBios::ManagementHostInterface, 0x2A00, test::redfish_host_interface(uuid, "bmc.local"));
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const auto ipmi = smbios.entries_of_type<IpmiDeviceEntry>();
+    BOOST_REQUIRE_EQUAL(ipmi.size(), 2u);
+    BOOST_CHECK_EQUAL(ipmi[0]->get_interface_type_string(), "KCS");
+    BOOST_CHECK_EQUAL(ipmi[0]->get_specification_major(), 2u);
+    BOOST_CHECK(ipmi[0]->is_io_space());
+    BOOST_CHECK_EQUAL(ipmi[0]->get_base_address(), 0xCA3u);
+    BOOST_CHECK_EQUAL(ipmi[0]->get_register_spacing(), 4u);
+    BOOST_CHECK_EQUAL(ipmi[1]->get_base_address(), 0x10u);
+
+    const auto host_interfaces = smbios.entries_of_type<ManagementHostInterfaceEntry>();
+    BOOST_REQUIRE_EQUAL(host_interfaces.size(), 1u);
+    BOOST_CHECK_EQUAL(host_interfaces[0]->get_interface_type(), ManagementHostInterfaceEntry::InterfaceNetwork);
+    BOOST_CHECK_EQUAL(host_interfaces[0]->get_network_device_type(), ManagementHostInterfaceEntry::DevicePciNetwork);
+    BOOST_REQUIRE_EQUAL(host_interfaces[0]->get_protocol_records().size(), 1u);
+
+    const ManagementControllers& controllers = smbios.management_controllers();
+    BOOST_REQUIRE_EQUAL(controllers.ipmi_interfaces.size(), 2u);
+    BOOST_CHECK_EQUAL(controllers.ipmi_interfaces[1].interface_type, IpmiDeviceEntry::InterfaceSSIF);
+    BOOST_REQUIRE_EQUAL(controllers.host_interfaces.size(), 1u);
+    BOOST_REQUIRE_EQUAL(controllers.host_interfaces[0].redfish_services.size(), 1u);
+
+    const RedfishOverIpRecord& redfish = controllers.host_interfaces[0].redfish_services[0];
+    BOOST_CHECK_EQUAL(format_uuid(redfish.service_uuid), "00112233-4455-6677-8899-AABBCCDDEEFF");
+    BOOST_CHECK_EQUAL(format_ip_address(redfish.host_ip_address_format, redfish.host_ip_address), "169.254.0.2");
+    BOOST_CHECK_EQUAL(format_ip_address(redfish.service_ip_address_format, redfish.service_ip_address), "169.254.0.1");
+    BOOST_CHECK_EQUAL(format_ip_address(redfish.service_ip_address_format, redfish.service_ip_mask), "255.255.0.0");
+    BOOST_CHECK_EQUAL(redfish.service_ip_port, 443u);
+    BOOST_CHECK_EQUAL(redfish.service_hostname, "bmc.local");
+
+    // protocol records are not defined before 3.0
+    const ManagementHostInterfaceEntry legacy(smbios.get_headers()[3], SMBiosVersion{ 2, 8 });
+    BOOST_CHECK_EQUAL(legacy.get_interface_type(), ManagementHostInterfaceEntry::InterfaceNetwork);
+    BOOST_CHECK(legacy.get_protocol_records().empty());
+}
+
+/// EDAC DIMMs are matched by ghes label, device locator suffix and then table order
+BOOST_AUTO_TEST_CASE(SMBiosEdacCorrelationTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x80000000, 5, uint64_t(1) << 40))
+        .add(SMBios::MemoryDevice, 0x0100, test::memory_device_v28(0x0010, 16384, 3200), { "DIMM_A1", "P0 CHANNEL A", "Vendor", "0001", "Tag", "PN" })
+        .add(SMBios::MemoryDevice, 0x0101, test::memory_device_v28(0x0010, 16384, 3200), { "DIMM_B1", "P0 CHANNEL B", "Vendor", "0002", "Tag", "PN" })
+        .add(SMBios::MemoryDevice, 0x0102, test::memory_device_v28(0x0010, 16384, 3200), { "DIMM_A1", "P1 CHANNEL A", "Vendor", "0003", "Tag", "PN" })
+        .add(SMBios::MemoryDevice, 0x0103, test::memory_device_v28(0x0010, 0, 0), { "DIMM_B1", "P1 CHANNEL B", "None", "None", "Tag", "PN" })
+        .add(SMBios::MemoryDevice, 0x0104, test::memory_device_v28(0x0010, 0x7FFF, 3200, 32768), { "DIMM_C1", "P1 CHANNEL C", "Vendor", "0005", "Tag", "PN" });
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    test::SysfsFixture sysfs;
+    sysfs.add_edac_dimm(0, 0, "P0 CHANNEL A DIMM_A1", 16384);
+    sysfs.add_edac_dimm(0, 1, "CPU_SrcID#0_MC#0_Chan#1_DIMM#0", 16384);
+    sysfs.add_edac_dimm(1, 0, "CPU1_DIMM_C1", 32768);
+    sysfs.add_edac_dimm(1, 1, "mc#1memory#1", 16384);
+    sysfs.write("mc/power/control", "auto");
+    sysfs.write("mc/mc1/rank5/size", "0");
+    sysfs.write("mc/mc7", "not a controller directory");
+
+    BOOST_CHECK(read_edac_dimms(sysfs.path("absent")).empty());
+
+    const std::vector<EdacDimm> dimms = read_edac_dimms(sysfs.path("mc"));
+    BOOST_REQUIRE_EQUAL(dimms.size(), 4u);
+    BOOST_CHECK_EQUAL(dimms[2].controller, 1u);
+    BOOST_CHECK_EQUAL(dimms[2].label, "CPU1_DIMM_C1");
+    BOOST_CHECK_EQUAL(dimms[2].size_mb, 32768u);
+
+    const EdacCorrelation correlation(smbios, dimms);
+    BOOST_CHECK_EQUAL(correlation.get_matched_count(), 4u);
+    BOOST_CHECK_EQUAL(correlation.get_header_index(0), 1u);
+    BOOST_CHECK(correlation.get_match(0) == EdacMatch::BankAndDeviceLocator);
+    BOOST_CHECK_EQUAL(correlation.get_header_index(2), 5u);
+    BOOST_CHECK(correlation.get_match(2) == EdacMatch::DeviceLocator);
+    BOOST_CHECK_EQUAL(correlation.get_header_index(1), 2u);
+    BOOST_CHECK_EQUAL(correlation.get_header_index(3), 3u);
+    BOOST_CHECK(correlation.get_match(3) == EdacMatch::TableOrder);
+    BOOST_CHECK_THROW(correlation.get_header_index(4), std::out_of_range);
+
+    // polls read counters only
+    std::vector<EdacCounters> counters;
+    correlation.read_counters(counters);
+    BOOST_REQUIRE_EQUAL(counters.size(), 4u);
+    BOOST_CHECK_EQUAL(counters[2].corrected, 0u);
+
+    sysfs.set_edac_counters(1, 0, 17, 1);
+    correlation.read_counters(counters);
+    BOOST_CHECK_EQUAL(counters[2].corrected, 17u);
+    BOOST_CHECK_EQUAL(counters[2].uncorrected, 1u);
+
+    const MemoryDeviceView failing(smbios.get_headers()[correlation.get_header_index(2)], smbios.get_smbios_version());
+    BOOST_CHECK_EQUAL(failing.get_serial_number_string(), "0005");
+
+    // sizes disagree: table order is not trusted
+    test::SysfsFixture mismatch;
+    mismatch.add_edac_dimm(0, 0, "mc#0memory#0", 8192);
+    mismatch.add_edac_dimm(0, 1, "mc#0memory#1", 16384);
+    mismatch.add_edac_dimm(0, 2, "mc#0memory#2", 16384);
+    mismatch.add_edac_dimm(0, 3, "mc#0memory#3", 32768);
+    const EdacCorrelation unmatched(smbios, read_edac_dimms(mismatch.path("mc")));
+    BOOST_CHECK_EQUAL(unmatched.get_matched_count(), 0u);
+    BOOST_CHECK(unmatched.get_header_index(0) == EdacCorrelation::npos);
+}
+
+/// Vendor locators are recognized into numeric coordinates
+BOOST_AUTO_TEST_CASE(SMBiosDimmLocatorTestCase)
+{
+    const DimmLocatorParser parser;
+    DimmCoordinates coordinates;
+
+    BOOST_REQUIRE(parser.parse("CPU1_DIMM_A2", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+    BOOST_CHECK_EQUAL(coordinates.channel, 0u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 2u);
+
+    BOOST_REQUIRE(parser.parse("DIMM 1", "P0 CHANNEL B", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 0u);
+    BOOST_CHECK_EQUAL(coordinates.channel, 1u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 1u);
+
+    BOOST_REQUIRE(parser.parse("ChannelC-DIMM0", "BANK 2", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, DimmCoordinates::unknown);
+    BOOST_CHECK_EQUAL(coordinates.channel, 2u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 0u);
+
+    BOOST_REQUIRE(parser.parse("P2-DIMMF1", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 2u);
+    BOOST_CHECK_EQUAL(coordinates.channel, 5u);
+
+    BOOST_REQUIRE(parser.parse("CPU0_CHANNEL12_DIMM1", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.channel, 12u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 1u);
+
+    BOOST_REQUIRE(parser.parse("PROC 1 DIMM 12", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+    BOOST_CHECK_EQUAL(coordinates.channel, DimmCoordinates::unknown);
+    BOOST_CHECK_EQUAL(coordinates.slot, 12u);
+
+    BOOST_REQUIRE(parser.parse("P0 CHANNEL B DIMM 1", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 0u);
+    BOOST_CHECK_EQUAL(coordinates.channel, 1u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 1u);
+
+    // numeric slot, not channel 1 slot 2
+    BOOST_REQUIRE(parser.parse("CPU1 DIMM 12", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+    BOOST_CHECK_EQUAL(coordinates.channel, DimmCoordinates::unknown);
+    BOOST_CHECK_EQUAL(coordinates.slot, 12u);
+
+    BOOST_REQUIRE(parser.parse("CPU1 DIMM 1", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+    BOOST_CHECK_EQUAL(coordinates.channel, DimmCoordinates::unknown);
+    BOOST_CHECK_EQUAL(coordinates.slot, 1u);
+
+    // shorter digit runs are tried when the longest one fails the rest of the pattern
+    DimmCoordinates split;
+    BOOST_REQUIRE(match_locator_pattern("CPU{s}{d}", "CPU112", split));
+    BOOST_CHECK_EQUAL(split.socket, 11u);
+    BOOST_CHECK_EQUAL(split.slot, 2u);
+
+    BOOST_REQUIRE(parser.parse("DIMM_A1", "NODE 1", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+    BOOST_REQUIRE(parser.parse("b3", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.channel, 1u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 3u);
+
+    // failed parse keeps the previous value
+    BOOST_CHECK(!parser.parse("Not Specified", "", coordinates));
+    BOOST_CHECK(!parser.parse("CPU1_DIMM_A", "", coordinates));
+    BOOST_CHECK(!parser.parse("CPU999_DIMM_A1", "", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.slot, 3u);
+
+    // vendor pattern goes before built-in ones
+    DimmLocatorParser vendor_parser;
+    vendor_parser.add_pattern({ "XMM{d}", "SOCKET {s} MC {c}" });
+    BOOST_REQUIRE(vendor_parser.parse("XMM7", "SOCKET 1 MC 3", coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+    BOOST_CHECK_EQUAL(coordinates.channel, 3u);
+    BOOST_CHECK_EQUAL(coordinates.slot, 7u);
+    BOOST_CHECK(!parser.parse("XMM7", "SOCKET 1 MC 3", coordinates));
+    BOOST_CHECK_THROW(vendor_parser.add_pattern({ "DIMM{x}", "" }), std::invalid_argument);
+    BOOST_CHECK_THROW(vendor_parser.add_pattern({ "DIMM{d", "" }), std::invalid_argument);
+    BOOST_CHECK_THROW(vendor_parser.add_pattern({ "", "" }), std::invalid_argument);
+
+    const DimmLocatorParser own_parser(std::vector<DimmLocatorPattern>{ { "SLOT{d}", "" } });
+    BOOST_CHECK(own_parser.parse("SLOT4", "", coordinates));
+    BOOST_CHECK(!own_parser.parse("CPU1_DIMM_A2", "", coordinates));
+
+    // locators of the table structures
+    test::SyntheticTable table;
+    table.add(SMBios::MemoryDevice, 0x0100, test::memory_device_v28(0xFFFE, 16384, 3200), { "DIMM 0", "P1 CHANNEL D", "Vendor", "0001", "Tag", "PN" });
+    const SMBios smbios(table.build(), test::make_basic_version());
+    const auto views = smbios.view_all<MemoryDeviceView>();
+    BOOST_REQUIRE(parser.parse(views[0], coordinates));
+    BOOST_CHECK_EQUAL(coordinates.channel, 3u);
+    const auto entries = smbios.entries_of_type<MemoryDeviceEntry>();
+    BOOST_REQUIRE(parser.parse(*entries[0], coordinates));
+    BOOST_CHECK_EQUAL(coordinates.socket, 1u);
+}
+
+/// Buffer formatting is the same as std::ostream defaults, entries render the same text both ways
+BOOST_AUTO_TEST_CASE(SMBiosRenderBufferTestCase)
+{
+    RenderBuffer out;
+    out << 0u << ' ' << 7u << ' ' << 10u << ' ' << 99u << ' ' << 100u << ' ' << 4294967295u << ' '
+        << uint64_t(18446744073709551615ull) << ' ' << -1 << ' ' << int64_t(-9223372036854775807ll - 1);
+    BOOST_CHECK_EQUAL(out.view(), "0 7 10 99 100 4294967295 18446744073709551615 -1 -9223372036854775808");
+
+    out.clear();
+    BOOST_CHECK(out.empty());
+    out << hex(0) << ' ' << hex(0x1F) << ' ' << hex(0xFFFFFFFFFFFFFFFFull) << ' '
+        << hex_digits(0x0A, 2) << ' ' << hex_digits(0, 4) << ' ' << hex_digits(0x12345, 2);
+    BOOST_CHECK_EQUAL(out.view(), "0 0x1f 0xffffffffffffffff 0a 0000 12345");
+
+    // uint8_t and uint16_t are numbers, char is a symbol
+    out.clear();
+    out << uint8_t(65) << ' ' << uint16_t(65) << ' ' << 'A' << ' ' << std::string("text") << ' ' << boost::string_view("view");
+    BOOST_CHECK_EQUAL(out.view(), "65 65 A text view");
+
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+
+    // the second pass reuses the capacity of the first one
+    RenderBuffer table_buffer;
+    const char* first_pass_data = nullptr;
+    for (size_t pass = 0; pass < 2; ++pass) {
+        table_buffer.clear();
+        std::string expected;
+        // the last structure is OEM-specific, there is no entry for it
+        for (size_t i = 0; i < 4; ++i) {
+            const AbstractSMBiosEntry* entry = smbios.entry(i);
+            BOOST_REQUIRE(entry);
+            const size_t begin = table_buffer.size();
+            entry->render_to(table_buffer);
+            BOOST_CHECK_EQUAL(table_buffer.view().substr(begin), entry->render_to_description());
+            expected += entry->render_to_description();
+        }
+        BOOST_CHECK_EQUAL(table_buffer.str(), expected);
+        if (pass == 0) {
+            first_pass_data = table_buffer.data();
+        }
+    }
+    BOOST_CHECK_EQUAL(static_cast<const void*>(table_buffer.data()), static_cast<const void*>(first_pass_data));
+
+    // value model renders the same text
+    SMBiosEntryFactory smbios_factory;
+    RenderBuffer variant_buffer;
+    for (const SMBiosEntryVariant& entry : smbios_factory.create_all(smbios)) {
+        const size_t begin = variant_buffer.size();
+        boost::apply_visitor(RenderToVisitor(variant_buffer), entry);
+        BOOST_CHECK_EQUAL(variant_buffer.view().substr(begin), boost::apply_visitor(RenderVisitor(), entry));
+    }
+}
+
+/// JSON writer escaping and separators, the whole table is valid JSON
+BOOST_AUTO_TEST_CASE(SMBiosJsonTestCase)
+{
+    RenderBuffer out;
+    append_json_string(out, boost::string_view("a\"b\\c\n\t\x01\x1f\x7f\xc3\xa9", 12));
+    BOOST_CHECK_EQUAL(out.view(), "\"a\\\"b\\\\c\\n\\t\\u0001\\u001f\x7f\xc3\xa9\"");
+
+    // Latin-1 'Café' and malformed UTF-8: stray continuation, truncated, overlong, surrogate
+    out.clear();
+    append_json_string(out, "Caf\xe9");
+    BOOST_CHECK_EQUAL(out.view(), "\"Caf\\u00e9\"");
+    out.clear();
+    append_json_string(out, "\x80|\xe2\x82|\xc0\xaf|\xed\xa0\x80|\xe2\x82\xac\xf0\x9f\x98\x80");
+    BOOST_CHECK_EQUAL(out.view(),
+        "\"\\u0080|\\u00e2\\u0082|\\u00c0\\u00af|\\u00ed\\u00a0\\u0080|\xe2\x82\xac\xf0\x9f\x98\x80\"");
+
+    out.clear();
+    JsonWriter writer(out);
+    writer.begin_object();
+    writer.key("empty").begin_array().end_array();
+    writer.key("list").begin_array().number(1).boolean(true).null().begin_object().end_object().string("x").end_array();
+    writer.key(boost::string_view("runtime \"key\"")).number(18446744073709551615ull);
+    const uint8_t bytes[] = { 0x00, 0x0A, 0xFF };
+    writer.key("bytes").hex_bytes(bytes, sizeof(bytes));
+    writer.end_object();
+    BOOST_CHECK_EQUAL(out.view(),
+        "{\"empty\":[],\"list\":[1,true,null,{},\"x\"],\"runtime \\\"key\\\"\":18446744073709551615,\"bytes\":\"000aff\"}");
+
+    // field names are JSON keys, they should be unique within the structure
+    for (uint8_t type = 0; type < 0x80; ++type) {
+        const StructureSchema* schema = find_structure_schema(type);
+        if (!schema) {
+            continue;
+        }
+        for (size_t i = 0; i < schema->fields_count; ++i) {
+            for (size_t j = i + 1; j < schema->fields_count; ++j) {
+                BOOST_CHECK_MESSAGE(std::strcmp(schema->fields[i].name, schema->fields[j].name) != 0,
+                    schema->name << ": " << schema->fields[i].name);
+            }
+        }
+    }
+
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66,
+        0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor \"Q\"", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid), { "Maker", "Product", "V1", "SER-1", "SKU", "Family" })
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400), { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(0x80, 0x0080, test::StructureBuilder().u32(0xDEADBEEF));
+    SMBios smbios(table.build(), test::make_basic_version());
+
+    const std::string json = render_json(smbios);
+    BOOST_CHECK_EQUAL(json.back(), '\n');
+
+    std::istringstream json_stream(json);
+    boost::property_tree::ptree document;
+    BOOST_REQUIRE_NO_THROW(boost::property_tree::read_json(json_stream, document));
+    BOOST_CHECK_EQUAL(document.get<unsigned>("version.major"), 3u);
+    BOOST_CHECK_EQUAL(document.get<unsigned>("version.minor"), 2u);
+    BOOST_CHECK_EQUAL(document.get<std::string>("entry_point"), "null");
+
+    std::vector<boost::property_tree::ptree> structures;
+    for (const auto& structure : document.get_child("structures")) {
+        structures.push_back(structure.second);
+    }
+    BOOST_REQUIRE_EQUAL(structures.size(), smbios.get_headers().size());
+
+    BOOST_CHECK_EQUAL(structures[0].get<std::string>("name"), "BIOS Information");
+    BOOST_CHECK_EQUAL(structures[0].get<std::string>("fields.Vendor"), "Vendor \"Q\"");
+    BOOST_CHECK_EQUAL(structures[0].get_child("strings").size(), 3u);
+    BOOST_CHECK(!structures[0].get_child("fields.Characteristics").empty());
+
+    BOOST_CHECK_EQUAL(structures[1].get<unsigned>("handle"), 1u);
+    BOOST_CHECK_EQUAL(structures[1].get<std::string>("fields.UUID"), "33221100554477668899aabbccddeeff");
+    BOOST_CHECK_EQUAL(structures[1].get<std::string>("fields.Serial Number"), "SER-1");
+
+    BOOST_CHECK_EQUAL(structures[2].get<unsigned>("fields.Size"), 8192u);
+    BOOST_CHECK_EQUAL(structures[2].get<std::string>("fields.Locator"), "DIMM_A1");
+
+    BOOST_CHECK_EQUAL(structures[3].get<std::string>("name"), "OEM-specific");
+    BOOST_CHECK(!structures[3].get_child_optional("fields"));
+    BOOST_CHECK_EQUAL(structures[3].get_child("strings").size(), 0u);
+
+    // single structure is the same object as in the whole table
+    RenderBuffer structure_buffer;
+    JsonWriter structure_writer(structure_buffer);
+    render_structure_json(smbios.get_headers()[2], smbios.get_smbios_version(), structure_writer);
+    BOOST_CHECK(json.find(structure_buffer.str()) != std::string::npos);
+}
+
+namespace {
+
+/// Decoded message kept as text, one entry per structure
+struct CollectingVisitor : CborMessageVisitor {
+    struct Structure {
+        uint16_t handle;
+        uint8_t type;
+        bool has_schema;
+        std::vector<std::string> strings;
+        std::map<std::string, std::string> fields;
+    };
+
+    SMBiosVersion version{ 0, 0 };
+    uint64_t table_size = 0;
+    std::string host;
+    size_t tables = 0;
+    std::vector<Structure> structures;
+
+    void table(const SMBiosVersion& table_version, uint64_t size, boost::string_view table_host) override
+    {
+        version = table_version;
+        table_size = size;
+        host = table_host.to_string();
+        ++tables;
+    }
+
+    void begin_structure(const MessageStructure& structure) override
+    {
+        Structure decoded{ structure.handle, structure.type, structure.schema != nullptr, {}, {} };
+        for (size_t i = 0; i < structure.strings_count; ++i) {
+            decoded.strings.push_back(structure.strings[i].to_string());
+        }
+        structures.push_back(decoded);
+    }
+
+    void field(const MessageStructure& /*structure*/, const MessageField& field) override
+    {
+        BOOST_REQUIRE(field.schema);
+        std::string value;
+        if (!field.text.empty()) {
+            value = field.text.to_string();
+        }
+        else if (CborType::Bytes == field.value.type) {
+            RenderBuffer hex;
+            for (size_t i = 0; i < field.value.value; ++i) {
+                hex << hex_digits(field.value.data[i], 2);
+            }
+            value = hex.str();
+        }
+        else {
+            value = std::to_string(field.value.value);
+        }
+        structures.back().fields[field.schema->name] = value;
+    }
+};
+
+std::string to_hex(const RenderBuffer& buffer)
+{
+    RenderBuffer hex;
+    for (char byte : buffer.view()) {
+        hex << hex_digits(static_cast<uint8_t>(byte), 2);
+    }
+    return hex.str();
+}
+
+} // namespace
+
+/// Items are encoded in the shortest form (RFC 8949 appendix A), decoded back and the message round trips
+BOOST_AUTO_TEST_CASE(SMBiosCborTestCase)
+{
+    RenderBuffer out;
+    CborWriter writer(out);
+    writer.number(0).number(23).number(24).number(100).number(1000).number(1000000).number(1000000000000ull)
+        .number(18446744073709551615ull);
+    BOOST_CHECK_EQUAL(to_hex(out), "0017181818641903e81a000f42401b000000e8d4a510001bffffffffffffffff");
+
+    out.clear();
+    const uint8_t bytes[] = { 0x01, 0x02, 0x03, 0x04 };
+    writer.string("").string("IETF").bytes(bytes, sizeof(bytes)).boolean(false).boolean(true).null();
+    writer.begin_array(0).begin_array(3).number(1).number(2).number(3).begin_map(0);
+    writer.begin_array().number(1).end().begin_map().number(1).string("a").end();
+    BOOST_CHECK_EQUAL(to_hex(out), "6064494554464401020304f4f5f68083010203a09f01ffbf016161ff");
+
+    // pull parser returns heads, strings refer to the input
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(out.data());
+    CborReader reader(data, out.size());
+    BOOST_CHECK(reader.next().text().empty());
+    const CborItem ietf = reader.next();
+    BOOST_CHECK(CborType::Text == ietf.type);
+    BOOST_CHECK_EQUAL(ietf.text(), "IETF");
+    const CborItem byte_string = reader.next();
+    BOOST_CHECK(CborType::Bytes == byte_string.type);
+    BOOST_CHECK(std::equal(bytes, bytes + sizeof(bytes), byte_string.data));
+    BOOST_CHECK_EQUAL(reader.next().value, cbor_false);
+    BOOST_CHECK_EQUAL(reader.next().value, cbor_true);
+    BOOST_CHECK_EQUAL(reader.next().value, cbor_null);
+    reader.skip(reader.next());
+    const CborItem array = reader.next();
+    BOOST_CHECK(CborType::Array == array.type && 3 == array.value && !array.indefinite);
+    reader.skip(array);
+    reader.skip(reader.next());
+    const CborItem indefinite = reader.next();
+    BOOST_CHECK(CborType::Array == indefinite.type && indefinite.indefinite);
+    reader.skip(indefinite);
+    reader.skip(reader.next());
+    BOOST_CHECK(reader.at_end());
+    BOOST_CHECK_THROW(reader.next(), std::runtime_error);
+
+    // truncated argument and string, reserved additional information, indefinite string
+    const uint8_t malformed[][3] = { { 0x19, 0x03, 0x00 }, { 0x63, 0x61, 0x62 }, { 0x1C, 0x00, 0x00 }, { 0x7F, 0x61, 0x61 } };
+    const size_t malformed_sizes[] = { 2, 3, 1, 3 };
+    for (size_t i = 0; i < 4; ++i) {
+        CborReader broken(malformed[i], malformed_sizes[i]);
+        BOOST_CHECK_THROW(broken.next(), std::runtime_error);
+    }
+    std::vector<uint8_t> nested(CborReader::max_depth + 1, 0x81);
+    nested.push_back(0x00);
+    CborReader nested_reader(nested.data(), nested.size());
+    BOOST_CHECK_THROW(nested_reader.skip(nested_reader.next()), std::runtime_error);
+
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66,
+        0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor \"Q\"", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid), { "Maker", "Product", "V1", "SER-1", "SKU", "Family" })
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400), { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(0x80, 0x0080, test::StructureBuilder().u32(0xDEADBEEF));
+    SMBios smbios(table.build(), test::make_basic_version());
+
+    // two hosts in one sequence, the buffer is reused
+    out.clear();
+    render_cbor(smbios, "host-1", out);
+    const size_t first_size = out.size();
+    render_cbor(smbios, "", out);
+    BOOST_CHECK(first_size < render_json(smbios).size() / 2);
+
+    data = reinterpret_cast<const uint8_t*>(out.data());
+    CollectingVisitor first;
+    BOOST_REQUIRE_EQUAL(decode_cbor_message(data, out.size(), first), first_size);
+    CollectingVisitor second;
+    BOOST_CHECK_EQUAL(decode_cbor_message(data + first_size, out.size() - first_size, second), out.size() - first_size);
+    BOOST_CHECK_EQUAL(second.host, "");
+    BOOST_CHECK_EQUAL(second.structures.size(), first.structures.size());
+
+    BOOST_CHECK_EQUAL(first.tables, 1u);
+    BOOST_CHECK_EQUAL(first.version.major_version, 3u);
+    BOOST_CHECK_EQUAL(first.version.minor_version, 2u);
+    BOOST_CHECK_EQUAL(first.table_size, smbios.get_table_size());
+    BOOST_CHECK_EQUAL(first.host, "host-1");
+    BOOST_REQUIRE_EQUAL(first.structures.size(), smbios.get_headers().size());
+
+    const CollectingVisitor::Structure& bios = first.structures[0];
+    BOOST_CHECK_EQUAL(bios.fields.at("Vendor"), "Vendor \"Q\"");
+    BOOST_CHECK_EQUAL(bios.strings.size(), 3u);
+    BOOST_CHECK(bios.fields.count("Characteristics"));
+
+    const CollectingVisitor::Structure& system = first.structures[1];
+    BOOST_CHECK_EQUAL(system.handle, 1u);
+    BOOST_CHECK_EQUAL(system.fields.at("UUID"), "33221100554477668899aabbccddeeff");
+    BOOST_CHECK_EQUAL(system.fields.at("Serial Number"), "SER-1");
+    BOOST_CHECK_EQUAL(system.fields.at("Wake-up Type"), "Power Switch");
+
+    BOOST_CHECK_EQUAL(first.structures[2].fields.at("Size"), "8192");
+    BOOST_CHECK_EQUAL(first.structures[2].fields.at("Locator"), "DIMM_A1");
+
+    BOOST_CHECK_EQUAL(first.structures[3].type, 0x80);
+    BOOST_CHECK(!first.structures[3].has_schema);
+    BOOST_CHECK(first.structures[3].fields.empty());
+    BOOST_CHECK(first.structures[3].strings.empty());
+
+    // every truncation of the message is detected
+    for (size_t size = 0; size < first_size; ++size) {
+        CollectingVisitor truncated;
+        BOOST_CHECK_THROW(decode_cbor_message(data, size, truncated), std::runtime_error);
+    }
+
+    // unknown keys are skipped, keys out of order are rejected
+    out.clear();
+    writer.begin_map(3).number(1).number(100).number(7).begin_array(1).begin_map().end().number(9).string("x");
+    CollectingVisitor unknown;
+    BOOST_CHECK_EQUAL(decode_cbor_message(reinterpret_cast<const uint8_t*>(out.data()), out.size(), unknown), out.size());
+    BOOST_CHECK_EQUAL(unknown.tables, 1u);
+    BOOST_CHECK_EQUAL(unknown.table_size, 100u);
+    out.clear();
+    writer.begin_map(2).number(1).number(100).number(0).begin_array(2).number(3).number(2);
+    BOOST_CHECK_THROW(decode_cbor_message(reinterpret_cast<const uint8_t*>(out.data()), out.size(), unknown), std::runtime_error);
+}
+
+/// Columns of several hosts are read back from the serialized file by type and name
+BOOST_AUTO_TEST_CASE(SMBiosColumnarExportTestCase)
+{
+    BOOST_CHECK_EQUAL(column_name("Bank Locator"), "bank_locator");
+    BOOST_CHECK_EQUAL(column_name("BIOS Starting Address Segment"), "bios_starting_address_segment");
+    BOOST_CHECK_EQUAL(column_name("Error Information Handle (64-bit)"), "error_information_handle_64_bit");
+
+    test::SyntheticTable first_table;
+    first_table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < 10; ++dimm) {
+        first_table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm),
+            test::memory_device_v28(0x1000, dimm % 2 ? 16384 : 0, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+    }
+    const SMBios first(first_table.build(), test::make_basic_version());
+
+    // older table: memory device fields of 2.3+ are not there
+    test::SyntheticTable second_table;
+    second_table.add(SMBios::MemoryDevice, 0x2000, test::memory_device_v28(0x1000, 8192, 2400),
+        { "DIMM_A1", "BANK 1", "Other", "SN-X", "Tag", "PN-2" });
+    second_table.add(0x80, 0x0080, test::StructureBuilder().u32(0xDEADBEEF));
+    const SMBios second(second_table.build(), SMBiosVersion{ 2, 1 });
+
+    ColumnarExporter exporter;
+    exporter.add_table(first, std::string("host-1"));
+    exporter.add_table(second, std::string("host-2"));
+    BOOST_CHECK_EQUAL(exporter.get_rows(SMBios::MemoryDevice), 11u);
+    BOOST_CHECK_EQUAL(exporter.get_rows(SMBios::BIOSInformation), 1u);
+    BOOST_CHECK_EQUAL(exporter.get_rows(SMBios::ProcessorInformation), 0u);
+
+    const std::vector<uint8_t> file = exporter.serialize();
+    const ColumnarReader reader(file.data(), file.size());
+    BOOST_CHECK(reader.get_columns_count() > 0);
+
+    const ColumnView size = reader.find_column(SMBios::MemoryDevice, "size");
+    BOOST_REQUIRE(size.valid());
+    BOOST_CHECK(size.get_kind() == ColumnKind::Number);
+    BOOST_CHECK_EQUAL(size.get_width(), 2u);
+    BOOST_REQUIRE_EQUAL(size.get_rows(), 11u);
+    BOOST_CHECK_EQUAL(size.get_number(0), 0u);
+    BOOST_CHECK_EQUAL(size.get_number(1), 16384u);
+    BOOST_CHECK_EQUAL(size.get_number(10), 8192u);
+
+    const ColumnView locator = reader.find_column(SMBios::MemoryDevice, "locator");
+    BOOST_REQUIRE(locator.valid());
+    BOOST_CHECK(locator.get_kind() == ColumnKind::String);
+    BOOST_CHECK_EQUAL(locator.get_string(3), "DIMM_3");
+    BOOST_CHECK_EQUAL(locator.get_string(10), "DIMM_A1");
+
+    const ColumnView bank = reader.find_column(SMBios::MemoryDevice, "bank_locator");
+    BOOST_REQUIRE(bank.valid());
+    BOOST_CHECK_EQUAL(bank.get_dictionary_size(), 2u);
+
+    const ColumnView host = reader.find_column(SMBios::MemoryDevice, "host");
+    BOOST_REQUIRE(host.valid());
+    BOOST_CHECK_EQUAL(host.get_string(0), "host-1");
+    BOOST_CHECK_EQUAL(host.get_string(10), "host-2");
+    BOOST_CHECK_EQUAL(host.get_dictionary_size(), 2u);
+
+    // 2.3 field is absent in 2.1 table
+    const ColumnView manufacturer = reader.find_column(SMBios::MemoryDevice, "manufacturer");
+    BOOST_REQUIRE(manufacturer.valid());
+    BOOST_CHECK(manufacturer.has_value(0));
+    BOOST_CHECK(!manufacturer.has_value(10));
+    BOOST_CHECK_EQUAL(manufacturer.get_string(10), "");
+    const ColumnView speed = reader.find_column(SMBios::MemoryDevice, "speed");
+    BOOST_CHECK_EQUAL(speed.get_number(0), 3200u);
+    BOOST_CHECK(!speed.has_value(10));
+
+    const ColumnView handle = reader.find_column(SMBios::MemoryDevice, "handle");
+    BOOST_CHECK_EQUAL(handle.get_number(9), 0x1109u);
+
+    // OEM structures have only common columns
+    BOOST_CHECK(reader.find_column(0x80, "length").valid());
+    BOOST_CHECK_EQUAL(reader.find_column(0x80, "length").get_number(0), 8u);
+    BOOST_CHECK(!reader.find_column(0x80, "size").valid());
+    BOOST_CHECK(!reader.find_column(SMBios::ProcessorInformation, "host").valid());
+
+    // malformed files
+    BOOST_CHECK_THROW(ColumnarReader(file.data(), 10), std::runtime_error);
+    std::vector<uint8_t> broken = file;
+    broken[broken.size() - 16] = 0xFF;
+    broken[broken.size() - 10] = 0xFF;
+    BOOST_CHECK_THROW(ColumnarReader(broken.data(), broken.size()), std::runtime_error);
+
+    // rows out of range have no value
+    BOOST_CHECK(!size.has_value(11));
+    BOOST_CHECK_EQUAL(size.get_number(11), 0u);
+    BOOST_CHECK(size.get_bytes(11) == nullptr);
+    BOOST_CHECK_EQUAL(locator.get_string(0xFFFFFFFF), "");
+
+    // dictionary offset before the last one is corrupted, code 0 is the string of the first row
+    const size_t characters = reinterpret_cast<const uint8_t*>(locator.get_string(0).data()) - file.data();
+    const size_t second_offset = characters - (static_cast<size_t>(locator.get_dictionary_size()) + 1) * 4 + 4;
+    std::vector<uint8_t> corrupted = file;
+    corrupted[second_offset + 3] = 0x80;
+    const ColumnarReader corrupted_reader(corrupted.data(), corrupted.size());
+    BOOST_CHECK_THROW(corrupted_reader.find_column(SMBios::MemoryDevice, "locator"), std::runtime_error);
+    BOOST_CHECK(corrupted_reader.find_column(SMBios::MemoryDevice, "size").valid());
+}
+
+/// One row per structure of the type, text escaped for CSV and TSV
+BOOST_AUTO_TEST_CASE(SMBiosCsvExportTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(SMBios::MemoryDevice, 0x0012, test::memory_device_v28(0x0010, 0, 0),
+            { "A,\"1\"", "BANK\t1", "Vendor", "0002", "Tag", "PN\\2" })
+        .add(0x80, 0x0080, test::StructureBuilder().u32(0xDEADBEEF));
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    RenderBuffer out;
+    const CsvExporter csv(SMBios::MemoryDevice, DelimitedFormat::Csv, false);
+    csv.render_header(out);
+    BOOST_CHECK_EQUAL(csv.render_rows(smbios, "ignored", out), 2u);
+
+    std::vector<std::string> lines;
+    boost::split(lines, out.str(), boost::is_any_of("\n"));
+    BOOST_REQUIRE_EQUAL(lines.size(), 4u);
+    BOOST_CHECK(lines[3].empty());
+    BOOST_CHECK(boost::starts_with(lines[0], "handle,length,array_handle,error_information_handle,total_width,"
+        "data_width,size,form_factor,set,locator,bank_locator,type,type_detail,speed,"));
+    BOOST_CHECK(boost::starts_with(lines[1], "17,40,16,65534,72,64,8192,DIMM,0,DIMM_A1,BANK 0,DDR4,Synchronous,2400,"
+        "Vendor,0001,Tag,PN-1,2,0,2400,1200,1200,1200,"));
+    // 3.2 fields are beyond the structure length
+    BOOST_CHECK(boost::ends_with(lines[1], "1200,,,,,,,,,,,,,"));
+    BOOST_CHECK(boost::starts_with(lines[2], "18,40,16,65534,72,64,0,DIMM,0,\"A,\"\"1\"\"\",BANK\t1,"));
+    BOOST_CHECK_EQUAL(std::count(lines[0].begin(), lines[0].end(), ','), std::count(lines[1].begin(), lines[1].end(), ','));
+
+    out.clear();
+    const CsvExporter tsv(SMBios::MemoryDevice, DelimitedFormat::Tsv, true);
+    tsv.render_header(out);
+    tsv.render_rows(smbios, "host\t1", out);
+    boost::split(lines, out.str(), boost::is_any_of("\n"));
+    BOOST_REQUIRE_EQUAL(lines.size(), 4u);
+    BOOST_CHECK(boost::starts_with(lines[0], "host\thandle\tlength\t"));
+    BOOST_CHECK(boost::starts_with(lines[2], "host\\t1\t18\t40\t"));
+    BOOST_CHECK(boost::contains(lines[2], "\tA,\"1\"\tBANK\\t1\t"));
+    BOOST_CHECK(boost::contains(lines[2], "\tPN\\\\2\t"));
+    BOOST_CHECK(boost::ends_with(lines[2], "\t\\N"));
+
+    // structures without schema have common columns only
+    out.clear();
+    const CsvExporter oem(0x80, DelimitedFormat::Csv, false);
+    oem.render_header(out);
+    BOOST_CHECK_EQUAL(oem.render_rows(smbios, "", out), 1u);
+    BOOST_CHECK_EQUAL(out.str(), "handle,length\n128,8\n");
+
+    out.clear();
+    BOOST_CHECK_EQUAL(CsvExporter(SMBios::ProcessorInformation, DelimitedFormat::Csv, true).render_rows(smbios, "", out), 0u);
+    BOOST_CHECK_EQUAL(out.size(), 0u);
+}
+
+/// Raw table and dmidecode binary dumps are read from files
+BOOST_AUTO_TEST_CASE(SMBiosTableDumpTestCase)
+{
+    const std::vector<uint8_t> table = test::make_basic_table();
+
+    // raw table takes the provided version
+    const TableDump raw = parse_table_dump(table, SMBiosVersion{ 2, 8 });
+    BOOST_CHECK(raw.table == table);
+    BOOST_CHECK_EQUAL(raw.version.major_version, 2u);
+    BOOST_CHECK_EQUAL(raw.version.minor_version, 8u);
+
+    // dmidecode --dump-bin: 64-bit entry point, table at 20h
+    std::vector<uint8_t> image(0x20, 0);
+    const uint8_t anchor[] = { '_', 'S', 'M', '3', '_' };
+    std::copy(std::begin(anchor), std::end(anchor), image.begin());
+    image[0x06] = 0x18;
+    image[0x07] = 3;
+    image[0x08] = 4;
+    image[0x0C] = static_cast<uint8_t>(table.size() + 0x100);
+    image[0x0D] = static_cast<uint8_t>((table.size() + 0x100) >> 8);
+    image[0x10] = 0x20;
+    image.insert(image.end(), table.begin(), table.end());
+
+    const TableDump dmidecode = parse_table_dump(image);
+    BOOST_CHECK(dmidecode.table == table);
+    BOOST_CHECK_EQUAL(dmidecode.version.major_version, 3u);
+    BOOST_CHECK_EQUAL(dmidecode.version.minor_version, 4u);
+
+    std::vector<uint8_t> outside = image;
+    outside[0x10] = 0xF0;
+    outside[0x11] = 0xFF;
+    BOOST_CHECK_THROW(parse_table_dump(outside), std::runtime_error);
+    BOOST_CHECK_THROW(parse_table_dump(std::vector<uint8_t>(image.begin(), image.begin() + 0x10)), std::runtime_error);
+
+    test::SysfsFixture dumps;
+    std::ofstream(dumps.path("host-b.bin"), std::ios::binary).write(reinterpret_cast<const char*>(image.data()), image.size());
+    std::ofstream(dumps.path("host-a.bin"), std::ios::binary).write(reinterpret_cast<const char*>(table.data()), table.size());
+    dumps.write("nested/host-c.bin", "");
+    // status of the self-referencing link could not be read, it is skipped
+    boost::filesystem::create_symlink(dumps.path("loop.bin"), dumps.path("loop.bin"));
+
+    const std::vector<std::string> paths = list_table_dumps(dumps.path());
+    BOOST_REQUIRE_EQUAL(paths.size(), 2u);
+    BOOST_CHECK(boost::ends_with(paths[0], "host-a.bin"));
+    BOOST_CHECK(boost::ends_with(paths[1], "host-b.bin"));
+
+    const TableDump from_file = read_table_dump(paths[1]);
+    BOOST_CHECK(from_file.table == table);
+    const SMBios smbios(read_table_dump(paths[0]).table, raw_dump_version);
+    BOOST_CHECK_EQUAL(smbios.get_structures_count(), SMBios(table, test::make_basic_version()).get_structures_count());
+
+    BOOST_CHECK_THROW(read_table_dump(dumps.path("absent.bin")), std::runtime_error);
+    BOOST_CHECK_THROW(list_table_dumps(paths[0]), std::runtime_error);
+
+    // dumps are untrusted: the header claims more than the file has
+    const std::vector<uint8_t> short_header = { 0x01, 0x1B, 0x01, 0x00, 0x00, 0x00, 0x00 };
+    const SMBios short_table(short_header, raw_dump_version);
+    BOOST_CHECK_EQUAL(short_table.get_structures_count(), 0u);
+    BOOST_CHECK(short_table.get_headers().empty());
+
+    // string section without \0\0 at the end of the dump
+    const uint8_t uuid[16] = {};
+    std::vector<uint8_t> unterminated = test::SyntheticTable()
+        .add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid), { "Maker" })
+        .build();
+    unterminated.resize(unterminated.size() - 7);
+    BOOST_REQUIRE_EQUAL(unterminated.back(), 0u);
+    const SMBios unterminated_table(unterminated, raw_dump_version);
+    BOOST_CHECK_EQUAL(unterminated_table.get_structures_count(), 1u);
+    BOOST_REQUIRE_EQUAL(unterminated_table.get_headers().size(), 1u);
+    BOOST_CHECK_EQUAL(unterminated_table.get_headers()[0].type, SMBios::BIOSInformation);
+
+    // every structure taken from a truncated table ends inside it
+    for (size_t size = 0; size <= table.size(); ++size) {
+        const std::vector<uint8_t> truncated(table.begin(), table.begin() + size);
+        const SMBios truncated_table(truncated, raw_dump_version);
+        const uint8_t* const truncated_end = truncated_table.get_table_base() + truncated_table.get_table_size();
+        for (const DMIHeader& header : truncated_table.get_headers()) {
+            const uint8_t* strings_end = header.data + header.length;
+            BOOST_REQUIRE(strings_end <= truncated_end);
+            while (strings_end + 1 < truncated_end && (strings_end[0] != 0 || strings_end[1] != 0)) {
+                ++strings_end;
+            }
+            BOOST_CHECK(strings_end + 1 < truncated_end);
+        }
+    }
+}
+
+/// Only selected fields are decoded, strings are the same as find_dmi_string() gives
+BOOST_AUTO_TEST_CASE(SMBiosProjectionTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN 1" })
+        .add(SMBios::MemoryDevice, 0x0012, test::memory_device_v28(0x0010, 0, 0),
+            { "DIMM_A2", "BANK 1", "Vendor", "0002", "Tag", "PN=\"2\"" })
+        .add(0x80, 0x0080, test::StructureBuilder().u32(0xDEADBEEF));
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    const Projection projection("type17.size, type17.part_number,type0.vendor,type17.type_detail,type17.firmware_version");
+    BOOST_REQUIRE_EQUAL(projection.get_fields().size(), 5u);
+    // grouped by type, selection order kept within the type
+    BOOST_CHECK_EQUAL(projection.get_fields()[0].name, "vendor");
+    BOOST_CHECK_EQUAL(projection.get_fields()[1].name, "size");
+    BOOST_CHECK_EQUAL(projection.get_fields()[2].name, "part_number");
+    BOOST_CHECK(projection.selects(SMBios::MemoryDevice));
+    BOOST_CHECK(!projection.selects(SMBios::PortConnection));
+    BOOST_CHECK(!projection.selects(0x80));
+
+    std::vector<ProjectedValue> values;
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    projection.extract(headers[1], smbios.get_smbios_version(), values);
+    BOOST_REQUIRE_EQUAL(values.size(), 4u);
+    BOOST_CHECK(values[0].present);
+    BOOST_CHECK_EQUAL(values[0].decoded.value, 8192u);
+    BOOST_CHECK_EQUAL(values[1].decoded.text, "PN 1");
+    BOOST_CHECK_EQUAL(values[1].decoded.text, find_dmi_string(headers[1].data, headers[1].length, 6));
+    BOOST_CHECK_EQUAL(values[2].decoded.value, 0x80u);
+    // 3.2 field is beyond the structure length
+    BOOST_CHECK(!values[3].present);
+
+    projection.extract(headers[3], smbios.get_smbios_version(), values);
+    BOOST_CHECK(values.empty());
+
+    RenderBuffer out;
+    projection.render_to(smbios, out);
+    BOOST_CHECK_EQUAL(out.str(),
+        "handle=0x0000 type=0 vendor=Vendor\n"
+        "handle=0x0011 type=17 size=8192 part_number=\"PN 1\" type_detail=Synchronous\n"
+        "handle=0x0012 type=17 size=0 part_number=\"PN=\\\"2\\\"\" type_detail=Synchronous\n");
+
+    out.clear();
+    Projection("type17.size,type17.firmware_version").render_json(smbios, out);
+    BOOST_CHECK_EQUAL(out.str(),
+        "[{\"handle\":17,\"type\":17,\"size\":8192,\"firmware_version\":null},"
+        "{\"handle\":18,\"type\":17,\"size\":0,\"firmware_version\":null}]\n");
+
+    BOOST_CHECK_THROW(Projection(""), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection(" , "), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection("type17"), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection("type17."), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection("type.size"), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection("type256.size"), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection("type17.device_size"), std::invalid_argument);
+    BOOST_CHECK_THROW(Projection("type128.size"), std::invalid_argument);
+}
+
+/// Chunks are sealed at row boundaries and written by single call
+BOOST_AUTO_TEST_CASE(SMBiosVectoredOutputTestCase)
+{
+    std::FILE* file = std::tmpfile();
+    BOOST_REQUIRE(file);
+
+    std::string expected;
+    {
+        VectoredOutput output(fileno(file), 100, 1000);
+        for (size_t line = 0; line < 50; ++line) {
+            const std::string text = "line " + std::to_string(line) + " of the output\n";
+            output.buffer() << text;
+            expected += text;
+            output.commit();
+        }
+        BOOST_CHECK_EQUAL(output.get_write_calls(), 0u);
+
+        output.flush();
+        BOOST_CHECK_EQUAL(output.get_write_calls(), 1u);
+        BOOST_CHECK_EQUAL(output.get_bytes_written(), expected.size());
+
+        // nothing pending
+        output.flush();
+        BOOST_CHECK_EQUAL(output.get_write_calls(), 1u);
+
+        // pending text is written by destructor
+        output.buffer() << "tail\n";
+        expected += "tail\n";
+    }
+
+    // too many chunks are flushed by commit
+    {
+        VectoredOutput output(fileno(file), 10, 3);
+        for (size_t line = 0; line < 9; ++line) {
+            output.buffer() << "0123456789\n";
+            expected += "0123456789\n";
+            output.commit();
+        }
+        BOOST_CHECK_EQUAL(output.get_write_calls(), 3u);
+        BOOST_CHECK_EQUAL(output.get_bytes_written(), 99u);
+    }
+
+    std::rewind(file);
+    std::string written(expected.size() + 1, '\0');
+    written.resize(std::fread(&written[0], 1, written.size(), file));
+    std::fclose(file);
+    BOOST_CHECK_EQUAL(written, expected);
+
+    VectoredOutput closed(-1);
+    closed.buffer() << "lost";
+    BOOST_CHECK_THROW(closed.flush(), std::runtime_error);
+    BOOST_CHECK_NO_THROW(closed.flush());
+}
+
+/// Rendered tables are found by content key in memory, then on disk
+BOOST_AUTO_TEST_CASE(SMBiosRenderCacheTestCase)
+{
+    // MurmurHash3_x64_128 reference values (smhasher implementation, seed 0): h1 is low, h2 is high
+    const std::string fox = "The quick brown fox jumps over the lazy dog";
+    const RenderKey fox_key = hash128(fox.data(), fox.size());
+    BOOST_CHECK_EQUAL(fox_key.low, 0xe34bbc7bbc071b6cull);
+    BOOST_CHECK_EQUAL(fox_key.high, 0x7a433ca9c49a9347ull);
+    BOOST_CHECK_EQUAL(fox_key.to_string(), "7a433ca9c49a9347e34bbc7bbc071b6c");
+    BOOST_CHECK(hash128("", 0) == (RenderKey{ 0, 0 }));
+
+    std::vector<uint8_t> table = test::make_basic_table();
+    const RenderKey key = make_render_key(table.data(), table.size(), test::make_basic_version(), "json");
+    BOOST_CHECK(key == make_render_key(table.data(), table.size(), test::make_basic_version(), "json"));
+    BOOST_CHECK(key != make_render_key(table.data(), table.size(), test::make_basic_version(), "text"));
+    BOOST_CHECK(key != make_render_key(table.data(), table.size(), SMBiosVersion{ 3, 1 }, "json"));
+    // entries of older renderers are not found
+    BOOST_CHECK(key == make_render_key(table.data(), table.size(), test::make_basic_version(), "json", render_format_version));
+    BOOST_CHECK(key != make_render_key(table.data(), table.size(), test::make_basic_version(), "json", render_format_version - 1));
+    table[10] ^= 1;
+    BOOST_CHECK(key != make_render_key(table.data(), table.size(), test::make_basic_version(), "json"));
+
+    // LRU limited by text size
+    RenderCache memory(10);
+    RenderBuffer out;
+    BOOST_CHECK(!memory.find(RenderKey{ 1, 0 }, out));
+    memory.put(RenderKey{ 1, 0 }, "aaaa");
+    memory.put(RenderKey{ 2, 0 }, "bbbb");
+    BOOST_CHECK(memory.find(RenderKey{ 1, 0 }, out));
+    memory.put(RenderKey{ 3, 0 }, "cccc");
+    BOOST_CHECK_EQUAL(memory.get_entries_count(), 2u);
+    BOOST_CHECK_EQUAL(memory.get_bytes(), 8u);
+    BOOST_CHECK(memory.find(RenderKey{ 1, 0 }, out));
+    BOOST_CHECK(!memory.find(RenderKey{ 2, 0 }, out));
+    memory.put(RenderKey{ 4, 0 }, "too long for the cache");
+    BOOST_CHECK(!memory.find(RenderKey{ 4, 0 }, out));
+    BOOST_CHECK_EQUAL(out.str(), "aaaaaaaa");
+    BOOST_CHECK_EQUAL(memory.get_hits(), 2u);
+    BOOST_CHECK_EQUAL(memory.get_misses(), 3u);
+
+    // render callback is called on miss only
+    size_t renders = 0;
+    auto render = [&renders](RenderBuffer& target) {
+        ++renders;
+        target << "rendered";
+    };
+    out.clear();
+    out << "prefix ";
+    BOOST_CHECK(!memory.render(RenderKey{ 5, 0 }, out, render));
+    BOOST_CHECK(memory.render(RenderKey{ 5, 0 }, out, render));
+    BOOST_CHECK_EQUAL(renders, 1u);
+    BOOST_CHECK_EQUAL(out.str(), "prefix renderedrendered");
+
+    // disk backing survives the process cache
+    test::SysfsFixture directory;
+    {
+        RenderCache disk(1024, directory.path("cache"));
+        disk.put(key, "cached text");
+        disk.put(RenderKey{ 6, 0 }, std::string(2000, 'x'));
+    }
+    RenderCache disk(1024, directory.path("cache"));
+    out.clear();
+    BOOST_CHECK(disk.find(key, out));
+    BOOST_CHECK_EQUAL(out.str(), "cached text");
+    BOOST_CHECK_EQUAL(disk.get_entries_count(), 1u);
+    out.clear();
+    BOOST_CHECK(disk.find(RenderKey{ 6, 0 }, out));
+    BOOST_CHECK_EQUAL(out.size(), 2000u);
+    BOOST_CHECK_EQUAL(disk.get_entries_count(), 1u);
+
+    // truncated file is a miss
+    directory.write("cache/" + RenderKey{ 7, 0 }.to_string() + ".render", "SMRC\x10");
+    BOOST_CHECK(!disk.find(RenderKey{ 7, 0 }, out));
+}
+
+/// Layout, wording and units of dmidecode, -t and -s selections
+BOOST_AUTO_TEST_CASE(SMBiosDmidecodeTestCase)
+{
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid),
+            { "Maker", "Server", "Rev A", "SYS-1", "SKU-1", "Family" })
+        .add(SMBios::BaseboardInformation, 0x0002, test::baseboard_v24(0x0003),
+            { "Maker", "Board", "Rev B", "BRD-1", "Tag", "Slot 0" })
+        .add(SMBios::SystemEnclosure, 0x0003, test::chassis_v21(), { "Maker", "Rev C", "CHS-1", "Tag" })
+        .add(SMBios::ProcessorInformation, 0x0004, test::processor_v30(0x0005, 0xFFFF, 0xFFFF, 24, 48),
+            { "CPU0", "Intel(R) Corporation", "Intel(R) Xeon(R) Gold", "SN", "AT", "PN" })
+        .add(SMBios::CacheInformation, 0x0005, test::cache_v31(1, 1536), { "L1 - Cache" })
+        .add(SMBios::OemStrings, 0x0006, test::string_list(2), { "Build 42", "Line\x01" })
+        .add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x80000000, 2, 0x100000000000ull))
+        .add(SMBios::MemoryDevice, 0x0011, test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(SMBios::MemoryDevice, 0x0012, test::memory_device_v28(0x0010, 0, 0),
+            { "DIMM_A2", "BANK 1", "Vendor", "0002", "Tag", "PN-2" })
+        .add(SMBios::MemoryArrayMappedAddress, 0x0013, test::memory_array_mapped_address_v27(0, 0x7FFFFF, 0x0010))
+        .add(SMBios::MemoryDeviceMappedAddress, 0x0014, test::memory_device_mapped_address_v27(0, 0x7FFFFF, 0x0011, 0x0013))
+        .add(SMBios::SystemBootInformation, 0x0020, test::StructureBuilder().u32(0).u16(0).u8(0))
+        .add(0x80, 0x0080, test::StructureBuilder().u32(0xDEADBEEF), { "OEM" });
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    RenderBuffer out;
+    render_dmidecode(smbios, DmidecodeTypes(), out);
+    const std::string text = out.str();
+    BOOST_CHECK(boost::starts_with(text, "# smbios_util dmidecode-compatible output\nSMBIOS 3.2.0 present.\n\nHandle 0x0000, DMI type 0, 24 bytes\n"));
+    BOOST_CHECK(boost::ends_with(text, "\nHandle 0xFEFF, DMI type 127, 4 bytes\nEnd Of Table\n\n"));
+
+    BOOST_CHECK(boost::contains(text, "\tAddress: 0xE8000\n\tRuntime Size: 96 kB\n\tROM Size: 8 MB\n\tCharacteristics:\n\t\tPCI is supported\n"));
+    BOOST_CHECK(boost::contains(text, "\t\tUEFI is supported\n\tBIOS Revision: 4.6\n\n"));
+    BOOST_CHECK(boost::contains(text, "\tUUID: 00112233-4455-6677-8899-AABBCCDDEEFF\n\tWake-up Type: Power Switch\n"));
+    BOOST_CHECK(boost::contains(text, "\tFeatures:\n\t\tBoard is a hosting board\n\tLocation In Chassis: Slot 0\n\tChassis Handle: 0x0003\n\tType: Motherboard\n"));
+    BOOST_CHECK(boost::contains(text, "\tType: Rack Mount Chassis\n\tLock: Present\n"));
+    BOOST_CHECK(boost::contains(text, "\tBoot-up State: Safe\n"));
+    BOOST_CHECK(boost::contains(text, "\tFamily: Xeon\n\tManufacturer: Intel(R) Corporation\n\tID: 54 06 05 00 FF FB EB BF\n"
+        "\tSignature: Type 0, Family 6, Model 85, Stepping 4\n\tFlags:\n\t\tFPU (Floating-point unit on-chip)\n"));
+    BOOST_CHECK(boost::contains(text, "\tVoltage: 1.8 V\n\tExternal Clock: 100 MHz\n\tMax Speed: 4000 MHz\n\tCurrent Speed: 2100 MHz\n"
+        "\tStatus: Populated, Enabled\n"));
+    BOOST_CHECK(boost::contains(text, "\tL1 Cache Handle: 0x0005\n\tL2 Cache Handle: Not Provided\n"));
+    BOOST_CHECK(boost::contains(text, "\tCore Count: 24\n\tCore Enabled: 24\n\tThread Count: 48\n\tCharacteristics:\n\t\t64-bit capable\n"));
+    BOOST_CHECK(boost::contains(text, "\tConfiguration: Enabled, Not Socketed, Level 1\n\tOperational Mode: Write Back\n"
+        "\tLocation: Internal\n\tInstalled Size: 1536 kB\n"));
+    BOOST_CHECK(boost::contains(text, "\tString 1: Build 42\n\tString 2: Line.\n"));
+    BOOST_CHECK(boost::contains(text, "\tMaximum Capacity: 16 TB\n"));
+    BOOST_CHECK(boost::contains(text, "\tStarting Address: 0x00000000000\n\tEnding Address: 0x001FFFFFFFF\n\tRange Size: 8 GB\n"));
+    BOOST_CHECK(boost::contains(text, "\tStatus: No errors detected\n"));
+    BOOST_CHECK(boost::contains(text, "OEM-specific Type\n\tHeader and Data:\n\t\t80 08 80 00 EF BE AD DE\n"
+        "\tStrings:\n\t\t4F 45 4D 00\n\t\t\"OEM\"\n\n"));
+
+    // populated slot is printed completely, empty one stops after the type detail
+    BOOST_CHECK(boost::contains(text,
+        "Handle 0x0011, DMI type 17, 40 bytes\n"
+        "Memory Device\n"
+        "\tArray Handle: 0x0010\n"
+        "\tError Information Handle: Not Provided\n"
+        "\tTotal Width: 72 bits\n"
+        "\tData Width: 64 bits\n"
+        "\tSize: 8 GB\n"
+        "\tForm Factor: DIMM\n"
+        "\tSet: None\n"
+        "\tLocator: DIMM_A1\n"
+        "\tBank Locator: BANK 0\n"
+        "\tType: DDR4\n"
+        "\tType Detail: Synchronous\n"
+        "\tSpeed: 2400 MT/s\n"
+        "\tManufacturer: Vendor\n"
+        "\tSerial Number: 0001\n"
+        "\tAsset Tag: Tag\n"
+        "\tPart Number: PN-1\n"
+        "\tRank: 2\n"
+        "\tConfigured Memory Speed: 2400 MT/s\n"
+        "\tMinimum Voltage: 1.2 V\n"
+        "\tMaximum Voltage: 1.2 V\n"
+        "\tConfigured Voltage: 1.2 V\n"
+        "\n"));
+    BOOST_CHECK(boost::contains(text, "\tSize: No Module Installed\n"));
+    BOOST_CHECK(boost::contains(text, "\tType Detail: Synchronous\n\nHandle 0x0013"));
+
+    // -t memory: arrays and devices only, no end-of-table
+    out.clear();
+    render_dmidecode(smbios, parse_dmidecode_types("memory"), out);
+    const std::string memory = out.str();
+    BOOST_CHECK(boost::contains(memory, "DMI type 16,"));
+    BOOST_CHECK(boost::contains(memory, "Handle 0x0012, DMI type 17,"));
+    BOOST_CHECK(!boost::contains(memory, "DMI type 0,"));
+    BOOST_CHECK(!boost::contains(memory, "DMI type 19,"));
+    BOOST_CHECK(!boost::contains(memory, "End Of Table"));
+
+    const DmidecodeTypes types = parse_dmidecode_types("bios, 0x11,127");
+    BOOST_CHECK(types.test(0) && types.test(13) && types.test(17) && types.test(127));
+    BOOST_CHECK_EQUAL(types.count(), 4u);
+    BOOST_CHECK(parse_dmidecode_types("Processor").test(4));
+    BOOST_CHECK_THROW(parse_dmidecode_types("256"), std::invalid_argument);
+    BOOST_CHECK_THROW(parse_dmidecode_types("dimm"), std::invalid_argument);
+    BOOST_CHECK_THROW(parse_dmidecode_types(","), std::invalid_argument);
+
+    // -s: bare values, one per structure
+    auto keyword = [&smbios](boost::string_view name) {
+        RenderBuffer value;
+        render_dmidecode_string(smbios, name, value);
+        return value.str();
+    };
+    BOOST_CHECK_EQUAL(keyword("bios-vendor"), "Test Vendor\n");
+    BOOST_CHECK_EQUAL(keyword("bios-revision"), "4.6\n");
+    BOOST_CHECK_EQUAL(keyword("firmware-revision"), "");
+    BOOST_CHECK_EQUAL(keyword("system-serial-number"), "SYS-1\n");
+    BOOST_CHECK_EQUAL(keyword("system-uuid"), "00112233-4455-6677-8899-AABBCCDDEEFF\n");
+    BOOST_CHECK_EQUAL(keyword("Chassis-Type"), "Rack Mount Chassis\n");
+    BOOST_CHECK_EQUAL(keyword("processor-family"), "Xeon\n");
+    BOOST_CHECK_EQUAL(keyword("processor-frequency"), "2100 MHz\n");
+    BOOST_CHECK(is_dmidecode_keyword("baseboard-asset-tag"));
+    BOOST_CHECK(!is_dmidecode_keyword("memory-size"));
+    BOOST_CHECK_THROW(keyword("memory-size"), std::invalid_argument);
+
+    // 2.x entry point has the structures count, UUID bytes are in the table order
+    const SMBios legacy(table.build(), SMBiosVersion{ 2, 5 });
+    out.clear();
+    render_dmidecode(legacy, DmidecodeTypes().set(SMBios::SystemInformation), out);
+    BOOST_CHECK(boost::starts_with(out.str(), "# smbios_util dmidecode-compatible output\nSMBIOS 2.5 present.\n\nHandle 0x0001"));
+    BOOST_CHECK(boost::contains(out.str(), "\tUUID: 33221100-5544-7766-8899-AABBCCDDEEFF\n"));
+    out.clear();
+    render_dmidecode(legacy, DmidecodeTypes(), out);
+    BOOST_CHECK(boost::contains(out.str(), "SMBIOS 2.5 present.\n15 structures occupying "));
+}
+
+/// Chunks rendered on worker threads are concatenated in table order
+BOOST_AUTO_TEST_CASE(SMBiosParallelRenderTestCase)
+{
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < 1000; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 8192, 2400),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+        table.add(SMBios::PortConnection, static_cast<uint16_t>(0x2100 + dimm), test::port_connection(), { "J" + std::to_string(dimm), "COM A" });
+        table.add(0x80, static_cast<uint16_t>(0x3100 + dimm), test::StructureBuilder().u32(dimm));
+    }
+    const std::vector<uint8_t> dump = table.build();
+
+    RenderBuffer serial;
+    render_structures(SMBios(dump, test::make_basic_version()), serial, 1);
+    BOOST_CHECK(boost::starts_with(serial.str(), "Header ID = 0\n"));
+
+    // fresh table for every run, so that the entries are decoded concurrently too
+    for (size_t threads : { 2, 3, 8, 0 }) {
+        RenderBuffer parallel;
+        render_structures(SMBios(dump, test::make_basic_version()), parallel, threads);
+        BOOST_CHECK_EQUAL(parallel.size(), serial.size());
+        BOOST_CHECK(parallel.view() == serial.view());
+    }
+
+    // uneven chunks, the last one is short
+    auto render_index = [](size_t header_index, RenderBuffer& out) {
+        out << header_index << ',';
+    };
+    RenderBuffer expected;
+    for (size_t i = 0; i < 1001; ++i) {
+        render_index(i, expected);
+    }
+    for (size_t chunk_size : { 1, 7, 64, 5000 }) {
+        RenderBuffer ordered;
+        ordered << "prefix ";
+        render_ordered(1001, 4, ordered, render_index, chunk_size);
+        BOOST_CHECK(ordered.view() == "prefix " + expected.str());
+    }
+
+    RenderBuffer empty;
+    render_ordered(0, 4, empty, render_index);
+    BOOST_CHECK(empty.empty());
+
+    RenderBuffer failed;
+    BOOST_CHECK_THROW(render_ordered(1000, 4, failed, [](size_t header_index, RenderBuffer& out) {
+        if (header_index == 500) {
+            throw std::runtime_error("broken structure");
+        }
+        out << header_index;
+    }, 16), std::runtime_error);
+    BOOST_CHECK(failed.empty());
+
+    // serial rendering keeps the previous content and drops the partial output
+    RenderBuffer failed_serially;
+    failed_serially << "prefix ";
+    BOOST_CHECK_THROW(render_ordered(1000, 1, failed_serially, [](size_t header_index, RenderBuffer& out) {
+        if (header_index == 500) {
+            throw std::runtime_error("broken structure");
+        }
+        out << header_index;
+    }), std::runtime_error);
+    BOOST_CHECK(failed_serially.view() == "prefix ");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,300 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <smbios/smbios.h>
+
+// Raw SMBIOS tables composed in memory, so that tests do not depend
+// on the firmware of the machine they run on
+
+namespace smbios {
+namespace test {
+
+/// @brief Little-endian writer for the formatted area of a structure
+class StructureBuilder {
+public:
+
+    StructureBuilder& u8(uint8_t value)
+    {
+        bytes_.push_back(value);
+        return *this;
+    }
+
+    StructureBuilder& u16(uint16_t value)
+    {
+        return u8(value & 0xFF).u8(value >> 8);
+    }
+
+    StructureBuilder& u32(uint32_t value)
+    {
+        return u16(value & 0xFFFF).u16(value >> 16);
+    }
+
+    StructureBuilder& u64(uint64_t value)
+    {
+        return u32(value & 0xFFFFFFFF).u32(value >> 32);
+    }
+
+    const std::vector<uint8_t>& bytes() const
+    {
+        return bytes_;
+    }
+
+private:
+    std::vector<uint8_t> bytes_;
+};
+
+/// @brief Compose a table from structures, end-of-table marker is added by build()
+class SyntheticTable {
+public:
+
+    /// Add structure, formatted area should not include the 4-byte header
+    SyntheticTable& add(uint8_t type, uint16_t handle, const StructureBuilder& formatted,
+        const std::vector<std::string>& strings = {})
+    {
+        const std::vector<uint8_t>& body = formatted.bytes();
+        table_.push_back(type);
+        table_.push_back(static_cast<uint8_t>(body.size() + 4));
+        table_.push_back(handle & 0xFF);
+        table_.push_back(handle >> 8);
+        table_.insert(table_.end(), body.begin(), body.end());
+
+        for (const std::string& str : strings) {
+            table_.insert(table_.end(), str.begin(), str.end());
+            table_.push_back(0);
+        }
+        if (strings.empty()) {
+            table_.push_back(0);
+        }
+        table_.push_back(0);
+        return *this;
+    }
+
+    /// Raw table with end-of-table structure
+    std::vector<uint8_t> build() const
+    {
+        std::vector<uint8_t> table = table_;
+        const uint8_t end_of_table[] = { SMBios::EndOfTable, 4, 0xFF, 0xFE, 0, 0 };
+        table.insert(table.end(), std::begin(end_of_table), std::end(end_of_table));
+        return table;
+    }
+
+private:
+    std::vector<uint8_t> table_;
+};
+
+/// @brief BIOS Information 2.4+ structure, strings: vendor, version, release date
+inline StructureBuilder bios_information_v24()
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(2).u16(0xE800).u8(3).u8(0x7F)
+        .u64(0x0000000000010880ull)
+        .u8(0x03).u8(0x0D)
+        .u8(4).u8(6).u8(0xFF).u8(0xFF);
+    return builder;
+}
+
+/// @brief Port Connection structure, strings: internal and external designators
+inline StructureBuilder port_connection()
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(0x00).u8(2).u8(0x08).u8(0x09);
+    return builder;
+}
+
+/// @brief Memory Device 2.8+ structure
+/// strings: device locator, bank locator, manufacturer, serial number, asset tag, part number
+inline StructureBuilder memory_device_v28(uint16_t array_handle, uint16_t size_mb, uint16_t speed,
+    uint32_t extended_size_mb = 0)
+{
+    StructureBuilder builder;
+    builder.u16(array_handle).u16(0xFFFE).u16(72).u16(64).u16(size_mb)
+        .u8(0x09).u8(0x00).u8(1).u8(2).u8(0x1A).u16(0x0080)
+        .u16(speed).u8(3).u8(4).u8(5).u8(6)
+        .u8(2)
+        .u32(extended_size_mb).u16(speed)
+        .u16(1200).u16(1200).u16(1200);
+    return builder;
+}
+
+/// @brief System Information 2.4+ structure
+/// strings: manufacturer, product name, version, serial number, SKU, family
+inline StructureBuilder system_information_v24(const uint8_t (&uuid)[16])
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(2).u8(3).u8(4);
+    for (uint8_t byte : uuid) {
+        builder.u8(byte);
+    }
+    builder.u8(0x06).u8(5).u8(6);
+    return builder;
+}
+
+/// @brief Baseboard Information structure, motherboard without contained handles
+/// strings: manufacturer, product, version, serial number, asset tag, location in chassis
+inline StructureBuilder baseboard_v24(uint16_t chassis_handle)
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(2).u8(3).u8(4).u8(5).u8(0x01).u8(6).u16(chassis_handle).u8(0x0A).u8(0);
+    return builder;
+}
+
+/// @brief System Slots 2.6+ structure, PCI Express x16 slot in use
+/// strings: slot designation
+inline StructureBuilder system_slot_v26(uint16_t slot_id, uint16_t segment, uint8_t bus, uint8_t device_function)
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(0xB6).u8(0x0D).u8(0x04).u8(0x04).u16(slot_id).u8(0x0C).u8(0x01)
+        .u16(segment).u8(bus).u8(device_function);
+    return builder;
+}
+
+/// @brief Onboard Devices Extended Information structure, enabled device
+/// strings: reference designation
+inline StructureBuilder onboard_device_v26(uint8_t type, uint8_t instance,
+    uint16_t segment, uint8_t bus, uint8_t device_function)
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(0x80 | type).u8(instance).u16(segment).u8(bus).u8(device_function);
+    return builder;
+}
+
+/// @brief IPMI Device Information structure with base address modifier, IPMI 2.0
+inline StructureBuilder ipmi_device(uint8_t interface_type, uint64_t base_address, uint8_t modifier, uint8_t interrupt)
+{
+    StructureBuilder builder;
+    builder.u8(interface_type).u8(0x20).u8(0x20).u8(0xFF).u64(base_address).u8(modifier).u8(interrupt);
+    return builder;
+}
+
+/// @brief Management Controller Host Interface 3.0+ structure, PCI network device
+/// with one Redfish over IP record: host 169.254.0.2, service 169.254.0.1:443
+inline StructureBuilder redfish_host_interface(const uint8_t (&service_uuid)[16], const std::string& hostname)
+{
+    StructureBuilder builder;
+    builder.u8(0x40).u8(9).u8(0x03).u16(0x8086).u16(0x1234).u16(0x8086).u16(0x0001);
+    builder.u8(1).u8(0x04).u8(static_cast<uint8_t>(91 + hostname.size()));
+    for (uint8_t byte : service_uuid) {
+        builder.u8(byte);
+    }
+    const uint8_t host_ip[] = { 169, 254, 0, 2 };
+    const uint8_t service_ip[] = { 169, 254, 0, 1 };
+    const uint8_t mask[] = { 255, 255, 0, 0 };
+    for (const uint8_t* address : { host_ip, service_ip }) {
+        builder.u8(0x01).u8(0x01);
+        for (size_t i = 0; i < 16; ++i) {
+            builder.u8(i < 4 ? address[i] : 0);
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            builder.u8(i < 4 ? mask[i] : 0);
+        }
+    }
+    builder.u16(443).u32(0).u8(static_cast<uint8_t>(hostname.size()));
+    for (char c : hostname) {
+        builder.u8(static_cast<uint8_t>(c));
+    }
+    return builder;
+}
+
+/// @brief OEM Strings or System Configuration Options structure, only strings count
+inline StructureBuilder string_list(uint8_t count)
+{
+    StructureBuilder builder;
+    builder.u8(count);
+    return builder;
+}
+
+/// @brief Chassis Information 2.1 structure, locked rack mount chassis
+/// strings: manufacturer, version, serial number, asset tag
+inline StructureBuilder chassis_v21()
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(0x80 | 0x17).u8(2).u8(3).u8(4)
+        .u8(0x03).u8(0x03).u8(0x03).u8(0x03);
+    return builder;
+}
+
+/// @brief Physical Memory Array 2.7+ structure on the motherboard, system memory by default
+/// max_capacity_kb 80000000h selects the extended capacity in bytes
+inline StructureBuilder physical_memory_array_v27(uint32_t max_capacity_kb, uint16_t devices,
+    uint64_t extended_capacity = 0, uint8_t use = 0x03)
+{
+    StructureBuilder builder;
+    builder.u8(0x03).u8(use).u8(0x06).u32(max_capacity_kb).u16(0xFFFE).u16(devices)
+        .u64(extended_capacity);
+    return builder;
+}
+
+/// @brief Processor Information 3.0+ structure
+/// strings: socket designation, manufacturer, version, serial number, asset tag, part number
+inline StructureBuilder processor_v30(uint16_t l1_handle, uint16_t l2_handle, uint16_t l3_handle,
+    uint16_t cores, uint16_t threads, uint8_t status = 0x41)
+{
+    StructureBuilder builder;
+    builder.u8(1).u8(0x03).u8(0xB3).u8(2).u64(0xBFEBFBFF00050654ull).u8(3)
+        .u8(0x80 | 18).u16(100).u16(4000).u16(2100).u8(status).u8(0x36)
+        .u16(l1_handle).u16(l2_handle).u16(l3_handle)
+        .u8(4).u8(5).u8(6)
+        .u8(cores > 0xFF ? 0xFF : cores).u8(cores > 0xFF ? 0xFF : cores).u8(threads > 0xFF ? 0xFF : threads)
+        .u16(0x00FC).u16(0xB3)
+        .u16(cores).u16(cores).u16(threads);
+    return builder;
+}
+
+/// @brief Cache Information 3.1+ structure, enabled write-back cache of the level 1..8
+/// strings: socket designation
+inline StructureBuilder cache_v31(uint8_t level, uint32_t installed_kb)
+{
+    // 16-bit sizes are in 1K granularity below 32 MB, then in 64K
+    const uint16_t size16 = installed_kb < 0x8000 ? uint16_t(installed_kb) : uint16_t(0x8000 | (installed_kb >> 6));
+    StructureBuilder builder;
+    builder.u8(1).u16(uint16_t(0x0180 | (level - 1))).u16(size16).u16(size16)
+        .u16(0x0020).u16(0x0020).u8(0).u8(0x05).u8(0x05).u8(0x08)
+        .u32(installed_kb).u32(installed_kb);
+    return builder;
+}
+
+/// @brief Memory Array Mapped Address 2.7+ structure, starting_kb FFFFFFFFh selects extended range
+inline StructureBuilder memory_array_mapped_address_v27(uint32_t starting_kb, uint32_t ending_kb,
+    uint16_t array_handle, uint64_t extended_starting = 0, uint64_t extended_ending = 0)
+{
+    StructureBuilder builder;
+    builder.u32(starting_kb).u32(ending_kb).u16(array_handle).u8(1)
+        .u64(extended_starting).u64(extended_ending);
+    return builder;
+}
+
+/// @brief Memory Device Mapped Address 2.7+ structure, starting_kb FFFFFFFFh selects extended range
+inline StructureBuilder memory_device_mapped_address_v27(uint32_t starting_kb, uint32_t ending_kb,
+    uint16_t device_handle, uint16_t array_range_handle, uint64_t extended_starting = 0, uint64_t extended_ending = 0)
+{
+    StructureBuilder builder;
+    builder.u32(starting_kb).u32(ending_kb).u16(device_handle).u16(array_range_handle)
+        .u8(1).u8(0).u8(0)
+        .u64(extended_starting).u64(extended_ending);
+    return builder;
+}
+
+/// @brief Table with BIOS Information, Port Connection, two Memory Devices and one OEM structure
+inline std::vector<uint8_t> make_basic_table()
+{
+    SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, bios_information_v24(),
+            { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::PortConnection, 0x0008, port_connection(), { "J101", "COM A" })
+        .add(SMBios::MemoryDevice, 0x0011, memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM_A1", "BANK 0", "Vendor", "0001", "Tag", "PN-1" })
+        .add(SMBios::MemoryDevice, 0x0012, memory_device_v28(0x0010, 0, 0),
+            { "DIMM_A2", "BANK 1", "Vendor", "0002", "Tag", "PN-2" })
+        .add(0x80, 0x0080, StructureBuilder().u32(0xDEADBEEF));
+    return table.build();
+}
+
+/// @brief Version which has every field of the structures above
+inline SMBiosVersion make_basic_version()
+{
+    return SMBiosVersion{ 3, 2 };
+}
+
+} // namespace test
+} // namespace smbios
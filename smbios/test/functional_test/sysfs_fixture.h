@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
+
+// Fake sysfs trees in a temporary directory, removed with the fixture
+// Tests of sysfs readers do not depend on drivers loaded on the machine
+
+namespace smbios {
+namespace test {
+
+/// @brief Unique temporary directory with helpers to write attribute files
+class SysfsFixture {
+public:
+
+    SysfsFixture()
+        : root_(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("smbios-sysfs-%%%%-%%%%"))
+    {
+        boost::filesystem::create_directories(root_);
+    }
+
+    ~SysfsFixture()
+    {
+        boost::system::error_code error;
+        boost::filesystem::remove_all(root_, error);
+    }
+
+    SysfsFixture(const SysfsFixture&) = delete;
+    SysfsFixture& operator=(const SysfsFixture&) = delete;
+
+    /// @brief Write attribute file, parent directories are created
+    void write(const std::string& relative_path, const std::string& value) const
+    {
+        const boost::filesystem::path path = root_ / relative_path;
+        boost::filesystem::create_directories(path.parent_path());
+        std::ofstream(path.string()) << value << '\n';
+    }
+
+    /// @brief EDAC DIMM directory mc<controller>/dimm<index> with zero counters
+    void add_edac_dimm(uint32_t controller, uint32_t index, const std::string& label, uint64_t size_mb) const
+    {
+        const std::string dimm = edac_dimm_path(controller, index);
+        write(dimm + "/dimm_label", label);
+        write(dimm + "/dimm_location", "channel " + std::to_string(index) + " slot 0");
+        write(dimm + "/size", std::to_string(size_mb));
+        set_edac_counters(controller, index, 0, 0);
+    }
+
+    void set_edac_counters(uint32_t controller, uint32_t index, uint64_t corrected, uint64_t uncorrected) const
+    {
+        const std::string dimm = edac_dimm_path(controller, index);
+        write(dimm + "/dimm_ce_count", std::to_string(corrected));
+        write(dimm + "/dimm_ue_count", std::to_string(uncorrected));
+    }
+
+    std::string path(const std::string& relative_path = std::string()) const
+    {
+        return (root_ / relative_path).string();
+    }
+
+private:
+
+    static std::string edac_dimm_path(uint32_t controller, uint32_t index)
+    {
+        return "mc/mc" + std::to_string(controller) + "/dimm" + std::to_string(index);
+    }
+
+    boost::filesystem::path root_;
+};
+
+} // namespace test
+} // namespace smbios
@@ -2,8 +2,35 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <smbios/smbios.h>
 #include <smbios/smbios_entry_factory.h>
+#include <smbios/smbios_entry_variant.h>
+#include <smbios/memory_device_view.h>
+#include <smbios/smbios_field.h>
+#include <smbios/smbios_schema.h>
+#include <smbios/memory_address_index.h>
+#include <smbios/memory_topology.h>
+#include <smbios/system_identity.h>
+#include <smbios/pci_device_map.h>
+#include <smbios/dimm_locator.h>
+#include <smbios/render_buffer.h>
+#include <smbios/smbios_json.h>
+#include <smbios/columnar_export.h>
+#include <smbios/csv_export.h>
+#include <smbios/projection.h>
+#include <smbios/vectored_output.h>
+#include <smbios/render_cache.h>
+#include <smbios/dmidecode_output.h>
+#include <smbios/parallel_render.h>
+#include <smbios/smbios_cbor.h>
+#include <thread>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include "../functional_test/synthetic_table.h"
 
 #define BOOST_AUTO_TEST_MAIN
 
@@ -51,5 +78,903 @@ BOOST_AUTO_TEST_CASE(PerformanceTestsCase)
     }
     BOOST_TEST_MESSAGE("Total enumeration time: " << counter.delay().count() << " mcs");
 }
+// Compare virtual entries and variant-based value model on the same table
+BOOST_AUTO_TEST_CASE(VariantPerformanceTestsCase)
+{
+    constexpr size_t passes = 10000;
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+    SMBiosVersion ver = smbios.get_smbios_version();
+    SMBiosEntryFactory smbios_factory;
+
+    size_t virtual_size = 0;
+    TimedObject virtual_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const DMIHeader& header : smbios) {
+            std::unique_ptr<AbstractSMBiosEntry> entry = smbios_factory.create(header, ver);
+            if (entry) {
+                virtual_size += entry->get_entry_size();
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Virtual entries: " << virtual_counter.delay().count() << " mcs");
+
+    size_t variant_size = 0;
+    TimedObject variant_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const SMBiosEntryVariant& entry : smbios_factory.create_all(smbios)) {
+            if (is_decoded(entry)) {
+                variant_size += boost::apply_visitor(EntrySizeVisitor(), entry);
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Variant entries: " << variant_counter.delay().count() << " mcs");
+
+    BOOST_CHECK_EQUAL(virtual_size, variant_size);
+}
+// Batch decoding of Memory Device fields with entries and views
+BOOST_AUTO_TEST_CASE(ViewPerformanceTestsCase)
+{
+    constexpr size_t passes = 10000;
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+    SMBiosVersion ver = smbios.get_smbios_version();
+
+    uint64_t entry_size = 0;
+    TimedObject entry_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const DMIHeader& header : smbios) {
+            if (header.type == SMBios::MemoryDevice) {
+                entry_size += MemoryDeviceEntry(header, ver).get_device_size();
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Memory Device entries: " << entry_counter.delay().count() << " mcs");
+
+    uint64_t view_size = 0;
+    std::vector<MemoryDeviceView> views;
+    TimedObject view_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        views.clear();
+        smbios.view_all(views);
+        for (const MemoryDeviceView& view : views) {
+            view_size += view.get_device_size();
+        }
+    }
+    BOOST_TEST_MESSAGE("Memory Device views: " << view_counter.delay().count() << " mcs");
+
+    BOOST_CHECK_EQUAL(entry_size, view_size);
+}
+// Field extraction from many structures: checked access per view and batch with hoisted resolution
+BOOST_AUTO_TEST_CASE(FieldBatchPerformanceTestsCase)
+{
+    constexpr size_t copies = 2000;
+    constexpr size_t passes = 1000;
+
+    // one big table with the same structures repeated
+    test::SyntheticTable table;
+    for (size_t i = 0; i < copies; ++i) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(i), test::memory_device_v28(0x0010, 8192, 2400),
+            { "DIMM", "BANK", "Vendor", "0001", "Tag", "PN" });
+    }
+    SMBios smbios(table.build(), test::make_basic_version());
+
+    // both fill the same column right from the table headers: checked access resolves
+    // version and length for every structure, the batch once per run of equal length
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    const SMBiosVersion version = smbios.get_smbios_version();
+    std::vector<uint16_t> checked_speeds(headers.size());
+    TimedObject checked_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (size_t i = 0; i < headers.size(); ++i) {
+            checked_speeds[i] = MemoryDeviceView(headers[i], version).get<MemoryDeviceLayout::DeviceSpeed>(0);
+        }
+    }
+    BOOST_TEST_MESSAGE("Checked field access: " << checked_counter.delay().count() << " mcs");
+
+    std::vector<uint16_t> batch_speeds(headers.size());
+    TimedObject batch_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        read_field_batch<MemoryDeviceLayout::DeviceSpeed>(MemoryDeviceLayout::revisions, version,
+            headers.data(), headers.data() + headers.size(), 0, batch_speeds.begin());
+    }
+    BOOST_TEST_MESSAGE("Batch field access: " << batch_counter.delay().count() << " mcs");
+
+    BOOST_CHECK(checked_speeds == batch_speeds);
+}
+// Render the same table several times: new entries every pass and cached entries
+BOOST_AUTO_TEST_CASE(EntryCachePerformanceTestsCase)
+{
+    constexpr size_t passes = 1000;
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+    SMBiosVersion ver = smbios.get_smbios_version();
+    SMBiosEntryFactory smbios_factory;
+
+    size_t factory_length = 0;
+    TimedObject factory_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const DMIHeader& header : smbios) {
+            std::unique_ptr<AbstractSMBiosEntry> entry = smbios_factory.create(header, ver);
+            if (entry) {
+                factory_length += entry->render_to_description().size();
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Decode every pass: " << factory_counter.delay().count() << " mcs");
+
+    size_t cache_length = 0;
+    TimedObject cache_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (size_t i = 0; i < 5; ++i) {
+            if (const AbstractSMBiosEntry* entry = smbios.entry(i)) {
+                cache_length += entry->render_to_description().size();
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Decode once: " << cache_counter.delay().count() << " mcs");
+
+    BOOST_CHECK_EQUAL(factory_length, cache_length);
+}
+
+/// Generic decoder loop over the schema, no strings are copied
+BOOST_AUTO_TEST_CASE(SchemaDecodePerformanceTestsCase)
+{
+    constexpr size_t passes = 100000;
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+    SMBiosVersion ver = smbios.get_smbios_version();
+
+    uint64_t checksum = 0;
+    size_t fields_count = 0;
+    TimedObject counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const DMIHeader& header : smbios) {
+            if (const StructureSchema* schema = find_structure_schema(header.type)) {
+                decode_structure(*schema, header, ver, [&](const DecodedField& field) {
+                    checksum += field.value + field.text.size();
+                    ++fields_count;
+                });
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Schema decode of " << fields_count << " fields: " << counter.delay().count() << " mcs");
+    BOOST_CHECK(checksum);
+}
+
+/// Address to DIMM resolution, e.g. for every machine-check event
+BOOST_AUTO_TEST_CASE(MemoryAddressIndexPerformanceTestsCase)
+{
+    constexpr size_t dimms = 64;
+    constexpr size_t lookups = 10000000;
+    constexpr uint64_t dimm_size = uint64_t(32) << 30;
+
+    test::SyntheticTable table;
+    for (uint16_t i = 0; i < dimms; ++i) {
+        table.add(SMBios::MemoryDevice, 0x1000 + i, test::memory_device_v28(0x0010, 0x7FFF, 3200),
+            { "DIMM_" + std::to_string(i), "BANK", "Vendor", "0001", "Tag", "PN" });
+        table.add(SMBios::MemoryDeviceMappedAddress, 0x2000 + i,
+            test::memory_device_mapped_address_v27(0xFFFFFFFF, 0xFFFFFFFF, 0x1000 + i, 0xFFFF,
+                i * dimm_size, (i + 1) * dimm_size - 1));
+    }
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    TimedObject build_counter;
+    const MemoryAddressIndex index(smbios);
+    BOOST_TEST_MESSAGE("Index build: " << build_counter.delay().count() << " mcs");
+    BOOST_REQUIRE_EQUAL(index.get_device_ranges_count(), dimms);
+
+    // pseudo-random addresses, the same sequence every run
+    uint64_t address = 0x9E3779B97F4A7C15ull;
+    size_t found = 0;
+    TimedObject lookup_counter;
+    for (size_t i = 0; i < lookups; ++i) {
+        address = address * 6364136223846793005ull + 1442695040888963407ull;
+        if (index.find_device(address % (dimms * dimm_size))) {
+            ++found;
+        }
+    }
+    const auto delay = lookup_counter.delay().count();
+    BOOST_TEST_MESSAGE(lookups << " lookups: " << delay << " mcs, "
+        << (delay ? lookups / delay : 0) << " M lookups per second");
+    BOOST_CHECK_EQUAL(found, lookups);
+}
+
+/// Memory summary over a corpus of tables, each table is parsed from its dump
+BOOST_AUTO_TEST_CASE(MemoryTopologyPerformanceTestsCase)
+{
+    constexpr size_t tables = 100000;
+    constexpr uint16_t dimms = 16;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x80000000, dimms, uint64_t(1) << 40));
+    for (uint16_t i = 0; i < dimms; ++i) {
+        table.add(SMBios::MemoryDevice, 0x0100 + i, test::memory_device_v28(0x0010, (i % 4) ? 0x7FFF : 0, 3200, 65536),
+            { "DIMM_" + std::to_string(i), "BANK", "Vendor", "0001", "Tag", "PN" });
+    }
+    const std::vector<uint8_t> dump = table.build();
+
+    MemoryTopology topology;
+    uint64_t installed_size = 0;
+    TimedObject counter;
+    for (size_t i = 0; i < tables; ++i) {
+        const SMBios smbios(dump, test::make_basic_version());
+        summarize_memory_topology(smbios, topology);
+        installed_size += topology.installed_size;
+    }
+    BOOST_TEST_MESSAGE("Memory topology of " << tables << " tables: " << counter.delay().count() << " mcs");
+    BOOST_CHECK_EQUAL(installed_size, tables * 12 * (uint64_t(65536) << 20));
+}
+
+BOOST_AUTO_TEST_CASE(IdentityPerformanceTestsCase)
+{
+    constexpr size_t hosts = 1000000;
+    constexpr uint16_t dimms = 64;
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66,
+                               0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid), { "Vendor", "Product", "1.0", "SYS-0001", "SKU", "Family" })
+        .add(SMBios::BaseboardInformation, 0x0002, test::baseboard_v24(0x0003), { "Vendor", "Board", "1.0", "BRD-0001", "Tag", "Slot" })
+        .add(SMBios::SystemEnclosure, 0x0003, test::chassis_v21(), { "Vendor", "1.0", "CHS-0001", "Tag" })
+        .add(SMBios::PhysicalMemoryArray, 0x0010, test::physical_memory_array_v27(0x80000000, dimms, uint64_t(1) << 40));
+    for (uint16_t i = 0; i < dimms; ++i) {
+        table.add(SMBios::MemoryDevice, 0x0100 + i, test::memory_device_v28(0x0010, 0, 3200, 65536),
+            { "DIMM_" + std::to_string(i), "BANK", "Vendor", "0001", "Tag", "PN" });
+    }
+    const std::vector<uint8_t> dump = table.build();
+
+    size_t complete = 0;
+    TimedObject counter;
+    for (size_t i = 0; i < hosts; ++i) {
+        const SystemIdentity identity = read_system_identity(dump.data(), dump.size(), test::make_basic_version());
+        complete += identity.complete() ? 1 : 0;
+    }
+    BOOST_TEST_MESSAGE("Identity of " << hosts << " hosts: " << counter.delay().count() << " mcs");
+    BOOST_CHECK_EQUAL(complete, hosts);
+}
+
+BOOST_AUTO_TEST_CASE(OemValuePerformanceTestsCase)
+{
+    constexpr size_t lookups = 1000000;
+    constexpr uint8_t keys = 64;
+
+    std::vector<std::string> strings;
+    for (uint8_t i = 0; i < keys; ++i) {
+        strings.push_back("key" + std::to_string(i) + "=value" + std::to_string(i));
+    }
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::OemStrings, 0x0B00, test::string_list(keys), strings);
+    const std::vector<uint8_t> dump = table.build();
+
+    TimedObject build_counter;
+    const SMBios smbios(dump, test::make_basic_version());
+    const bool found = static_cast<bool>(smbios.oem_value("key0"));
+    BOOST_TEST_MESSAGE("Table load and OEM index build: " << build_counter.delay().count() << " mcs");
+    BOOST_CHECK(found);
+
+    const std::string key = "key" + std::to_string(keys - 1);
+    size_t value_length = 0;
+    TimedObject counter;
+    for (size_t i = 0; i < lookups; ++i) {
+        value_length += smbios.oem_value(key)->size();
+    }
+    BOOST_TEST_MESSAGE("OEM value lookups " << lookups << ": " << counter.delay().count() << " mcs");
+    BOOST_CHECK_EQUAL(value_length, lookups * 7);
+}
+
+BOOST_AUTO_TEST_CASE(PciDeviceMapPerformanceTestsCase)
+{
+    constexpr size_t lookups = 1000000;
+    constexpr uint16_t slots = 128;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t i = 0; i < slots; ++i) {
+        table.add(SMBios::SystemSlots, 0x0900 + i, test::system_slot_v26(i, 0, static_cast<uint8_t>(slots - i), 0),
+            { "SLOT" + std::to_string(i) });
+    }
+    const std::vector<uint8_t> dump = table.build();
+    const SMBios smbios(dump, test::make_basic_version());
+
+    TimedObject build_counter;
+    const PciDeviceMap& map = smbios.pci_devices();
+    BOOST_TEST_MESSAGE("PCI device map of " << slots << " slots: " << build_counter.delay().count() << " mcs");
+
+    size_t found = 0;
+    PciAddress address{};
+    TimedObject counter;
+    for (size_t i = 0; i < lookups; ++i) {
+        address.bus = static_cast<uint8_t>(i % slots + 1);
+        address.device_function = static_cast<uint8_t>(i & 0x07);
+        found += map.find(address) ? 1 : 0;
+    }
+    BOOST_TEST_MESSAGE("PCI address lookups " << lookups << ": " << counter.delay().count() << " mcs");
+    BOOST_CHECK_EQUAL(found, lookups);
+}
+
+BOOST_AUTO_TEST_CASE(DimmLocatorPerformanceTestsCase)
+{
+    constexpr size_t records = 1000000;
+
+    // device and bank locators of several vendors, some not recognizable
+    std::vector<std::pair<std::string, std::string>> corpus;
+    corpus.reserve(records);
+    for (size_t i = 0; i < records; ++i) {
+        const std::string socket = std::to_string(i % 4);
+        const std::string channel(1, static_cast<char>('A' + i % 8));
+        const std::string slot = std::to_string(i % 3);
+        switch (i % 6) {
+        case 0: corpus.emplace_back("CPU" + socket + "_DIMM_" + channel + slot, ""); break;
+        case 1: corpus.emplace_back("DIMM " + slot, "P" + socket + " CHANNEL " + channel); break;
+        case 2: corpus.emplace_back("Channel" + channel + "-DIMM" + slot, "BANK " + socket); break;
+        case 3: corpus.emplace_back("PROC " + socket + " DIMM " + slot, ""); break;
+        case 4: corpus.emplace_back("P" + socket + "-DIMM" + channel + slot, ""); break;
+        default: corpus.emplace_back("Not Specified", "Not Specified"); break;
+        }
+    }
+
+    const DimmLocatorParser parser;
+    DimmCoordinates coordinates;
+    size_t recognized = 0;
+    TimedObject counter;
+    for (const auto& locators : corpus) {
+        recognized += parser.parse(locators.first, locators.second, coordinates) ? 1 : 0;
+    }
+    const auto delay = counter.delay().count();
+    BOOST_TEST_MESSAGE("DIMM locators parsed " << records << ": " << delay << " mcs");
+    BOOST_CHECK_EQUAL(recognized, records - records / 6);
+}
+
+// Render cached entries into new strings and into single reused buffer
+BOOST_AUTO_TEST_CASE(RenderBufferPerformanceTestsCase)
+{
+    constexpr size_t passes = 20000;
+    SMBios smbios(test::make_basic_table(), test::make_basic_version());
+
+    size_t string_length = 0;
+    TimedObject string_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        std::string text;
+        for (size_t i = 0; i < 4; ++i) {
+            text += smbios.entry(i)->render_to_description();
+        }
+        string_length += text.size();
+    }
+    BOOST_TEST_MESSAGE("Render to strings: " << string_counter.delay().count() << " mcs");
+
+    size_t buffer_length = 0;
+    RenderBuffer out;
+    TimedObject buffer_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        out.clear();
+        for (size_t i = 0; i < 4; ++i) {
+            smbios.entry(i)->render_to(out);
+        }
+        buffer_length += out.size();
+    }
+    BOOST_TEST_MESSAGE("Render to buffer: " << buffer_counter.delay().count() << " mcs");
+
+    BOOST_CHECK_EQUAL(string_length, buffer_length);
+}
+
+// Serialize server-sized table to JSON into reused buffer
+BOOST_AUTO_TEST_CASE(JsonPerformanceTestsCase)
+{
+    constexpr size_t passes = 1000;
+    constexpr uint16_t dimms = 48;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < dimms; ++dimm) {
+        const std::string locator = "DIMM_" + std::to_string(dimm);
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { locator, "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+    }
+    SMBios smbios(table.build(), test::make_basic_version());
+
+    RenderBuffer out;
+    size_t json_length = 0;
+    TimedObject counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        out.clear();
+        render_json(smbios, out);
+        json_length += out.size();
+    }
+    const auto delay = counter.delay().count();
+    BOOST_TEST_MESSAGE("JSON of " << smbios.get_headers().size() << " structures, " << passes << " times: "
+        << delay << " mcs, " << (delay ? json_length / delay : 0) << " MB/s");
+    BOOST_CHECK(json_length > 0);
+}
+
+// Export the fleet of equal tables into columns, then scan single column of the file
+BOOST_AUTO_TEST_CASE(ColumnarExportPerformanceTestsCase)
+{
+    constexpr size_t hosts = 2000;
+    constexpr uint16_t dimms = 32;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < dimms; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+    }
+    SMBios smbios(table.build(), test::make_basic_version());
+
+    RenderBuffer json;
+    render_json(smbios, json);
+
+    ColumnarExporter exporter;
+    TimedObject export_counter;
+    for (size_t host = 0; host < hosts; ++host) {
+        exporter.add_table(smbios, "host-" + std::to_string(host));
+    }
+    const std::vector<uint8_t> file = exporter.serialize();
+    BOOST_TEST_MESSAGE("Columnar export of " << hosts << " hosts: " << export_counter.delay().count() << " mcs, "
+        << file.size() << " bytes, JSON would be " << json.size() * hosts << " bytes");
+
+    TimedObject scan_counter;
+    const ColumnarReader reader(file.data(), file.size());
+    const ColumnView size = reader.find_column(SMBios::MemoryDevice, "size");
+    uint64_t total_size = 0;
+    for (uint32_t row = 0; row < size.get_rows(); ++row) {
+        total_size += size.get_number(row);
+    }
+    BOOST_TEST_MESSAGE("Scan of " << size.get_rows() << " memory device sizes: " << scan_counter.delay().count() << " mcs");
+
+    BOOST_CHECK_EQUAL(total_size, uint64_t(32768) * dimms * hosts);
+}
+
+// Memory Device rows of the fleet, rendered into one buffer flushed by large chunks
+BOOST_AUTO_TEST_CASE(CsvExportPerformanceTestsCase)
+{
+    constexpr size_t hosts = 5000;
+    constexpr uint16_t dimms = 48;
+    constexpr size_t flush_threshold = 1024 * 1024;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < dimms; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+    }
+    SMBios smbios(table.build(), test::make_basic_version());
+    const std::vector<std::string> host_names = { "host-0001", "host-0002", "host-0003", "host-0004" };
+
+    for (DelimitedFormat format : { DelimitedFormat::Csv, DelimitedFormat::Tsv }) {
+        const CsvExporter exporter(SMBios::MemoryDevice, format, true);
+        RenderBuffer out(2 * flush_threshold);
+        size_t length = 0;
+        size_t flushes = 0;
+        size_t rows = 0;
+
+        TimedObject counter;
+        exporter.render_header(out);
+        for (size_t host = 0; host < hosts; ++host) {
+            rows += exporter.render_rows(smbios, host_names[host % host_names.size()], out);
+            if (out.size() >= flush_threshold) {
+                length += out.size();
+                ++flushes;
+                out.clear();
+            }
+        }
+        length += out.size();
+        const auto delay = counter.delay().count();
+        BOOST_TEST_MESSAGE((format == DelimitedFormat::Csv ? "CSV" : "TSV") << " of " << rows << " rows: " << delay << " mcs, "
+            << length << " bytes in " << flushes + 1 << " writes, " << (delay ? length / delay : 0) << " MB/s");
+        BOOST_CHECK_EQUAL(rows, hosts * dimms);
+    }
+}
+
+// Three fields of every memory device: full description against projection
+BOOST_AUTO_TEST_CASE(ProjectionPerformanceTestsCase)
+{
+    constexpr size_t passes = 1000;
+    constexpr uint16_t dimms = 48;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < dimms; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+    }
+    SMBios smbios(table.build(), test::make_basic_version());
+    const std::vector<DMIHeader>& headers = smbios.get_headers();
+    const SMBiosVersion version = smbios.get_smbios_version();
+
+    size_t description_length = 0;
+    TimedObject description_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (size_t i = 0; i < headers.size(); ++i) {
+            if (headers[i].type == SMBios::MemoryDevice) {
+                description_length += smbios.entry(i)->render_to_description().size();
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Full description of " << dimms << " devices, " << passes << " times: "
+        << description_counter.delay().count() << " mcs");
+
+    const Projection projection("type17.size,type17.speed,type17.part_number");
+    std::vector<ProjectedValue> values;
+    uint64_t total_size = 0;
+    TimedObject projection_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const DMIHeader& header : headers) {
+            if (projection.selects(header.type)) {
+                projection.extract(header, version, values);
+                total_size += values[0].decoded.value;
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Projection of 3 fields: " << projection_counter.delay().count() << " mcs");
+
+    const Projection numbers("type17.size,type17.speed");
+    TimedObject numbers_counter;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const DMIHeader& header : headers) {
+            if (numbers.selects(header.type)) {
+                numbers.extract(header, version, values);
+                total_size += values[0].decoded.value;
+            }
+        }
+    }
+    BOOST_TEST_MESSAGE("Projection of 2 numeric fields: " << numbers_counter.delay().count() << " mcs");
+
+    BOOST_CHECK(description_length > 0);
+    BOOST_CHECK_EQUAL(total_size, uint64_t(2) * 32768 * dimms * passes);
+}
+
+// Line by line std::ostream writes against chunks written by writev
+BOOST_AUTO_TEST_CASE(VectoredOutputPerformanceTestsCase)
+{
+    constexpr size_t lines = 1000000;
+    const std::string line = "Header ID = 17, Memory Device, Size: 32768 MB\n";
+
+    std::FILE* file = std::fopen("/dev/null", "w");
+    BOOST_REQUIRE(file);
+
+    TimedObject stream_counter;
+    {
+        std::ofstream stream("/dev/null");
+        for (size_t i = 0; i < lines; ++i) {
+            stream << line << std::flush;
+        }
+    }
+    BOOST_TEST_MESSAGE("Flushed std::ofstream lines: " << stream_counter.delay().count() << " mcs, " << lines << " write calls");
+
+    TimedObject vectored_counter;
+    VectoredOutput output(fileno(file));
+    for (size_t i = 0; i < lines; ++i) {
+        output.buffer() << line;
+        output.commit();
+    }
+    output.flush();
+    BOOST_TEST_MESSAGE("Vectored output: " << vectored_counter.delay().count() << " mcs, "
+        << output.get_bytes_written() << " bytes in " << output.get_write_calls() << " write calls");
+    std::fclose(file);
+
+    BOOST_CHECK_EQUAL(output.get_bytes_written(), lines * line.size());
+}
+
+#if defined(SMBIOS_UTIL_PATH) && !defined(_WIN32)
+// smbios_util runs on server-sized dump, output is read from the pipe as collectors do
+BOOST_AUTO_TEST_CASE(CliPerformanceTestsCase)
+{
+    constexpr size_t runs = 20;
+    constexpr uint16_t dimms = 256;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < dimms; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+    }
+    const std::vector<uint8_t> dump = table.build();
+
+    const boost::filesystem::path dump_path =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("smbios-dump-%%%%-%%%%.bin");
+    std::ofstream(dump_path.string(), std::ios::binary).write(reinterpret_cast<const char*>(dump.data()), dump.size());
+
+    const char* const options[] = { "", "-f json", "-f csv -t 17", "--select type17.size,type17.part_number" };
+    std::vector<char> output(1024 * 1024);
+    for (const char* option : options) {
+        const std::string command = std::string(SMBIOS_UTIL_PATH) + " -r " + dump_path.string() + " " + option;
+        size_t bytes = 0;
+
+        TimedObject counter;
+        for (size_t run = 0; run < runs; ++run) {
+            std::FILE* pipe = popen(command.c_str(), "r");
+            BOOST_REQUIRE(pipe);
+            for (size_t read; (read = std::fread(output.data(), 1, output.size(), pipe)) != 0; ) {
+                bytes += read;
+            }
+            BOOST_CHECK_EQUAL(pclose(pipe), 0);
+        }
+        const auto delay = counter.delay().count();
+        BOOST_TEST_MESSAGE("smbios_util " << option << ": " << delay / runs << " mcs per run, " << bytes / runs << " bytes");
+        BOOST_CHECK(bytes > 0);
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::remove(dump_path, error);
+}
+#endif
+
+// Fleet of hosts with few distinct tables: JSON rendered every time against memoized by content
+BOOST_AUTO_TEST_CASE(RenderCachePerformanceTestsCase)
+{
+    constexpr size_t hosts = 5000;
+    constexpr size_t configurations = 8;
+
+    std::vector<std::unique_ptr<SMBios>> tables;
+    for (size_t configuration = 0; configuration < configurations; ++configuration) {
+        test::SyntheticTable table;
+        table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1." + std::to_string(configuration), "01/02/2020" });
+        for (uint16_t dimm = 0; dimm < 16 + configuration * 4; ++dimm) {
+            table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+                { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+        }
+        tables.emplace_back(new SMBios(table.build(), test::make_basic_version()));
+    }
+
+    RenderBuffer out;
+    size_t rendered_length = 0;
+    TimedObject render_counter;
+    for (size_t host = 0; host < hosts; ++host) {
+        out.clear();
+        render_json(*tables[host % configurations], out);
+        rendered_length += out.size();
+    }
+    BOOST_TEST_MESSAGE("JSON of " << hosts << " hosts: " << render_counter.delay().count() << " mcs");
+
+    RenderCache cache(64 * 1024 * 1024);
+    size_t cached_length = 0;
+    TimedObject cache_counter;
+    for (size_t host = 0; host < hosts; ++host) {
+        const SMBios& smbios = *tables[host % configurations];
+        out.clear();
+        const RenderKey key = make_render_key(smbios.get_table_base(), smbios.get_table_size(), smbios.get_smbios_version(), "json");
+        cache.render(key, out, [&smbios](RenderBuffer& target) {
+            render_json(smbios, target);
+        });
+        cached_length += out.size();
+    }
+    BOOST_TEST_MESSAGE("Memoized JSON of " << hosts << " hosts: " << cache_counter.delay().count() << " mcs, "
+        << cache.get_hits() << " hits, " << cache.get_misses() << " misses");
+
+    BOOST_CHECK_EQUAL(rendered_length, cached_length);
+    BOOST_CHECK_EQUAL(cache.get_misses(), configurations);
+}
+
+/// Two-socket server: firmware, board, processors with caches, 32 DIMMs and their address ranges
+static std::vector<uint8_t> make_server_table()
+{
+    const uint8_t uuid[16] = { 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" })
+        .add(SMBios::SystemInformation, 0x0001, test::system_information_v24(uuid),
+            { "Maker", "Server", "Rev A", "SYS-1", "SKU-1", "Family" })
+        .add(SMBios::BaseboardInformation, 0x0002, test::baseboard_v24(0x0003),
+            { "Maker", "Board", "Rev B", "BRD-1", "Tag", "Slot 0" })
+        .add(SMBios::SystemEnclosure, 0x0003, test::chassis_v21(), { "Maker", "Rev C", "CHS-1", "Tag" });
+    for (uint16_t socket = 0; socket < 2; ++socket) {
+        const uint16_t cache = static_cast<uint16_t>(0x0700 + socket * 3);
+        for (uint8_t level = 1; level <= 3; ++level) {
+            table.add(SMBios::CacheInformation, static_cast<uint16_t>(cache + level - 1), test::cache_v31(level, 1536u << (level * 2)),
+                { "L" + std::to_string(level) + " - Cache" });
+        }
+        table.add(SMBios::ProcessorInformation, static_cast<uint16_t>(0x0400 + socket),
+            test::processor_v30(cache, static_cast<uint16_t>(cache + 1), static_cast<uint16_t>(cache + 2), 24, 48),
+            { "CPU" + std::to_string(socket), "Intel(R) Corporation", "Intel(R) Xeon(R) Gold 6136 CPU @ 3.00GHz", "SN", "AT", "PN" });
+    }
+    table.add(SMBios::PhysicalMemoryArray, 0x1000, test::physical_memory_array_v27(0x80000000, 32, 0x100000000000ull));
+    for (uint16_t dimm = 0; dimm < 32; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1100 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+        table.add(SMBios::MemoryDeviceMappedAddress, static_cast<uint16_t>(0x1200 + dimm),
+            test::memory_device_mapped_address_v27(dimm * 0x2000000u, dimm * 0x2000000u + 0x1FFFFFF, static_cast<uint16_t>(0x1100 + dimm), 0x1300));
+    }
+    table.add(SMBios::MemoryArrayMappedAddress, 0x1300, test::memory_array_mapped_address_v27(0xFFFFFFFF, 0xFFFFFFFF, 0x1000, 0, (1ull << 40) - 1))
+        .add(SMBios::OemStrings, 0x0B00, test::string_list(2), { "Build 42", "Line 7" })
+        .add(SMBios::SystemBootInformation, 0x2000, test::StructureBuilder().u32(0).u16(0).u8(0));
+    return table.build();
+}
+
+/// dmidecode --dump-bin image: 64-bit entry point, table at 20h
+static std::vector<uint8_t> make_dump_image(const std::vector<uint8_t>& table)
+{
+    std::vector<uint8_t> image(0x20, 0);
+    const uint8_t anchor[] = { '_', 'S', 'M', '3', '_' };
+    std::copy(std::begin(anchor), std::end(anchor), image.begin());
+    image[0x06] = 0x18;
+    image[0x07] = 3;
+    image[0x08] = 2;
+    image[0x0A] = 1;
+    image[0x0C] = static_cast<uint8_t>(table.size());
+    image[0x0D] = static_cast<uint8_t>(table.size() >> 8);
+    image[0x10] = 0x20;
+    uint8_t checksum = 0;
+    for (size_t i = 0; i < 0x18; ++i) {
+        checksum = static_cast<uint8_t>(checksum + image[i]);
+    }
+    image[0x05] = static_cast<uint8_t>(0x100 - checksum);
+    image.insert(image.end(), table.begin(), table.end());
+    return image;
+}
+
+// dmidecode layout rendered in process
+BOOST_AUTO_TEST_CASE(DmidecodePerformanceTestsCase)
+{
+    constexpr size_t runs = 10000;
+    const SMBios smbios(make_server_table(), test::make_basic_version());
+
+    RenderBuffer out;
+    size_t bytes = 0;
+    TimedObject counter;
+    for (size_t run = 0; run < runs; ++run) {
+        out.clear();
+        render_dmidecode(smbios, DmidecodeTypes(), out);
+        bytes += out.size();
+    }
+    const auto delay = counter.delay().count();
+    BOOST_TEST_MESSAGE("dmidecode layout of " << smbios.get_structures_count() << " structures: "
+        << delay * 1000 / runs << " ns per table, " << bytes / runs << " bytes");
+
+    TimedObject keyword_counter;
+    for (size_t run = 0; run < runs; ++run) {
+        out.clear();
+        render_dmidecode_string(smbios, "system-serial-number", out);
+    }
+    BOOST_TEST_MESSAGE("dmidecode -s system-serial-number: " << keyword_counter.delay().count() * 1000 / runs << " ns per table");
+    BOOST_CHECK_EQUAL(out.str(), "SYS-1\n");
+}
+
+#if defined(SMBIOS_UTIL_PATH) && !defined(_WIN32)
+// smbios_util --dmidecode-compat against dmidecode --from-dump on the same image
+// dmidecode is optional: without it only smbios_util is measured
+BOOST_AUTO_TEST_CASE(DmidecodeCompatPerformanceTestsCase)
+{
+    constexpr size_t runs = 20;
+
+    const std::vector<uint8_t> image = make_dump_image(make_server_table());
+    const boost::filesystem::path dump_path =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("smbios-dmidecode-%%%%-%%%%.bin");
+    std::ofstream(dump_path.string(), std::ios::binary).write(reinterpret_cast<const char*>(image.data()), image.size());
+
+    auto measure = [&](const std::string& command, std::string& output) {
+        std::vector<char> buffer(64 * 1024);
+        TimedObject counter;
+        for (size_t run = 0; run < runs; ++run) {
+            output.clear();
+            std::FILE* pipe = popen(command.c_str(), "r");
+            BOOST_REQUIRE(pipe);
+            for (size_t read; (read = std::fread(buffer.data(), 1, buffer.size(), pipe)) != 0; ) {
+                output.append(buffer.data(), read);
+            }
+            BOOST_CHECK_EQUAL(pclose(pipe), 0);
+        }
+        return counter.delay().count() / runs;
+    };
+
+    const bool dmidecode_found = std::system("dmidecode --version > /dev/null 2>&1") == 0;
+    if (!dmidecode_found) {
+        BOOST_TEST_MESSAGE("dmidecode is not found, smbios_util only");
+    }
+
+    const char* const options[][2] = {
+        { "", "" },
+        { "-t memory", "-t memory" },
+        { "-s system-serial-number", "-s system-serial-number" }
+    };
+    for (const auto& option : options) {
+        std::string compat_output;
+        const auto compat_delay = measure(std::string(SMBIOS_UTIL_PATH) + " --dmidecode-compat -r " + dump_path.string() + " " + option[0], compat_output);
+        BOOST_CHECK(!compat_output.empty());
+        BOOST_TEST_MESSAGE("smbios_util --dmidecode-compat " << option[0] << ": " << compat_delay << " mcs per run, " << compat_output.size() << " bytes");
+
+        if (!dmidecode_found) {
+            continue;
+        }
+        std::string dmidecode_output;
+        const auto dmidecode_delay = measure("dmidecode --from-dump " + dump_path.string() + " " + option[1] + " 2>/dev/null", dmidecode_output);
+        BOOST_TEST_MESSAGE("dmidecode " << option[1] << ": " << dmidecode_delay << " mcs per run, " << dmidecode_output.size()
+            << " bytes, " << (compat_delay ? double(dmidecode_delay) / compat_delay : 0.0) << "x of smbios_util");
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::remove(dump_path, error);
+}
+#endif
+
+// Text of a table with tens of thousands of structures on 1..N threads
+BOOST_AUTO_TEST_CASE(ParallelRenderPerformanceTestsCase)
+{
+    constexpr uint16_t dimms = 16384;
+    constexpr size_t runs = 5;
+
+    test::SyntheticTable table;
+    table.add(SMBios::BIOSInformation, 0x0000, test::bios_information_v24(), { "Test Vendor", "1.2.3", "01/02/2020" });
+    for (uint16_t dimm = 0; dimm < dimms; ++dimm) {
+        table.add(SMBios::MemoryDevice, static_cast<uint16_t>(0x1000 + dimm), test::memory_device_v28(0x1000, 32768, 3200),
+            { "DIMM_" + std::to_string(dimm), "BANK 0", "Vendor", "SN" + std::to_string(dimm), "Tag", "PN-1" });
+        table.add(SMBios::PortConnection, static_cast<uint16_t>(0x8000 + dimm), test::port_connection(), { "J101", "COM A" });
+    }
+    const SMBios smbios(table.build(), test::make_basic_version());
+
+    // entries are decoded once and cached, decoding is not measured
+    RenderBuffer serial;
+    render_structures(smbios, serial, 1);
+
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    uint64_t single_thread_delay = 0;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        RenderBuffer out;
+        TimedObject counter;
+        for (size_t run = 0; run < runs; ++run) {
+            out.clear();
+            render_structures(smbios, out, threads);
+        }
+        const uint64_t delay = counter.delay().count() / runs;
+        if (threads == 1) {
+            single_thread_delay = delay;
+        }
+        BOOST_CHECK(out.view() == serial.view());
+        BOOST_TEST_MESSAGE(smbios.get_structures_count() << " structures on " << threads << " threads: " << delay << " mcs, "
+            << (delay ? double(single_thread_delay) / delay : 0.0) << "x");
+    }
+}
+
+/// Collector side work: every field is visited once
+struct CountingVisitor : CborMessageVisitor {
+    size_t structures = 0;
+    size_t fields = 0;
+
+    void begin_structure(const MessageStructure& /*structure*/) override { ++structures; }
+    void field(const MessageStructure& /*structure*/, const MessageField& /*field*/) override { ++fields; }
+};
+
+// Agent encodes the table, collector decodes it: CBOR message against JSON document parsed into a tree
+BOOST_AUTO_TEST_CASE(CborPerformanceTestsCase)
+{
+    constexpr size_t cbor_passes = 10000;
+    constexpr size_t json_passes = 200;
+
+    const SMBios smbios(make_server_table(), test::make_basic_version());
+
+    RenderBuffer out;
+    size_t cbor_fields = 0;
+    TimedObject cbor_counter;
+    for (size_t pass = 0; pass < cbor_passes; ++pass) {
+        out.clear();
+        render_cbor(smbios, "host-1", out);
+        CountingVisitor visitor;
+        decode_cbor_message(reinterpret_cast<const uint8_t*>(out.data()), out.size(), visitor);
+        BOOST_CHECK_EQUAL(visitor.structures, smbios.get_headers().size());
+        cbor_fields += visitor.fields;
+    }
+    const auto cbor_delay = cbor_counter.delay().count();
+    const size_t cbor_size = out.size();
+
+    size_t json_structures = 0;
+    TimedObject json_counter;
+    for (size_t pass = 0; pass < json_passes; ++pass) {
+        out.clear();
+        render_json(smbios, out);
+        std::istringstream json_stream(out.str());
+        boost::property_tree::ptree document;
+        boost::property_tree::read_json(json_stream, document);
+        json_structures += document.get_child("structures").size();
+    }
+    const auto json_delay = json_counter.delay().count();
+
+    const double cbor_round_trip = double(cbor_delay) / cbor_passes;
+    const double json_round_trip = double(json_delay) / json_passes;
+    BOOST_TEST_MESSAGE("CBOR of " << smbios.get_headers().size() << " structures: " << cbor_size << " bytes, "
+        << cbor_round_trip << " mcs encode and decode");
+    BOOST_TEST_MESSAGE("JSON of " << smbios.get_headers().size() << " structures: " << out.size() << " bytes, "
+        << json_round_trip << " mcs encode and parse, " << (cbor_round_trip > 0 ? json_round_trip / cbor_round_trip : 0.0) << "x");
+    BOOST_CHECK(cbor_fields > 0);
+    BOOST_CHECK_EQUAL(json_structures, json_passes * smbios.get_headers().size());
+    BOOST_CHECK(cbor_size < out.size());
+}
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
 #include <memory>
 #include <string>
 #include <boost/program_options.hpp>
+#include <smbios/dmidecode_output.h>
 
 // The header contains command-line parser for the SMBIOS command line utility
 // It uses Boost.ProgramOptions
@@ -38,6 +39,14 @@ public:
         return _memory_scan;
     }
 
+    bool is_identity() const {
+        return _identity;
+    }
+
+    bool is_output_stats() const {
+        return _output_stats;
+    }
+
     const std::string& read_from_file() const {
         return _from_file;
     }
@@ -46,6 +55,42 @@ public:
         return _to_file;
     }
 
+    const std::string& format() const {
+        return _format;
+    }
+
+    int structure_type() const {
+        return _type;
+    }
+
+    const std::string& select() const {
+        return _select;
+    }
+
+    const std::string& render_cache() const {
+        return _render_cache;
+    }
+
+    size_t threads() const {
+        return static_cast<size_t>(_threads);
+    }
+
+    const std::string& type_text() const {
+        return _type_text;
+    }
+
+    bool is_dmidecode_compat() const {
+        return _dmidecode_compat;
+    }
+
+    const DmidecodeTypes& dmidecode_types() const {
+        return _dmidecode_types;
+    }
+
+    const std::string& dmidecode_string() const {
+        return _dmidecode_string;
+    }
+
 
 private:
 
@@ -58,12 +103,45 @@ private:
     /// Fallback right to memory scan
     bool _memory_scan = false;
 
+    /// Print system identity only (UUID and serial numbers)
+    bool _identity = false;
+
+    /// Report output size and write calls
+    bool _output_stats = false;
+
+    /// Print the table in dmidecode layout
+    bool _dmidecode_compat = false;
+
     /// This file should contain SMBios dump
     std::string _from_file;
 
     /// Dump SMBios to that file
     std::string _to_file;
 
+    /// Output format: text, json, columnar, cbor, csv or tsv
+    std::string _format;
+
+    /// Structure type of csv and tsv output
+    int _type = -1;
+
+    /// -t argument as given: csv/tsv type number or dmidecode type list
+    std::string _type_text;
+
+    /// Types printed in dmidecode layout, none means all
+    DmidecodeTypes _dmidecode_types;
+
+    /// dmidecode -s keyword
+    std::string _dmidecode_string;
+
+    /// Comma-separated field selection, see smbios/projection.h
+    std::string _select;
+
+    /// Rendering threads of the text format, 0 means every core
+    int _threads = 1;
+
+    /// Directory of the rendered output cache
+    std::string _render_cache;
+
     /// Command-line params description
     boost::program_options::options_description cmd_options_description;
 };
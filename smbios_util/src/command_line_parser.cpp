@@ -5,6 +5,7 @@
 #include <iostream>
 #include <algorithm>
 #include <smbios/smbios.h>
+#include <smbios/dmidecode_output.h>
 
 using namespace smbios;
 namespace po = boost::program_options;
@@ -19,8 +20,17 @@ void CommandLineParams::read_params(int argc, char* argv[])
         ("help,h", "Print usage")
         ("version,v", "Print version")
         ("memory-scan,m", "Fallback to memory scan without trying EFI or SysFS (Linux only)")
-        ("read-file,r", po::value<string>(&_from_file), "Read SMBIOS table dump from this file")
+        ("identity,i", "Print system UUID and serial numbers only")
+        ("read-file,r", po::value<string>(&_from_file), "Read SMBIOS table dump from this file, or every dump of this directory")
         ("dump-file,d", po::value<string>(&_to_file), "Dump existing SMBIOS table to this file")
+        ("format,f", po::value<string>(&_format)->default_value("text"), "Output format: text, json, columnar (binary), cbor (binary), csv or tsv")
+        ("type,t", po::value<string>(&_type_text), "Structure type exported by csv and tsv formats; with --dmidecode-compat types and keywords as dmidecode -t takes")
+        ("render-cache", po::value<string>(&_render_cache), "Reuse output rendered for the same table, cached in this directory")
+        ("output-stats", "Report bytes written and write calls to stderr")
+        ("select", po::value<string>(&_select), "Print only these fields, e.g. type17.size,type17.part_number (text or json format)")
+        ("threads,j", po::value<int>(&_threads)->default_value(1), "Render structures of the text format on this many threads, 0 for every core")
+        ("dmidecode-compat", "Print the table as dmidecode does")
+        ("string,s", po::value<string>(&_dmidecode_string), "Print only the value of this dmidecode keyword, e.g. system-serial-number (with --dmidecode-compat)")
         ;
 
     // command line params processing
@@ -31,9 +41,58 @@ void CommandLineParams::read_params(int argc, char* argv[])
     set_flag(cmd_variables_map, _help, "help");
     set_flag(cmd_variables_map, _version, "version");
     set_flag(cmd_variables_map, _memory_scan, "memory-scan");
+    set_flag(cmd_variables_map, _identity, "identity");
+    set_flag(cmd_variables_map, _output_stats, "output-stats");
+    set_flag(cmd_variables_map, _dmidecode_compat, "dmidecode-compat");
+
+    if (_format != "text" && _format != "json" && _format != "columnar" && _format != "cbor" && _format != "csv" && _format != "tsv") {
+        throw po::validation_error(po::validation_error::invalid_option_value, "format", _format);
+    }
+
+    if (_threads < 0) {
+        throw po::validation_error(po::validation_error::invalid_option_value, "threads", std::to_string(_threads));
+    }
+
+    if (!_select.empty() && _format != "text" && _format != "json") {
+        throw po::validation_error(po::validation_error::invalid_option_value, "format", _format);
+    }
+
+    // delimited export is a table of single structure type
+    if (_format == "csv" || _format == "tsv") {
+        if (!cmd_variables_map.count("type")) {
+            throw po::required_option("type");
+        }
+        const bool digits = !_type_text.empty() && _type_text.size() <= 3
+            && std::all_of(_type_text.begin(), _type_text.end(), [](char c) { return c >= '0' && c <= '9'; });
+        _type = digits ? std::stoi(_type_text) : -1;
+        if (_type < 0 || _type > 0xFF) {
+            throw po::validation_error(po::validation_error::invalid_option_value, "type", _type_text);
+        }
+    }
+
+    // dmidecode layout is text only, -t and -s take dmidecode arguments
+    if (_dmidecode_compat) {
+        if (_format != "text" || !_select.empty()) {
+            throw po::validation_error(po::validation_error::invalid_option_value, "format", _format);
+        }
+        if (cmd_variables_map.count("type")) {
+            try {
+                _dmidecode_types = parse_dmidecode_types(_type_text);
+            }
+            catch (const std::invalid_argument&) {
+                throw po::validation_error(po::validation_error::invalid_option_value, "type", _type_text);
+            }
+        }
+        if (cmd_variables_map.count("string") && !is_dmidecode_keyword(_dmidecode_string)) {
+            throw po::validation_error(po::validation_error::invalid_option_value, "string", _dmidecode_string);
+        }
+    }
+    else if (cmd_variables_map.count("string")) {
+        throw po::required_option("dmidecode-compat");
+    }
 
     // do not check debug flags!
-    std::list<bool> mutually_exclusives = { _help, _version, _memory_scan };
+    std::list<bool> mutually_exclusives = { _help, _version, _memory_scan, _identity };
     size_t options_count = std::count(mutually_exclusives.begin(), mutually_exclusives.end(), true);
     if (options_count > 1){
         throw std::logic_error("Incompatible command line parameters set, use only one");
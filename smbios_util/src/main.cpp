@@ -1,9 +1,34 @@
+#include <cstdio>
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <memory>
+#include <deque>
+#include <boost/filesystem.hpp>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+#if defined(_WIN32) || defined(_WIN64)
+#include <smbios/win_bios.h>
+#else
+#include <smbios/unix_bios.h>
+#endif
 #include <smbios/smbios.h>
 #include <smbios/memory_device_entry.h>
 #include <smbios/smbios_entry_factory.h>
+#include <smbios/system_identity.h>
+#include <smbios/render_buffer.h>
+#include <smbios/smbios_json.h>
+#include <smbios/smbios_cbor.h>
+#include <smbios/columnar_export.h>
+#include <smbios/csv_export.h>
+#include <smbios/table_dump.h>
+#include <smbios/projection.h>
+#include <smbios/vectored_output.h>
+#include <smbios/render_cache.h>
+#include <smbios/dmidecode_output.h>
+#include <smbios/parallel_render.h>
 #include <smbios_util/command_line_parser.h>
 
 using namespace std;
@@ -28,11 +53,250 @@ void print_version()
     exit(EXIT_SUCCESS);
 }
 
+/// All output goes to the descriptor directly, std::cout is used for usage and errors only
+static int stdout_descriptor()
+{
+#ifdef _WIN32
+    return _fileno(stdout);
+#else
+    return fileno(stdout);
+#endif
+}
+
+/// Binary output should not be altered by newline translation
+static void set_binary_stdout()
+{
+#ifdef _WIN32
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+}
+
+/// Export every dump of the directory, host is the dump file name without extension
+/// Broken dumps are reported and skipped, so one bad file does not stop the fleet export,
+/// false is returned if any dump was skipped
+/// Rows of many tables are collected into chunks, pending chunks are written at once
+static bool export_directory(const std::string& directory, const std::string& format, uint8_t type, VectoredOutput& output)
+{
+    const std::vector<std::string> paths = list_table_dumps(directory);
+    bool all_exported = true;
+
+    auto read_dump = [](const std::string& path) {
+        TableDump dump = read_table_dump(path);
+        return std::unique_ptr<SMBios>(new SMBios(std::move(dump.table), dump.version));
+    };
+    auto host_name = [](const std::string& path) {
+        return boost::filesystem::path(path).stem().string();
+    };
+
+    if (format == "columnar") {
+        // exporter refers to the tables until serialization
+        std::deque<std::unique_ptr<SMBios>> tables;
+        ColumnarExporter exporter;
+        for (const std::string& path : paths) {
+            try {
+                tables.push_back(read_dump(path));
+                exporter.add_table(*tables.back(), host_name(path));
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Skip " << path << ": " << e.what() << '\n';
+                all_exported = false;
+            }
+        }
+        const std::vector<uint8_t> file = exporter.serialize();
+        set_binary_stdout();
+        output.buffer().append(reinterpret_cast<const char*>(file.data()), file.size());
+        return all_exported;
+    }
+
+    // sequence of per-host messages, each dump is decoded and encoded on its own
+    if (format == "cbor") {
+        set_binary_stdout();
+        for (const std::string& path : paths) {
+            try {
+                const std::unique_ptr<SMBios> bios = read_dump(path);
+                render_cbor(*bios, host_name(path), output.buffer());
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Skip " << path << ": " << e.what() << '\n';
+                all_exported = false;
+            }
+            output.commit();
+        }
+        return all_exported;
+    }
+
+    if (format != "csv" && format != "tsv") {
+        throw std::runtime_error("Directory of dumps is supported by csv, tsv, cbor and columnar formats only");
+    }
+
+    const CsvExporter exporter(type, format == "csv" ? DelimitedFormat::Csv : DelimitedFormat::Tsv, true);
+    exporter.render_header(output.buffer());
+    for (const std::string& path : paths) {
+        try {
+            const std::unique_ptr<SMBios> bios = read_dump(path);
+            exporter.render_rows(*bios, host_name(path), output.buffer());
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Skip " << path << ": " << e.what() << '\n';
+            all_exported = false;
+        }
+        output.commit();
+    }
+    return all_exported;
+}
+
+/// Identity is scanned right from the table bytes, structures are not listed and entries are not built
+/// SMBios is only constructed for the physical memory fallback, when no system source has the table
+static SystemIdentity read_identity(const std::string& read_from_file)
+{
+    if (!read_from_file.empty()) {
+        const TableDump dump = read_table_dump(read_from_file);
+        return read_system_identity(dump.table.data(), dump.table.size(), dump.version);
+    }
+
+    const SMBiosImpl native;
+    if (native.smbios_read_success()) {
+        const SMBiosVersion version = { static_cast<uint16_t>(native.get_major_version()),
+            static_cast<uint16_t>(native.get_minor_version()) };
+        return read_system_identity(native.get_table_base(), native.get_table_size(), version);
+    }
+    return SMBios().identity();
+}
+
+/// Single table in the requested form, no side effects, so the result could be cached
+static void render_table(const SMBios& bios, const CommandLineParams& params, const Projection* projection, RenderBuffer& out)
+{
+    const std::string& format = params.format();
+
+    if (params.is_dmidecode_compat()) {
+        if (!params.dmidecode_string().empty()) {
+            render_dmidecode_string(bios, params.dmidecode_string(), out);
+        }
+        else {
+            render_dmidecode(bios, params.dmidecode_types(), out);
+        }
+        return;
+    }
+
+    if (projection) {
+        if (format == "json") {
+            projection->render_json(bios, out);
+        }
+        else {
+            projection->render_to(bios, out);
+        }
+        return;
+    }
+
+    if (format == "json") {
+        render_json(bios, out);
+        return;
+    }
+
+    if (format == "cbor") {
+        render_cbor(bios, "", out);
+        return;
+    }
+
+    if (format == "csv" || format == "tsv") {
+        const CsvExporter exporter(static_cast<uint8_t>(params.structure_type()),
+            format == "csv" ? DelimitedFormat::Csv : DelimitedFormat::Tsv, false);
+        exporter.render_header(out);
+        exporter.render_rows(bios, "", out);
+        return;
+    }
+
+    if (format == "columnar") {
+        ColumnarExporter exporter;
+        exporter.add_table(bios, "");
+        const std::vector<uint8_t> file = exporter.serialize();
+        out.append(reinterpret_cast<const char*>(file.data()), file.size());
+        return;
+    }
+
+    SMBiosVersion ver = bios.get_smbios_version();
+    out << "DMI version: " << ver.major_version << '.' << ver.minor_version << '\n';
+    out << "Table size: " << bios.get_table_size() << '\n';
+    bios.render_to(out);
+
+    render_structures(bios, out, params.threads());
+}
+
+/// Everything the output depends on besides the table bytes and version
+static std::string render_options(const SMBios& bios, const CommandLineParams& params)
+{
+    RenderBuffer options;
+    options << params.format() << '\0' << params.structure_type() << '\0' << params.select() << '\0'
+        << (params.is_dmidecode_compat() ? "dmidecode" : "") << '\0' << params.type_text() << '\0' << params.dmidecode_string() << '\0';
+    // entry point is a part of text and JSON output, it is not in the table
+    bios.render_to(options);
+    return options.str();
+}
+
+/// Read the table and render it in the requested form, false if some dumps of the directory were skipped
+static bool run(VectoredOutput& output, const CommandLineParams& params, const Projection* projection, RenderCache* cache)
+{
+    const std::string& read_from_file = params.read_from_file();
+    const std::string& format = params.format();
+
+    if (!read_from_file.empty() && boost::filesystem::is_directory(read_from_file)) {
+        return export_directory(read_from_file, format, static_cast<uint8_t>(params.structure_type()), output);
+    }
+
+    if (params.is_identity()) {
+        render_system_identity(read_identity(read_from_file), output.buffer());
+        return true;
+    }
+
+    std::unique_ptr<SMBios> bios_holder;
+    if (!read_from_file.empty()) {
+        TableDump dump = read_table_dump(read_from_file);
+        bios_holder.reset(new SMBios(std::move(dump.table), dump.version));
+    }
+    else {
+        bios_holder.reset(new SMBios());
+    }
+    const SMBios& bios = *bios_holder;
+
+    if (format == "columnar" || format == "cbor") {
+        set_binary_stdout();
+    }
+
+    // dump is written instead of the structures description
+    const std::string& dump_to_file = params.dump_to_file();
+    if (format == "text" && !projection && !dump_to_file.empty()) {
+        RenderBuffer& out = output.buffer();
+        SMBiosVersion ver = bios.get_smbios_version();
+        out << "DMI version: " << ver.major_version << '.' << ver.minor_version << '\n';
+        out << "Table size: " << bios.get_table_size() << '\n';
+        bios.render_to(out);
+
+        std::basic_ofstream<uint8_t, std::char_traits<uint8_t>> is(dump_to_file, std::ios::binary);
+        const uint8_t* table_begin = bios.get_table_base();
+        size_t table_size = bios.get_table_size();
+        is.write(table_begin, table_size);
+        out << "Dump SMBIOS table to file " << dump_to_file << ", size = " << table_size << '\n';
+        return true;
+    }
+
+    if (!cache) {
+        render_table(bios, params, projection, output.buffer());
+        return true;
+    }
+
+    const RenderKey key = make_render_key(bios.get_table_base(), bios.get_table_size(), bios.get_smbios_version(),
+        render_options(bios, params));
+    cache->render(key, output.buffer(), [&](RenderBuffer& out) {
+        render_table(bios, params, projection, out);
+    });
+    return true;
+}
+
 int main(int argc, char* argv[]){
 
     setlocale(0, "");
-    std::string dump_to_file;
-    std::string read_from_file;
+    std::unique_ptr<Projection> projection;
+    std::unique_ptr<RenderCache> cache;
 
     try {
         get_params().read_params(argc, argv);
@@ -46,8 +310,16 @@ int main(int argc, char* argv[]){
             print_version();
         }
 
-        dump_to_file = cmd_line_params.dump_to_file();
-        read_from_file = cmd_line_params.read_from_file();
+        // selection is compiled once, before the table is read
+        if (!cmd_line_params.select().empty()) {
+            projection.reset(new Projection(cmd_line_params.select()));
+        }
+
+        // process renders single table, only the disk part of the cache is useful across runs
+        if (!cmd_line_params.render_cache().empty()) {
+            constexpr size_t render_cache_memory = 64 * 1024 * 1024;
+            cache.reset(new RenderCache(render_cache_memory, cmd_line_params.render_cache()));
+        }
     }
     // boost::program_options exception reports
     // about wrong command line parameters usage
@@ -56,44 +328,40 @@ int main(int argc, char* argv[]){
         cout << get_params().options_descript() << endl;
         usage();
     }
+    catch (const std::invalid_argument& e) {
+        cout << "Field selection error: " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
 
 
-    try{
-        SMBios bios;
-
-        if (!read_from_file.empty()) {
-            // TODO: read dump from file
-            // create SMBios in empty state
-            // use read_physical_memory without scanning sources
-        }
+    // the whole output is rendered into chunks and written by as few calls as possible
+    VectoredOutput output(stdout_descriptor());
 
-        SMBiosVersion ver = bios.get_smbios_version();
-        std::cout << "DMI version: " << ver.major_version << '.' << ver.minor_version << '\n';
-        std::cout << "Table size: " << bios.get_table_size() << '\n';
-        std::cout << bios.render_to_description();
-
-        if (!dump_to_file.empty()) {
-            std::basic_ofstream<uint8_t, std::char_traits<uint8_t>> is(dump_to_file, std::ios::binary);
-            const uint8_t* table_begin = bios.get_table_base();
-            size_t table_size = bios.get_table_size();
-            is.write(table_begin, table_size);
-            cout << "Dump SMBIOS table to file " << dump_to_file << ", size = " << table_size << '\n';
-            return EXIT_SUCCESS;
-        }
-
-        SMBiosEntryFactory smbios_factory;
-        for (const DMIHeader& header : bios) {
-
-            std::cout << "Header ID = " << header.get_type() << '\n';
-            std::unique_ptr<AbstractSMBiosEntry> entry = smbios_factory.create(header, ver);
-            if (entry) {
-                std::cout << entry->render_to_description() << '\n';
-            }
+    // pipelines rely on the status: unreadable table or skipped dumps are failures
+    int status = EXIT_SUCCESS;
+    try{
+        if (!run(output, get_params(), projection.get(), cache.get())) {
+            status = EXIT_FAILURE;
         }
+        output.flush();
     }
     catch (const std::exception& e){
+        try {
+            output.flush();
+        }
+        catch (const std::exception&) {
+        }
         std::cerr << "Unable to read SMBIOS table, exception occur: " << e.what() << '\n';
+        status = EXIT_FAILURE;
+    }
+
+    if (get_params().is_output_stats()) {
+        std::cerr << "Bytes written: " << output.get_bytes_written() << ", write calls: " << output.get_write_calls();
+        if (cache) {
+            std::cerr << ", render cache " << (cache->get_hits() ? "hit" : "miss");
+        }
+        std::cerr << '\n';
     }
 
-    return 0;
+    return status;
 }